@@ -61,6 +61,19 @@ public:
       ROptions() : fLineBreak(ELineBreaks::kAuto), fBlockSize(-1) {}
    };
 
+   /// Used for vector reads from multiple offsets into multiple buffers. This is unlike readv(), which scatters a
+   /// single byte range from disk into multiple buffers.
+   struct RIOVec {
+      /// The destination for reading
+      void *fBuffer = nullptr;
+      /// The file offset
+      std::uint64_t fOffset = 0;
+      /// The number of desired bytes
+      std::size_t fSize = 0;
+      /// The number of actually read bytes, set by ReadV()
+      std::size_t fOutBytes = 0;
+   };
+
 private:
    /// Don't change without adapting ReadAt()
    static constexpr unsigned int kNumBlockBuffers = 2;
@@ -116,6 +129,9 @@ protected:
    virtual void *MapImpl(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset);
    /// Derived classes with mmap support must be able to unmap the memory area handed out by Map()
    virtual void UnmapImpl(void *region, size_t nbytes);
+   /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. by remote access protocols
+   /// that can bundle the requests in a single network round trip
+   virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
 
 public:
    RRawFile(std::string_view url, ROptions options);
@@ -140,6 +156,9 @@ public:
    size_t ReadAt(void *buffer, size_t nbytes, std::uint64_t offset);
    /// Read from fFilePos offset. Returns the actual number of bytes read.
    size_t Read(void *buffer, size_t nbytes);
+   /// Vectored read from multiple offsets into multiple buffers. Sets fOutBytes for every request; short reads
+   /// indicate the end of the file
+   void ReadV(RIOVec *ioVec, unsigned int nReq);
    /// Change the cursor fFilePos
    void Seek(std::uint64_t offset);
    /// Returns the size of the file
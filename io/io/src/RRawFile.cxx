@@ -147,6 +147,21 @@ size_t ROOT::Internal::RRawFile::Read(void *buffer, size_t nbytes)
    return res;
 }
 
+void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
+{
+   if (!fIsOpen)
+      OpenImpl();
+   fIsOpen = true;
+   ReadVImpl(ioVec, nReq);
+}
+
+void ROOT::Internal::RRawFile::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   for (unsigned i = 0; i < nReq; ++i) {
+      ioVec[i].fOutBytes = ReadAt(ioVec[i].fBuffer, ioVec[i].fSize, ioVec[i].fOffset);
+   }
+}
+
 size_t ROOT::Internal::RRawFile::ReadAt(void *buffer, size_t nbytes, std::uint64_t offset)
 {
    if (!fIsOpen)
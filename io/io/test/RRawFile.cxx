@@ -215,6 +215,33 @@ TEST(RRawFile, ReadBuffered)
 }
 
 
+TEST(RRawFile, ReadV)
+{
+   char buffer[5];
+   RRawFile::ROptions options;
+   options.fBlockSize = 0;
+   std::unique_ptr<RRawFileMock> f(new RRawFileMock("abcdef", options));
+
+   RRawFile::RIOVec iovec[3];
+   iovec[0].fBuffer = &buffer[0];
+   iovec[0].fOffset = 0;
+   iovec[0].fSize = 1;
+   iovec[1].fBuffer = &buffer[1];
+   iovec[1].fOffset = 3;
+   iovec[1].fSize = 2;
+   // Short read at the end of the file
+   iovec[2].fBuffer = &buffer[3];
+   iovec[2].fOffset = 5;
+   iovec[2].fSize = 2;
+   f->ReadV(iovec, 3);
+   EXPECT_EQ(1U, iovec[0].fOutBytes);
+   EXPECT_EQ(2U, iovec[1].fOutBytes);
+   EXPECT_EQ(1U, iovec[2].fOutBytes);
+   EXPECT_EQ(std::string("adef"), std::string(buffer, 4));
+   EXPECT_EQ(3u, f->fNumReadAt);
+}
+
+
 TEST(RRawFile, Mmap)
 {
    std::uint64_t mapdOffset;
@@ -39,6 +39,7 @@ protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    std::uint64_t GetSizeImpl() final;
+   void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
 
 public:
    RRawFileDavix(std::string_view url, RRawFile::ROptions options);
@@ -13,6 +13,7 @@
 #include "ROOT/RMakeUnique.hxx"
 
 #include <stdexcept>
+#include <vector>
 
 #include <davix.hpp>
 #include <sys/stat.h>
@@ -85,3 +86,25 @@ size_t ROOT::Internal::RRawFileDavix::ReadAtImpl(void *buffer, size_t nbytes, st
    }
    return static_cast<size_t>(retval);
 }
+
+void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   Davix::DavixError *davixErr = nullptr;
+   std::vector<Davix::DavIOVecInput> in(nReq);
+   std::vector<Davix::DavIOVecOuput> out(nReq);
+
+   for (unsigned int i = 0; i < nReq; ++i) {
+      in[i].diov_buffer = ioVec[i].fBuffer;
+      in[i].diov_offset = ioVec[i].fOffset;
+      in[i].diov_size = ioVec[i].fSize;
+   }
+
+   auto ret = fFileDes->pos.preadVec(fFileDes->fd, in.data(), out.data(), nReq, &davixErr);
+   if (ret < 0) {
+      throw std::runtime_error("Cannot do vector read from '" + fUrl + "', error: " + davixErr->getErrMsg());
+   }
+
+   for (unsigned int i = 0; i < nReq; ++i) {
+      ioVec[i].fOutBytes = out[i].diov_size;
+   }
+}
@@ -0,0 +1,36 @@
+// Author: The ROOT Team  10/2026
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RCACHEOPTIONS
+#define ROOT_RCACHEOPTIONS
+
+#include <Compression.h>
+#include <ROOT/RStringView.hxx>
+#include <string>
+
+namespace ROOT {
+
+namespace RDF {
+/// A collection of options to steer the caching of a dataset with RInterface::Cache
+struct RCacheOptions {
+   using ECAlgo = ROOT::ECompressionAlgorithm;
+   RCacheOptions() = default;
+   RCacheOptions(const RCacheOptions &) = default;
+   RCacheOptions(RCacheOptions &&) = default;
+   RCacheOptions(std::string_view directory, std::string_view tag = "") : fDirectory(directory), fTag(tag) {}
+   std::string fDirectory;                    ///< Directory of the cache files. If empty, the cache is kept in memory
+   std::string fTag;                          ///< Part of the cache key: change it when the code of the callables changes
+   ECAlgo fCompressionAlgorithm = ROOT::kLZ4; ///< Compression algorithm of the cache files
+   int fCompressionLevel = 4;                 ///< Compression level of the cache files
+};
+} // ns RDF
+} // ns ROOT
+
+#endif
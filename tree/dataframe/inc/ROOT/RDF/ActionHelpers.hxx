@@ -24,6 +24,8 @@
 #include "ROOT/RDF/RDisplay.hxx"
 #include "RtypesCore.h"
 #include "TBranch.h"
+#include "TBuffer.h"
+#include "TClass.h"
 #include "TClassEdit.h"
 #include "TDirectory.h"
 #include "TFile.h" // for SnapshotHelper
@@ -83,6 +85,91 @@ using Hist_t = ::TH1D;
 template <typename T>
 using Results = typename std::conditional<std::is_same<T, bool>::value, std::deque<T>, std::vector<T>>::type;
 
+// The worker processes of a multi-process event loop are forked from the parent process: arithmetic values and
+// contiguous arrays thereof are transferred as raw bytes, all other types are streamed through their dictionary.
+template <typename T>
+TClass *GetPartialResultClass()
+{
+   auto cl = TClass::GetClass(typeid(T));
+   if (!cl) {
+      throw std::runtime_error("Cannot transfer results of type " + TypeID2TypeName(typeid(T)) +
+                               " between processes: no dictionary is available for this type.");
+   }
+   return cl;
+}
+
+template <typename T>
+void WritePartialResult(TBuffer &buf, const T &v, std::true_type /*isArithmetic*/)
+{
+   buf.WriteFastArray(reinterpret_cast<const char *>(&v), sizeof(T));
+}
+
+template <typename T>
+void WritePartialResult(TBuffer &buf, const T &v, std::false_type /*isArithmetic*/)
+{
+   buf.WriteObjectAny(&v, GetPartialResultClass<T>());
+}
+
+template <typename T>
+void WritePartialResult(TBuffer &buf, const T &v)
+{
+   WritePartialResult(buf, v, std::is_arithmetic<T>{});
+}
+
+template <typename T>
+void WritePartialResult(TBuffer &buf, const std::vector<T> &v, std::true_type /*isContiguous*/)
+{
+   const ULong64_t size = v.size();
+   WritePartialResult(buf, size);
+   buf.WriteFastArray(reinterpret_cast<const char *>(v.data()), size * sizeof(T));
+}
+
+template <typename T>
+void WritePartialResult(TBuffer &buf, const std::vector<T> &v)
+{
+   using IsContiguous_t = std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>;
+   WritePartialResult(buf, v, IsContiguous_t{});
+}
+
+template <typename T>
+void ReadPartialResult(TBuffer &buf, T &v, std::true_type /*isArithmetic*/)
+{
+   buf.ReadFastArray(reinterpret_cast<char *>(&v), sizeof(T));
+}
+
+template <typename T>
+void ReadPartialResult(TBuffer &buf, T &v, std::false_type /*isArithmetic*/)
+{
+   auto cl = GetPartialResultClass<T>();
+   auto obj = static_cast<T *>(buf.ReadObjectAny(cl));
+   if (!obj)
+      throw std::runtime_error("Cannot read the result of a worker process.");
+   v = std::move(*obj);
+   cl->Destructor(obj);
+}
+
+template <typename T>
+void ReadPartialResult(TBuffer &buf, T &v)
+{
+   ReadPartialResult(buf, v, std::is_arithmetic<T>{});
+}
+
+template <typename T>
+void ReadPartialResult(TBuffer &buf, std::vector<T> &v, std::true_type /*isContiguous*/)
+{
+   ULong64_t size = 0;
+   ReadPartialResult(buf, size);
+   v.resize(size);
+   buf.ReadFastArray(reinterpret_cast<char *>(v.data()), size * sizeof(T));
+}
+
+template <typename T>
+void ReadPartialResult(TBuffer &buf, std::vector<T> &v)
+{
+   using IsContiguous_t = std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>;
+   ReadPartialResult(buf, v, IsContiguous_t{});
+}
+
 template <typename F>
 class ForeachSlotHelper : public RActionImpl<ForeachSlotHelper<F>> {
    F fCallable;
@@ -124,6 +211,8 @@ public:
    void Initialize() { /* noop */}
    void Finalize();
    ULong64_t &PartialUpdate(unsigned int slot);
+   void SerializeResult(TBuffer &buf);
+   void MergeResult(TBuffer &buf);
 
    std::string GetActionName() { return "Count"; }
 };
@@ -238,6 +327,8 @@ public:
    void Initialize() { /* noop */}
 
    void Finalize();
+   void SerializeResult(TBuffer &buf);
+   void MergeResult(TBuffer &buf);
 
    std::string GetActionName() { return "Fill"; }
 };
@@ -431,6 +522,19 @@ public:
 
    HIST &PartialUpdate(unsigned int slot) { return *fObjects[slot]; }
 
+   void SerializeResult(TBuffer &buf) { buf.WriteObjectAny(fObjects[0], GetPartialResultClass<HIST>()); }
+
+   void MergeResult(TBuffer &buf)
+   {
+      auto obj = static_cast<HIST *>(buf.ReadObjectAny(GetPartialResultClass<HIST>()));
+      if (!obj)
+         throw std::runtime_error("Cannot read the result of a worker process.");
+      TList l;
+      l.SetOwner();
+      l.Add(obj);
+      fObjects[0]->Merge(&l);
+   }
+
    std::string GetActionName() { return "FillPar"; }
 };
 
@@ -556,6 +660,18 @@ public:
 
    COLL &PartialUpdate(unsigned int slot) { return *fColls[slot].get(); }
 
+   void SerializeResult(TBuffer &buf) { WritePartialResult(buf, *fColls[0]); }
+
+   void MergeResult(TBuffer &buf)
+   {
+      COLL coll;
+      ReadPartialResult(buf, coll);
+      const auto end = coll.end();
+      for (auto j = coll.begin(); j != end; j++) {
+         FillColl(*j, *fColls[0]);
+      }
+   }
+
    std::string GetActionName() { return "Take"; }
 };
 
@@ -601,6 +717,15 @@ public:
 
    std::vector<T> &PartialUpdate(unsigned int slot) { return *fColls[slot]; }
 
+   void SerializeResult(TBuffer &buf) { WritePartialResult(buf, *fColls[0]); }
+
+   void MergeResult(TBuffer &buf)
+   {
+      std::vector<T> coll;
+      ReadPartialResult(buf, coll);
+      fColls[0]->insert(fColls[0]->end(), coll.begin(), coll.end());
+   }
+
    std::string GetActionName() { return "Take"; }
 };
 
@@ -638,6 +763,17 @@ public:
       }
    }
 
+   void SerializeResult(TBuffer &buf) { WritePartialResult(buf, *fColls[0]); }
+
+   void MergeResult(TBuffer &buf)
+   {
+      COLL coll;
+      ReadPartialResult(buf, coll);
+      for (auto &v : coll) {
+         fColls[0]->emplace_back(v);
+      }
+   }
+
    std::string GetActionName() { return "Take"; }
 };
 
@@ -683,6 +819,15 @@ public:
       }
    }
 
+   void SerializeResult(TBuffer &buf) { WritePartialResult(buf, *fColls[0]); }
+
+   void MergeResult(TBuffer &buf)
+   {
+      std::vector<std::vector<RealT_t>> coll;
+      ReadPartialResult(buf, coll);
+      fColls[0]->insert(fColls[0]->end(), coll.begin(), coll.end());
+   }
+
    std::string GetActionName() { return "Take"; }
 };
 
@@ -746,6 +891,15 @@ public:
 
    ResultType &PartialUpdate(unsigned int slot) { return fMins[slot]; }
 
+   void SerializeResult(TBuffer &buf) { WritePartialResult(buf, *fResultMin); }
+
+   void MergeResult(TBuffer &buf)
+   {
+      auto m = std::numeric_limits<ResultType>::max();
+      ReadPartialResult(buf, m);
+      fMins[0] = std::min(m, fMins[0]);
+   }
+
    std::string GetActionName() { return "Min"; }
 };
 
@@ -791,6 +945,15 @@ public:
 
    ResultType &PartialUpdate(unsigned int slot) { return fMaxs[slot]; }
 
+   void SerializeResult(TBuffer &buf) { WritePartialResult(buf, *fResultMax); }
+
+   void MergeResult(TBuffer &buf)
+   {
+      auto m = std::numeric_limits<ResultType>::lowest();
+      ReadPartialResult(buf, m);
+      fMaxs[0] = std::max(m, fMaxs[0]);
+   }
+
    std::string GetActionName() { return "Max"; }
 };
 
@@ -849,6 +1012,22 @@ public:
 
    ResultType &PartialUpdate(unsigned int slot) { return fSums[slot]; }
 
+   // Only the partial sums are transferred: the initial value of the result is added once, by the parent process
+   void SerializeResult(TBuffer &buf)
+   {
+      ResultType sum = NeutralElement(*fResultSum, -1);
+      for (auto &m : fSums)
+         sum += m;
+      WritePartialResult(buf, sum);
+   }
+
+   void MergeResult(TBuffer &buf)
+   {
+      ResultType sum = NeutralElement(*fResultSum, -1);
+      ReadPartialResult(buf, sum);
+      fSums[0] += sum;
+   }
+
    std::string GetActionName() { return "Sum"; }
 };
 
@@ -879,6 +1058,8 @@ public:
    void Finalize();
 
    double &PartialUpdate(unsigned int slot);
+   void SerializeResult(TBuffer &buf);
+   void MergeResult(TBuffer &buf);
 
    std::string GetActionName() { return "Mean"; }
 };
@@ -42,6 +42,7 @@ private:
    unsigned int fCounter; ///< Nodes may share the same name (e.g. Filter). To manage this situation in dot, each node
    ///< is represented by an unique id.
    std::string fName, fColor, fShape;
+   std::string fProfileLabel; ///< Summary of the profile of the node, not part of its name: only shown by SaveGraph
    std::vector<std::string>
       fDefinedColumns; ///< Columns defined up to this node. By checking the defined columns between two consecutive
                        ///< nodes, it is possible to know if there was some Define in between.
@@ -74,6 +75,10 @@ public:
    /// \brief Appends a node on the head of the current node
    void SetPrevNode(const std::shared_ptr<GraphNode> &node) { fPrevNode = node; }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Sets the summary of the profile of the node, see RInterface::SetProfiling
+   void SetProfileLabel(const std::string &label) { fProfileLabel = label; }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Adds the column defined up to the node
    void AddDefinedColumns(const std::vector<std::string> &columns) { fDefinedColumns = columns; }
@@ -62,6 +62,8 @@ private:
    using FiltersNodesMap_t = std::map<const ROOT::Detail::RDF::RFilterBase *, std::weak_ptr<GraphNode>>;
    using RangesNodesMap_t = std::map<const ROOT::Detail::RDF::RRangeBase *, std::weak_ptr<GraphNode>>;
 
+   bool fWithProfiles = false; ///< Whether the labels of the nodes include the summaries of their profiles
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Stores the columns defined and which node in the graph defined them.
    static ColumnsNodesMap_t &GetStaticColumnsMap()
@@ -99,6 +101,13 @@ private:
    /// \brief Invoked by the RNodes to create a Range graph node.
    friend std::shared_ptr<GraphNode> CreateRangeNode(const ROOT::Detail::RDF::RRangeBase *rangePtr);
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief The label of the node in the dot representation
+   std::string GetLabel(const GraphNode &node) const
+   {
+      return fWithProfiles ? node.fName + node.fProfileLabel : node.fName;
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Starting from any leaf (Action, Filter, Range) it draws the dot representation of the branch.
    std::string FromGraphLeafToDot(std::shared_ptr<GraphNode> leaf);
@@ -146,6 +155,10 @@ private:
    }
 
 public:
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Creates a helper whose labels include the profiles of the nodes if withProfiles is true
+   GraphCreatorHelper(bool withProfiles = false) : fWithProfiles(withProfiles) {}
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Functor. Initializes the static members and delegates the work to the right override.
    /// \tparam NodeType the RNode from which the graph has to be drawn
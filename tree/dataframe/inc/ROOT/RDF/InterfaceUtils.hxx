@@ -22,7 +22,9 @@
 #include <ROOT/RDF/RJittedCustomColumn.hxx>
 #include <ROOT/RDF/RJittedFilter.hxx>
 #include <ROOT/RDF/RLoopManager.hxx>
+#include <ROOT/RCacheOptions.hxx>
 #include <ROOT/RMakeUnique.hxx>
+#include <ROOT/RSnapshotOptions.hxx>
 #include <ROOT/RStringView.hxx>
 #include <ROOT/TypeTraits.hxx>
 #include <TError.h> // gErrorIgnoreLevel
@@ -32,6 +34,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
@@ -74,6 +77,16 @@ HeadNode_t CreateSnapshotRDF(const ColumnNames_t &validCols,
                             RLoopManager &loopManager,
                             std::unique_ptr<RDFInternal::RActionBase> actionPtr);
 
+/// Return a RLoopManager that reads the columns of `node` from the persistent cache described by `options`. If no
+/// valid cache file exists for the computation graph, the columns and the input dataset, `snapshot` is called with
+/// the name of the tree and of the file to write and the options to write them with.
+using CacheSnapshot_t = std::function<void(const std::string &, const std::string &, const RSnapshotOptions &)>;
+std::shared_ptr<RLoopManager> GetPersistentCache(const RNodeBase &node, RLoopManager &lm,
+                                                 const RBookedCustomColumns &customColumns,
+                                                 const ColumnNames_t &columns,
+                                                 const std::vector<std::string> &columnTypes,
+                                                 const RCacheOptions &options, const CacheSnapshot_t &snapshot);
+
 std::string DemangleTypeIdName(const std::type_info &typeInfo);
 
 ColumnNames_t ConvertRegexToColumns(const RDFInternal::RBookedCustomColumns &customColumns, TTree *tree,
@@ -248,6 +261,8 @@ void CheckCustomColumn(std::string_view definedCol, TTree *treePtr, const Column
 
 std::string PrettyPrintAddr(const void *const addr);
 
+std::string DeclareLambda(const std::string &lambdaCode, const std::string &expression, const ColumnNames_t &argTypes);
+
 void BookFilterJit(RJittedFilter *jittedFilter, void *prevNodeOnHeap, std::string_view name,
                    std::string_view expression, const std::map<std::string, std::string> &aliasMap,
                    const ColumnNames_t &branches, const RDFInternal::RBookedCustomColumns &customCols, TTree *tree,
@@ -336,8 +351,8 @@ void JitFilterHelper(F &&f, const ColumnNames_t &cols, std::string_view name, RJ
                      std::shared_ptr<PrevNode> *prevNodeOnHeap, RDFInternal::RBookedCustomColumns *customColumns)
 {
    // mock Filter logic -- validity checks and Define-ition of RDataSource columns
-   using F_t = RFilter<F, PrevNode>;
-   using ColTypes_t = typename TTraits::CallableTraits<F>::arg_types;
+   using F_t = RFilter<typename std::decay<F>::type, PrevNode>;
+   using ColTypes_t = typename TTraits::CallableTraits<typename std::decay<F>::type>::arg_types;
    constexpr auto nColumns = ColTypes_t::list_size;
    RDFInternal::CheckFilter(f);
 
@@ -352,7 +367,7 @@ void JitFilterHelper(F &&f, const ColumnNames_t &cols, std::string_view name, RJ
    // share data after it has lazily compiled the code. Here the data has been used and the memory can be freed.
    delete customColumns;
 
-   jittedFilter->SetFilter(std::make_unique<F_t>(std::move(f), cols, *prevNodeOnHeap, newColumns, name));
+   jittedFilter->SetFilter(std::make_unique<F_t>(std::forward<F>(f), cols, *prevNodeOnHeap, newColumns, name));
    delete prevNodeOnHeap;
 }
 
@@ -360,8 +375,8 @@ template <typename F>
 void JitDefineHelper(F &&f, const ColumnNames_t &cols, std::string_view name, RLoopManager *lm,
                      RJittedCustomColumn &jittedCustomCol, RDFInternal::RBookedCustomColumns *customColumns)
 {
-   using NewCol_t = RCustomColumn<F, CustomColExtraArgs::None>;
-   using ColTypes_t = typename TTraits::CallableTraits<F>::arg_types;
+   using NewCol_t = RCustomColumn<typename std::decay<F>::type, CustomColExtraArgs::None>;
+   using ColTypes_t = typename TTraits::CallableTraits<typename std::decay<F>::type>::arg_types;
    constexpr auto nColumns = ColTypes_t::list_size;
 
    auto ds = lm->GetDataSource();
@@ -374,7 +389,7 @@ void JitDefineHelper(F &&f, const ColumnNames_t &cols, std::string_view name, RL
    delete customColumns;
 
    jittedCustomCol.SetCustomColumn(
-      std::make_unique<NewCol_t>(lm, name, std::move(f), cols, lm->GetNSlots(), newColumns));
+      std::make_unique<NewCol_t>(lm, name, std::forward<F>(f), cols, lm->GetNSlots(), newColumns));
 }
 
 /// Convenience function invoked by jitted code to build action nodes at runtime
@@ -493,6 +508,64 @@ ColumnNames_t FindUnknownColumns(const ColumnNames_t &requiredCols, const Column
 
 bool IsInternalColumn(std::string_view colName);
 
+/// A systematic variation declared with RInterface::Vary, as seen from a node of the computation graph.
+struct RVariation {
+   /// The name of the variation, in the form "variationName:tag"
+   std::string fName;
+   /// The last node of the varied branch of the graph. It is the nominal node until a Filter or Range is affected.
+   std::shared_ptr<RNodeBase> fNode;
+   /// Nominal column names mapped to the names of the hidden columns that hold their varied values
+   std::map<std::string, std::string> fColumns;
+};
+
+/// Return the name of the hidden column that holds the value of column `name` for the variation number `idx`
+std::string GetVariedColumnName(std::string_view name, std::size_t idx);
+
+/// Replace the columns that are affected by `variation` with their varied versions. Return whether any was replaced.
+bool SubstituteVariedColumns(ColumnNames_t &columns, const RVariation &variation);
+
+/// Return the jitted expression with the columns affected by `variation` replaced with their varied versions
+std::string SubstituteVariedColumns(std::string_view expression, const RVariation &variation,
+                                    const std::map<std::string, std::string> &aliasMap);
+
+/// Copy the callable of a Filter or Define to book it for a systematic variation
+template <typename F, typename std::enable_if<std::is_copy_constructible<F>::value, int>::type = 0>
+F CopyCallable(const F &f)
+{
+   return f;
+}
+
+template <typename F, typename std::enable_if<!std::is_copy_constructible<F>::value, int>::type = 0>
+F CopyCallable(const F &)
+{
+   throw std::runtime_error("Callables that are not copy-constructible cannot be used on columns with systematic "
+                            "variations.");
+}
+
+/// Copy the initial value of the result of an action to book the same action for a systematic variation.
+/// Return a null pointer if the result cannot be copied: such actions only produce the nominal result.
+template <typename T,
+          typename std::enable_if<std::is_copy_constructible<T>::value && !std::is_base_of<TH1, T>::value, int>::type = 0>
+std::shared_ptr<T> CloneResult(const T &r)
+{
+   return std::make_shared<T>(r);
+}
+
+template <typename T,
+          typename std::enable_if<std::is_copy_constructible<T>::value && std::is_base_of<TH1, T>::value, int>::type = 0>
+std::shared_ptr<T> CloneResult(const T &h)
+{
+   auto clone = std::make_shared<T>(h);
+   clone->SetDirectory(nullptr);
+   return clone;
+}
+
+template <typename T, typename std::enable_if<!std::is_copy_constructible<T>::value, int>::type = 0>
+std::shared_ptr<T> CloneResult(const T &)
+{
+   return nullptr;
+}
+
 /// Returns the list of Filters defined in the whole graph
 std::vector<std::string> GetFilterNames(const std::shared_ptr<RLoopManager> &loopManager);
 
@@ -13,9 +13,12 @@
 
 #include "ROOT/RIntegerSequence.hxx"
 #include "ROOT/RDF/RBookedCustomColumns.hxx"
+#include "ROOT/RDF/RCustomColumnBase.hxx"
 #include "ROOT/RVec.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 
+#include <array>
+
 /// \cond
 template <typename T>
 class TTreeReaderValue;
@@ -68,6 +71,19 @@ void InitRDFValues(unsigned int slot, RDFValueTuple &valueTuple, TTreeReader *r,
    (void)r;        // avoid "unused variable" warnings for r on gcc5.2
 }
 
+/// Initialize the custom columns among the input columns of a node for the given slot.
+/// Custom columns initialize their own input custom columns in turn, so that the custom columns that no node reads
+/// are never initialized, and none of the branches that only they read is accessed.
+template <std::size_t N>
+void InitCustomColumns(TTreeReader *r, unsigned int slot, const ColumnNames_t &columns,
+                       const RBookedCustomColumns &customCols, const std::array<bool, N> &isCustomColumn)
+{
+   for (auto i = 0u; i < N; ++i) {
+      if (isCustomColumn[i])
+         customCols.GetColumns().at(columns[i])->InitSlot(r, slot);
+   }
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
@@ -83,6 +83,18 @@ void InitRDFValues(unsigned int slot, std::vector<RTypeErasedColumnValue> &value
                   0};
 }
 
+/// This overload is specialized to act on RTypeErasedColumnValues instead of RColumnValues.
+template <std::size_t... S, typename... ColTypes>
+void SetProfilerRDFValues(const std::vector<RNodeProfiler *> &profilers, unsigned int slot,
+                          std::vector<RTypeErasedColumnValue> &values, std::index_sequence<S...>,
+                          ROOT::TypeTraits::TypeList<ColTypes...>)
+{
+   using expander = int[];
+   (void)slot; // avoid bogus 'unused parameter' warning
+   (void)expander{
+      (values[S].Cast<ColTypes>()->SetProfiler(profilers.empty() ? nullptr : profilers[S], slot), 0)..., 0};
+}
+
 /// This overload is specialized to act on RTypeErasedColumnValues instead of RColumnValues.
 template <std::size_t... S, typename... ColTypes>
 void ResetRDFValueTuple(std::vector<RTypeErasedColumnValue> &values, std::index_sequence<S...>,
@@ -132,12 +144,16 @@ public:
 
    Helper &GetHelper() { return fHelper; }
 
-   void Initialize() final { fHelper.Initialize(); }
+   void Initialize() final
+   {
+      fProfiler.Reset(GetNSlots());
+      fHelper.Initialize();
+   }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
-      for (auto &bookedBranch : GetCustomColumns().GetColumns())
-         bookedBranch.second->InitSlot(r, slot);
+      InitCustomColumns(r, slot, GetColumnNames(), GetCustomColumns(), fIsCustomColumn);
+      fProfiler.InitSlot(slot, fLoopManager->GetProfileSlot(slot));
       static_cast<Action_t *>(this)->InitColumnValues(r, slot);
       fHelper.InitTask(r, slot);
    }
@@ -145,8 +161,10 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       // check if entry passes all filters
-      if (fPrevData.CheckFilters(slot, entry))
+      if (fPrevData.CheckFilters(slot, entry)) {
+         RNodeProfiler::RScope scope(fProfiler, slot);
          static_cast<Action_t *>(this)->Exec(slot, entry, TypeInd_t());
+      }
    }
 
    void TriggerChildrenCount() final { fPrevData.IncrChildrenCount(); }
@@ -176,6 +194,7 @@ public:
       // Action nodes do not need to ask an helper to create the graph nodes. They are never common nodes between
       // multiple branches
       auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>(fHelper.GetActionName());
+      thisNode->SetProfileLabel(fProfiler.GetLabel());
       auto evaluatedNode = thisNode;
       for (auto &column : GetCustomColumns().GetColumns()) {
          /* Each column that this node has but the previous hadn't has been defined in between,
@@ -195,10 +214,18 @@ public:
       return thisNode;
    }
 
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    /// This method is invoked to update a partial result during the event loop, right before passing the result to a
    /// user-defined callback registered via RResultPtr::RegisterCallback
    void *PartialUpdate(unsigned int slot) final { return PartialUpdateImpl(slot); }
 
+   bool CanMergeResults() const final { return CanMergeResultsImpl(0); }
+
+   void SerializeResult(TBuffer &buf) final { SerializeResultImpl(buf, 0); }
+
+   void MergeResult(TBuffer &buf) final { MergeResultImpl(buf, 0); }
+
 private:
    // this overload is SFINAE'd out if Helper does not implement `PartialUpdate`
    // the template parameter is required to defer instantiation of the method to SFINAE time
@@ -210,6 +237,37 @@ private:
 
    // this one is always available but has lower precedence thanks to `...`
    void *PartialUpdateImpl(...) { throw std::runtime_error("This action does not support callbacks!"); }
+
+   // these overloads are SFINAE'd out if Helper does not implement `SerializeResult` and `MergeResult`
+   template <typename H = Helper>
+   auto CanMergeResultsImpl(int) const -> decltype(std::declval<H>().MergeResult(std::declval<TBuffer &>()), true)
+   {
+      return true;
+   }
+
+   bool CanMergeResultsImpl(...) const { return false; }
+
+   template <typename H = Helper>
+   auto SerializeResultImpl(TBuffer &buf, int) -> decltype(std::declval<H>().SerializeResult(buf), void())
+   {
+      fHelper.SerializeResult(buf);
+   }
+
+   void SerializeResultImpl(TBuffer &, ...)
+   {
+      throw std::runtime_error("This action does not support multi-process event loops!");
+   }
+
+   template <typename H = Helper>
+   auto MergeResultImpl(TBuffer &buf, int) -> decltype(std::declval<H>().MergeResult(buf), void())
+   {
+      fHelper.MergeResult(buf);
+   }
+
+   void MergeResultImpl(TBuffer &, ...)
+   {
+      throw std::runtime_error("This action does not support multi-process event loops!");
+   }
 };
 
 /// An action node in a RDF computation graph.
@@ -228,6 +286,9 @@ public:
    {
       InitRDFValues(slot, fValues[slot], r, RActionBase::GetColumnNames(), RActionBase::GetCustomColumns(),
                     typename ActionCRTP_t::TypeInd_t{}, ActionCRTP_t::fIsCustomColumn);
+      auto lm = RActionBase::GetLoopManager();
+      SetProfilerRDFValues(lm->GetColumnProfilers(RActionBase::GetColumnNames(), RActionBase::GetCustomColumns()), slot,
+                           fValues[slot], typename ActionCRTP_t::TypeInd_t{});
    }
 
    template <std::size_t... S>
@@ -279,6 +340,9 @@ public:
    {
       InitRDFValues(slot, fValues[slot], r, RActionBase::GetColumnNames(), RActionBase::GetCustomColumns(),
                     typename ActionCRTP_t::TypeInd_t{}, ColumnTypes_t{}, ActionCRTP_t::fIsCustomColumn);
+      auto lm = RActionBase::GetLoopManager();
+      SetProfilerRDFValues(lm->GetColumnProfilers(RActionBase::GetColumnNames(), RActionBase::GetCustomColumns()), slot,
+                           fValues[slot], typename ActionCRTP_t::TypeInd_t{}, ColumnTypes_t{});
    }
 
    template <std::size_t... S>
@@ -319,6 +383,9 @@ public:
    {
       InitRDFValues(slot, fValues[slot], r, RActionBase::GetColumnNames(), RActionBase::GetCustomColumns(),
                     typename ActionCRTP_t::TypeInd_t{}, ColumnTypes_t{}, ActionCRTP_t::fIsCustomColumn);
+      auto lm = RActionBase::GetLoopManager();
+      SetProfilerRDFValues(lm->GetColumnProfilers(RActionBase::GetColumnNames(), RActionBase::GetCustomColumns()), slot,
+                           fValues[slot], typename ActionCRTP_t::TypeInd_t{}, ColumnTypes_t{});
    }
 
    template <std::size_t... S>
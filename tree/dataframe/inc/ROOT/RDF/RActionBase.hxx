@@ -12,12 +12,15 @@
 #define ROOT_RACTIONBASE
 
 #include "ROOT/RDF/RBookedCustomColumns.hxx"
+#include "ROOT/RDF/RNodeProfiler.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
 
 #include <memory>
 #include <string>
 
+class TBuffer;
+
 namespace ROOT {
 
 namespace Detail {
@@ -46,6 +49,7 @@ protected:
    /// A raw pointer to the RLoopManager at the root of this functional graph.
    /// Never null: children nodes have shared ownership of parent nodes in the graph.
    RLoopManager *fLoopManager;
+   RNodeProfiler fProfiler; ///< Times the executions of the action in profiled event loops
 
 private:
    const unsigned int fNSlots; ///< Number of thread slots used by this node.
@@ -74,12 +78,22 @@ public:
    /// This method is invoked to update a partial result during the event loop, right before passing the result to a
    /// user-defined callback registered via RResultPtr::RegisterCallback
    virtual void *PartialUpdate(unsigned int slot) = 0;
+   /// Whether the results of this action can be computed by several processes and merged (see MergeResult)
+   virtual bool CanMergeResults() const = 0;
+   /// Invoked in a worker process of a multi-process event loop after Finalize: writes the partial result of the
+   /// process to the buffer that is sent to the parent process
+   virtual void SerializeResult(TBuffer &buf) = 0;
+   /// Invoked in the parent process of a multi-process event loop before Finalize: merges the partial result of a
+   /// worker process, as written by SerializeResult, into the result of this action
+   virtual void MergeResult(TBuffer &buf) = 0;
 
    // overridden by RJittedAction
    virtual bool HasRun() const { return fHasRun; }
    virtual void SetHasRun() { fHasRun = true; }
 
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> GetGraph() = 0;
+   virtual std::string GetActionName() = 0;
+   virtual const RNodeProfiler &GetProfiler() const { return fProfiler; }
 };
 
 } // ns RDF
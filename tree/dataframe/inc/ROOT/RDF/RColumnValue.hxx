@@ -12,6 +12,7 @@
 #define ROOT_RCOLUMNVALUE
 
 #include <ROOT/RDF/RCustomColumnBase.hxx>
+#include <ROOT/RDF/RNodeProfiler.hxx>
 #include <ROOT/RDF/Utils.hxx> // IsRVec_t, TypeID2TypeName
 #include <ROOT/RIntegerSequence.hxx>
 #include <ROOT/RMakeUnique.hxx>
@@ -57,6 +58,9 @@ TTree branch or from a temporary column respectively.
 
 RDataFrame nodes can store tuples of RColumnValues and retrieve an updated
 value for the column via the `Get` method.
+
+In profiled event loops, the reads of TTree branches are accounted to the profiler of
+the branch (see SetProfiler).
 **/
 template <typename T>
 class R__CLING_PTRCHECK(off) RColumnValue {
@@ -74,7 +78,8 @@ class R__CLING_PTRCHECK(off) RColumnValue {
    enum class EColumnKind { kTree, kCustomColumn, kDataSource, kInvalid };
    // Set to the correct value by MakeProxy or SetTmpColumn
    EColumnKind fColumnKind = EColumnKind::kInvalid;
-   /// The slot this value belongs to. Only needed when querying custom column values, it is set in `SetTmpColumn`.
+   /// The slot this value belongs to. Only needed when querying custom column values, it is set in `SetTmpColumn`,
+   /// or when profiling the reads of a TTree branch, in which case it is set in `SetProfiler`.
    unsigned int fSlot = std::numeric_limits<unsigned int>::max();
 
    // Each element of the following stacks will be in use by a _single task_.
@@ -98,6 +103,19 @@ class R__CLING_PTRCHECK(off) RColumnValue {
    /// If MustUseRVec, i.e. we are reading an array, we return a reference to this RVec to clients
    RVec<ColumnValue_t> fRVec;
    bool fCopyWarningPrinted = false;
+   /// The profiler of the TTree branch in a profiled event loop, nullptr otherwise
+   RNodeProfiler *fProfiler = nullptr;
+   /// The TTreeReader of the proxy of a TTree branch, needed to track the baskets read when profiling
+   TTreeReader *fReader = nullptr;
+
+   /// GetTreeValue, accounting the time spent and the bytes read to the profiler of the branch
+   T &GetProfiledTreeValue()
+   {
+      RNodeProfiler::RScope scope(*fProfiler, fSlot);
+      auto &value = GetTreeValue();
+      fProfiler->AddBytesRead(fSlot, *fReader, fTreeReader->GetBranchName());
+      return value;
+   }
 
 public:
    RColumnValue(){};
@@ -149,86 +167,97 @@ public:
    {
       fColumnKind = EColumnKind::kTree;
       fTreeReader = std::make_unique<TreeReader_t>(*r, bn.c_str());
+      fReader = r;
+   }
+
+   /// Account the reads of a TTree branch to the given profiler, or stop profiling them if profiler is nullptr.
+   /// Does nothing for temporary columns, which are profiled by their custom column node.
+   void SetProfiler(RNodeProfiler *profiler, unsigned int slot)
+   {
+      if (fColumnKind != EColumnKind::kTree)
+         return;
+      fProfiler = profiler;
+      fSlot = slot;
    }
 
-   /// This overload is used to return scalar quantities (i.e. types that are not read into a RVec)
    // This method is executed inside the event-loop, many times per entry
    // If need be, the if statement can be avoided using thunks
    // (have both branches inside functions and have a pointer to the branch to be executed)
-   template <typename U = T, typename std::enable_if<!RColumnValue<U>::MustUseRVec_t::value, int>::type = 0>
    T &Get(Long64_t entry)
    {
       if (fColumnKind == EColumnKind::kTree) {
-         return *(fTreeReader->Get());
+         return fProfiler ? GetProfiledTreeValue() : GetTreeValue();
       } else {
          fCustomColumn->Update(fSlot, entry);
          return fColumnKind == EColumnKind::kCustomColumn ? *fCustomValuePtr : **fDSValuePtr;
       }
    }
 
+private:
+   /// This overload is used to return scalar quantities (i.e. types that are not read into a RVec)
+   template <typename U = T, typename std::enable_if<!RColumnValue<U>::MustUseRVec_t::value, int>::type = 0>
+   T &GetTreeValue()
+   {
+      return *(fTreeReader->Get());
+   }
+
    /// This overload is used to return arrays (i.e. types that are read into a RVec).
    /// In this case the returned T is always a RVec<ColumnValue_t>.
    /// RVec<bool> is treated differently, in a separate overload.
    template <typename U = T,
              typename std::enable_if<RColumnValue<U>::MustUseRVec_t::value && !std::is_same<U, RVec<bool>>::value,
                                      int>::type = 0>
-   T &Get(Long64_t entry)
+   T &GetTreeValue()
    {
-      if (fColumnKind == EColumnKind::kTree) {
-         auto &readerArray = *fTreeReader;
-         // We only use TTreeReaderArrays to read columns that users flagged as type `RVec`, so we need to check
-         // that the branch stores the array as contiguous memory that we can actually wrap in an `RVec`.
-         // Currently we need the first entry to have been loaded to perform the check
-         // TODO Move check to `MakeProxy` once Axel implements this kind of check in TTreeReaderArray using
-         // TBranchProxy
-
-         if (EStorageType::kUnknown == fStorageType && readerArray.GetSize() > 1) {
-            // We can decide since the array is long enough
-            fStorageType =
-               (1 == (&readerArray[1] - &readerArray[0])) ? EStorageType::kContiguous : EStorageType::kSparse;
-         }
+      auto &readerArray = *fTreeReader;
+      // We only use TTreeReaderArrays to read columns that users flagged as type `RVec`, so we need to check
+      // that the branch stores the array as contiguous memory that we can actually wrap in an `RVec`.
+      // Currently we need the first entry to have been loaded to perform the check
+      // TODO Move check to `MakeProxy` once Axel implements this kind of check in TTreeReaderArray using
+      // TBranchProxy
+
+      if (EStorageType::kUnknown == fStorageType && readerArray.GetSize() > 1) {
+         // We can decide since the array is long enough
+         fStorageType =
+            (1 == (&readerArray[1] - &readerArray[0])) ? EStorageType::kContiguous : EStorageType::kSparse;
+      }
 
-         const auto readerArraySize = readerArray.GetSize();
-         if (EStorageType::kContiguous == fStorageType ||
-             (EStorageType::kUnknown == fStorageType && readerArray.GetSize() < 2)) {
-            if (readerArraySize > 0) {
-               // trigger loading of the contents of the TTreeReaderArray
-               // the address of the first element in the reader array is not necessarily equal to
-               // the address returned by the GetAddress method
-               auto readerArrayAddr = &readerArray.At(0);
-               T rvec(readerArrayAddr, readerArraySize);
-               std::swap(fRVec, rvec);
-            } else {
-               T emptyVec{};
-               std::swap(fRVec, emptyVec);
-            }
+      const auto readerArraySize = readerArray.GetSize();
+      if (EStorageType::kContiguous == fStorageType ||
+          (EStorageType::kUnknown == fStorageType && readerArray.GetSize() < 2)) {
+         if (readerArraySize > 0) {
+            // trigger loading of the contents of the TTreeReaderArray
+            // the address of the first element in the reader array is not necessarily equal to
+            // the address returned by the GetAddress method
+            auto readerArrayAddr = &readerArray.At(0);
+            T rvec(readerArrayAddr, readerArraySize);
+            std::swap(fRVec, rvec);
          } else {
-            // The storage is not contiguous or we don't know yet: we cannot but copy into the rvec
+            T emptyVec{};
+            std::swap(fRVec, emptyVec);
+         }
+      } else {
+         // The storage is not contiguous or we don't know yet: we cannot but copy into the rvec
 #ifndef NDEBUG
-            if (!fCopyWarningPrinted) {
-               Warning("RColumnValue::Get",
-                       "Branch %s hangs from a non-split branch. A copy is being performed in order "
-                       "to properly read the content.",
-                       readerArray.GetBranchName());
-               fCopyWarningPrinted = true;
-            }
+         if (!fCopyWarningPrinted) {
+            Warning("RColumnValue::Get",
+                    "Branch %s hangs from a non-split branch. A copy is being performed in order "
+                    "to properly read the content.",
+                    readerArray.GetBranchName());
+            fCopyWarningPrinted = true;
+         }
 #else
-            (void)fCopyWarningPrinted;
+         (void)fCopyWarningPrinted;
 #endif
-            if (readerArraySize > 0) {
-               T rvec(readerArray.begin(), readerArray.end());
-               std::swap(fRVec, rvec);
-            } else {
-               T emptyVec{};
-               std::swap(fRVec, emptyVec);
-            }
+         if (readerArraySize > 0) {
+            T rvec(readerArray.begin(), readerArray.end());
+            std::swap(fRVec, rvec);
+         } else {
+            T emptyVec{};
+            std::swap(fRVec, emptyVec);
          }
-         return fRVec;
-
-      } else {
-         fCustomColumn->Update(fSlot, entry);
-         return fColumnKind == EColumnKind::kCustomColumn ? *fCustomValuePtr : **fDSValuePtr;
       }
+      return fRVec;
    }
 
    /// This overload covers the RVec<bool> case. In this case we always copy the contents of TTreeReaderArray<bool>
@@ -239,27 +268,23 @@ public:
    template <typename U = T,
              typename std::enable_if<RColumnValue<U>::MustUseRVec_t::value && std::is_same<U, RVec<bool>>::value,
                                      int>::type = 0>
-   T &Get(Long64_t entry)
+   T &GetTreeValue()
    {
-      if (fColumnKind == EColumnKind::kTree) {
-         auto &readerArray = *fTreeReader;
-         const auto readerArraySize = readerArray.GetSize();
-         if (readerArraySize > 0) {
-            // always perform a copy
-            T rvec(readerArray.begin(), readerArray.end());
-            std::swap(fRVec, rvec);
-         } else {
-            T emptyVec{};
-            std::swap(fRVec, emptyVec);
-         }
-         return fRVec;
+      auto &readerArray = *fTreeReader;
+      const auto readerArraySize = readerArray.GetSize();
+      if (readerArraySize > 0) {
+         // always perform a copy
+         T rvec(readerArray.begin(), readerArray.end());
+         std::swap(fRVec, rvec);
       } else {
-         // business as usual
-         fCustomColumn->Update(fSlot, entry);
-         return fColumnKind == EColumnKind::kCustomColumn ? *fCustomValuePtr : **fDSValuePtr;
+         T emptyVec{};
+         std::swap(fRVec, emptyVec);
       }
+      return fRVec;
    }
 
+public:
+
    void Reset()
    {
       // This method should by all means not be removed, together with all
@@ -272,7 +297,9 @@ public:
       // See https://github.com/root-project/root/commit/26e8ace6e47de6794ac9ec770c3bbff9b7f2e945
       if (EColumnKind::kTree == fColumnKind) {
          fTreeReader.reset();
+         fReader = nullptr;
       }
+      fProfiler = nullptr;
    }
 };
 
@@ -319,6 +346,18 @@ void ResetRDFValueTuple(ValueTuple &values, std::index_sequence<S...>)
    (void)expander; // avoid "unused variable" warnings
 }
 
+/// Account the reads of the TTree branches among a tuple of RColumnValues to the given profilers, one per column
+/// (nullptr for custom columns), or stop profiling them if profilers is empty. Must be called after InitRDFValues.
+template <typename ValueTuple, std::size_t... S>
+void SetProfilerRDFValues(const std::vector<RNodeProfiler *> &profilers, unsigned int slot, ValueTuple &values,
+                          std::index_sequence<S...>)
+{
+   std::initializer_list<int> expander{
+      (std::get<S>(values).SetProfiler(profilers.empty() ? nullptr : profilers[S], slot), 0)...};
+   (void)expander; // avoid "unused variable" warnings
+   (void)slot;     // avoid bogus "unused parameter" warnings for nodes without input columns
+   (void)profilers;
+}
 
 } // ns RDF
 } // ns Internal
@@ -21,7 +21,9 @@
 #include "RtypesCore.h"
 
 #include <deque>
+#include <string>
 #include <type_traits>
+#include <typeinfo>
 #include <vector>
 
 class TTreeReader;
@@ -111,18 +113,33 @@ public:
 
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
+      if (fEquivalentColumn) {
+         fEquivalentColumn->InitSlot(r, slot);
+         return;
+      }
       if (!fIsInitialized[slot]) {
          fIsInitialized[slot] = true;
+         RDFInternal::InitCustomColumns(r, slot, fColumnNames, fCustomColumns, fIsCustomColumn);
          RDFInternal::InitRDFValues(slot, fValues[slot], r, fColumnNames, fCustomColumns, TypeInd_t(), fIsCustomColumn);
+         InitProfiler(slot);
+         RDFInternal::SetProfilerRDFValues(GetColumnProfilers(fColumnNames), slot, fValues[slot], TypeInd_t());
       }
    }
 
-   void *GetValuePtr(unsigned int slot) final { return static_cast<void *>(&fLastResults[slot]); }
+   void *GetValuePtr(unsigned int slot) final
+   {
+      if (fEquivalentColumn)
+         return fEquivalentColumn->GetValuePtr(slot);
+      return static_cast<void *>(&fLastResults[slot]);
+   }
 
    void Update(unsigned int slot, Long64_t entry) final
    {
-      if (entry != fLastCheckedEntry[slot]) {
+      if (fEquivalentColumn) {
+         fEquivalentColumn->Update(slot, entry);
+      } else if (entry != fLastCheckedEntry[slot]) {
          // evaluate this filter, cache the result
+         RDFInternal::RNodeProfiler::RScope scope(fProfiler, slot);
          UpdateHelper(slot, entry, TypeInd_t(), ColumnTypes_t(), ExtraArgsTag{});
          fLastCheckedEntry[slot] = entry;
       }
@@ -133,8 +150,30 @@ public:
       return fIsDataSourceColumn ? typeid(typename std::remove_pointer<ret_type>::type) : typeid(ret_type);
    }
 
+   std::string GetSignature(const RDFInternal::NodeId_t &nodeId) const final
+   {
+      // the type of a callable only identifies the function it computes if the callable is stateless
+      if (!std::is_empty<F>::value || fIsDataSourceColumn)
+         return "";
+      return std::string(typeid(F).name()) + typeid(ExtraArgsTag).name() + '|' +
+             RDFInternal::GetColumnsSignature(fColumnNames, fCustomColumns, nodeId);
+   }
+
+   std::string GetCacheKey() const final
+   {
+      const auto retType = RDFInternal::GetTypeCacheKey(typeid(ret_type));
+      if (fIsDataSourceColumn)
+         return "define:" + fName + "|datasource|" + retType + '\n';
+      return "define:" + fName + '|' + typeid(F).name() + typeid(ExtraArgsTag).name() + '|' + retType + '|' +
+             RDFInternal::GetColumnsCacheKey(fColumnNames, RDFInternal::GetTypeCacheKeys(ColumnTypes_t())) + '\n';
+   }
+
    void ClearValueReaders(unsigned int slot) final
    {
+      if (fEquivalentColumn) {
+         fEquivalentColumn->ClearValueReaders(slot);
+         return;
+      }
       if (fIsInitialized[slot]) {
          RDFInternal::ResetRDFValueTuple(fValues[slot], TypeInd_t());
          fIsInitialized[slot] = false;
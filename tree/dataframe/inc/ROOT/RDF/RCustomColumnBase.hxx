@@ -13,6 +13,8 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RBookedCustomColumns.hxx"
+#include "ROOT/RDF/RNodeProfiler.hxx"
+#include "ROOT/RDF/Utils.hxx" // NodeId_t
 
 #include <memory>
 #include <string>
@@ -43,8 +45,17 @@ protected:
    const unsigned int fID = GetNextID();
    RDFInternal::RBookedCustomColumns fCustomColumns;
    std::deque<bool> fIsInitialized; // because vector<bool> is not thread-safe
+   /// An equivalent custom column whose values this column reuses instead of evaluating its own expression, if any.
+   /// Only set during an event loop with graph optimization, see RLoopManager::OptimizeGraph.
+   RCustomColumnBase *fEquivalentColumn = nullptr;
+   RDFInternal::RNodeProfiler fProfiler; ///< Times the evaluations of the expression in profiled event loops
 
    static unsigned int GetNextID();
+   /// Start profiling the slot if the event loop is profiled. Only valid during the event loop.
+   void InitProfiler(unsigned int slot);
+   /// The profilers of the readers of the TTree branches among the given input columns if the event loop is profiled,
+   /// an empty vector otherwise. Only valid during the event loop.
+   std::vector<RDFInternal::RNodeProfiler *> GetColumnProfilers(const ColumnNames_t &columns) const;
 
 public:
    RCustomColumnBase(RLoopManager *lm, std::string_view name, const unsigned int nSlots, const bool isDSColumn,
@@ -61,6 +72,13 @@ public:
    virtual void ClearValueReaders(unsigned int slot) = 0;
    bool IsDataSourceColumn() const { return fIsDataSourceColumn; }
    virtual void InitNode();
+   /// A string that is equal for custom columns that hold the same values: same stateless callable and equivalent
+   /// input columns. Empty if this column cannot be deduplicated.
+   virtual std::string GetSignature(const RDFInternal::NodeId_t &nodeId) const = 0;
+   /// Describe the expression and the input columns of this custom column, as used by persistent caches.
+   virtual std::string GetCacheKey() const = 0;
+   virtual void SetEquivalentColumn(RCustomColumnBase *column) { fEquivalentColumn = column; }
+   virtual const RDFInternal::RNodeProfiler &GetProfiler() const { return fProfiler; }
    /// Return the unique identifier of this RCustomColumnBase.
    unsigned int GetID() const { return fID; }
 };
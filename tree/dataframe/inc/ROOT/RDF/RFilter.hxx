@@ -24,6 +24,8 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
 #include <vector>
 
 namespace ROOT {
@@ -88,8 +90,9 @@ public:
             // a filter upstream returned false, cache the result
             fLastResult[slot] = false;
          } else {
-            // evaluate this filter, cache the result
-            auto passed = CheckFilterHelper(slot, entry, TypeInd_t());
+            // evaluate this filter (or the equivalent one), cache the result
+            auto passed = fEquivalentFilter ? fEquivalentFilter->CheckFilters(slot, entry)
+                                            : CheckFilterHelper(slot, entry, TypeInd_t());
             passed ? ++fAccepted[slot] : ++fRejected[slot];
             fLastResult[slot] = passed;
          }
@@ -104,14 +107,35 @@ public:
       // silence "unused parameter" warnings in gcc
       (void)slot;
       (void)entry;
+      RDFInternal::RNodeProfiler::RScope scope(fProfiler, slot);
       return fFilter(std::get<S>(fValues[slot]).Get(entry)...);
    }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
-      for (auto &bookedBranch : fCustomColumns.GetColumns())
-         bookedBranch.second->InitSlot(r, slot);
+      if (fEquivalentFilter)
+         return; // the expression of this filter is never evaluated
+      RDFInternal::InitCustomColumns(r, slot, fColumnNames, fCustomColumns, fIsCustomColumn);
       RDFInternal::InitRDFValues(slot, fValues[slot], r, fColumnNames, fCustomColumns, TypeInd_t(), fIsCustomColumn);
+      fProfiler.InitSlot(slot, fLoopManager->GetProfileSlot(slot));
+      RDFInternal::SetProfilerRDFValues(fLoopManager->GetColumnProfilers(fColumnNames, fCustomColumns), slot,
+                                        fValues[slot], TypeInd_t());
+   }
+
+   std::string GetSignature(const RDFInternal::NodeId_t &nodeId) const final
+   {
+      // the type of a callable only identifies the function it computes if the callable is stateless.
+      // Named filters are never deduplicated, as they keep their own counts for Report.
+      if (!std::is_empty<FilterF>::value || HasName())
+         return "";
+      return std::string(typeid(FilterF).name()) + '|' + nodeId(static_cast<RNodeBase *>(fPrevDataPtr.get())) + '|' +
+             RDFInternal::GetColumnsSignature(fColumnNames, fCustomColumns, nodeId);
+   }
+
+   std::string GetCacheKey() const final
+   {
+      return fPrevData.GetCacheKey() + "filter:" + fName + '|' + typeid(FilterF).name() + '|' +
+             RDFInternal::GetColumnsCacheKey(fColumnNames, RDFInternal::GetTypeCacheKeys(ColumnTypes_t())) + '\n';
    }
 
    // recursive chain of `Report`s
@@ -13,6 +13,8 @@
 
 #include "ROOT/RDF/RBookedCustomColumns.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RNodeProfiler.hxx"
+#include "ROOT/RDF/Utils.hxx" // NodeId_t
 #include "RtypesCore.h"
 #include "TError.h" // R_ASSERT
 
@@ -41,6 +43,10 @@ protected:
    std::vector<ULong64_t> fRejected = {0};
    const std::string fName;
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
+   /// An equivalent filter whose results this filter reuses instead of evaluating its own expression, if any.
+   /// Only set during an event loop with graph optimization, see RLoopManager::OptimizeGraph.
+   RFilterBase *fEquivalentFilter = nullptr;
+   RDFInternal::RNodeProfiler fProfiler; ///< Times the evaluations of the filter expression in profiled event loops
 
    RDFInternal::RBookedCustomColumns fCustomColumns;
 
@@ -67,6 +73,11 @@ public:
    virtual void ClearTask(unsigned int slot) = 0;
    virtual void InitNode();
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
+   /// A string that is equal for filters that select the same entries: same stateless callable, equivalent previous
+   /// node and equivalent input columns. Empty if this filter cannot be deduplicated.
+   virtual std::string GetSignature(const RDFInternal::NodeId_t &nodeId) const = 0;
+   virtual void SetEquivalentFilter(RFilterBase *filter) { fEquivalentFilter = filter; }
+   virtual const RDFInternal::RNodeProfiler &GetProfiler() const { return fProfiler; }
 };
 
 } // ns RDF
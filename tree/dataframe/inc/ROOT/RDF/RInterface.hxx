@@ -16,10 +16,13 @@
 #include "ROOT/RDF/RBookedCustomColumns.hxx"
 #include "ROOT/RDF/HistoModels.hxx"
 #include "ROOT/RDF/InterfaceUtils.hxx"
+#include "ROOT/RDF/RProfileReport.hxx"
 #include "ROOT/RDF/RRange.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RIntegerSequence.hxx"
 #include "ROOT/RDF/RLazyDSImpl.hxx"
+#include "ROOT/RCacheOptions.hxx"
+#include "ROOT/RResultMap.hxx"
 #include "ROOT/RResultPtr.hxx"
 #include "ROOT/RSnapshotOptions.hxx"
 #include "ROOT/RStringView.hxx"
@@ -107,6 +110,9 @@ class RInterface {
    /// Contains the custom columns defined up to this node.
    RDFInternal::RBookedCustomColumns fCustomColumns;
 
+   /// The systematic variations registered with Vary up to this node. Null if there are none.
+   std::shared_ptr<const std::vector<RDFInternal::RVariation>> fVariations;
+
 public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Copy-assignment operator for RInterface.
@@ -149,8 +155,10 @@ public:
    /// Note that it is not a problem to pass RNode's by value.
    operator RNode() const
    {
-      return RNode(std::static_pointer_cast<::ROOT::Detail::RDF::RNodeBase>(fProxiedPtr), *fLoopManager, fCustomColumns,
-                   fDataSource);
+      RNode node(std::static_pointer_cast<::ROOT::Detail::RDF::RNodeBase>(fProxiedPtr), *fLoopManager, fCustomColumns,
+                 fDataSource);
+      node.fVariations = fVariations;
+      return node;
    }
 
    ////////////////////////////////////////////////////////////////////////////
@@ -195,9 +203,21 @@ public:
 
       using F_t = RDFDetail::RFilter<F, Proxied>;
 
+      // the varied branches of the graph get their own copy of the filter, see Vary
+      auto variations = CopyVariations();
+      if (variations) {
+         for (auto &v : *variations) {
+            auto variedColumns = validColumnNames;
+            if (RDFInternal::SubstituteVariedColumns(variedColumns, v) || IsVariedBranch(v))
+               v.fNode = GetVariedBranch(v).Filter(RDFInternal::CopyCallable(f), variedColumns).fProxiedPtr;
+         }
+      }
+
       auto filterPtr = std::make_shared<F_t>(std::move(f), validColumnNames, fProxiedPtr, newColumns, name);
       fLoopManager->Book(filterPtr.get());
-      return RInterface<F_t, DS_t>(std::move(filterPtr), *fLoopManager, newColumns, fDataSource);
+      RInterface<F_t, DS_t> newInterface(std::move(filterPtr), *fLoopManager, newColumns, fDataSource);
+      newInterface.fVariations = FollowNominalBranch(std::move(variations), newInterface.fProxiedPtr);
+      return newInterface;
    }
 
    ////////////////////////////////////////////////////////////////////////////
@@ -247,6 +267,16 @@ public:
    /// ~~~
    RInterface<RDFDetail::RJittedFilter, DS_t> Filter(std::string_view expression, std::string_view name = "")
    {
+      auto variations = CopyVariations();
+      if (variations) {
+         for (auto &v : *variations) {
+            const auto variedExpression =
+               RDFInternal::SubstituteVariedColumns(expression, v, fLoopManager->GetAliasMap());
+            if (variedExpression != std::string(expression) || IsVariedBranch(v))
+               v.fNode = GetVariedBranch(v).Filter(variedExpression).fProxiedPtr;
+         }
+      }
+
       // deleted by the jitted call to JitFilterHelper
       auto upcastNodeOnHeap = RDFInternal::MakeSharedOnHeap(RDFInternal::UpcastNode(fProxiedPtr));
       using BaseNodeType_t = typename std::remove_pointer<decltype(upcastNodeOnHeap)>::type::element_type;
@@ -258,8 +288,10 @@ public:
                                  fLoopManager->GetID());
 
       fLoopManager->Book(jittedFilter.get());
-      return RInterface<RDFDetail::RJittedFilter, DS_t>(std::move(jittedFilter), *fLoopManager, fCustomColumns,
-                                                        fDataSource);
+      RInterface<RDFDetail::RJittedFilter, DS_t> newInterface(std::move(jittedFilter), *fLoopManager, fCustomColumns,
+                                                              fDataSource);
+      newInterface.fVariations = FollowNominalBranch(std::move(variations), newInterface.fProxiedPtr);
+      return newInterface;
    }
 
    // clang-format off
@@ -375,6 +407,26 @@ public:
                                      fLoopManager->GetAliasMap(),
                                      fDataSource ? fDataSource->GetColumnNames() : ColumnNames_t{});
 
+      if (fVariations) {
+         // define the varied versions of the column first, for the variations that affect its inputs (see Vary)
+         auto base = *this;
+         base.fVariations = nullptr;
+         auto variations = CopyVariations();
+         for (std::size_t i = 0; i < variations->size(); ++i) {
+            auto &v = (*variations)[i];
+            const auto variedExpression =
+               RDFInternal::SubstituteVariedColumns(expression, v, fLoopManager->GetAliasMap());
+            if (variedExpression == std::string(expression))
+               continue;
+            const auto variedName = RDFInternal::GetVariedColumnName(name, i);
+            base = base.Define(variedName, variedExpression);
+            v.fColumns[std::string(name)] = variedName;
+         }
+         auto newInterface = base.Define(name, expression);
+         newInterface.fVariations = std::move(variations);
+         return newInterface;
+      }
+
       auto jittedCustomColumn =
          std::make_shared<RDFDetail::RJittedCustomColumn>(fLoopManager, name, fLoopManager->GetNSlots());
 
@@ -392,6 +444,91 @@ public:
       return newInterface;
    }
 
+   // clang-format off
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for a column
+   /// \param[in] colName The name of the column to vary.
+   /// \param[in] expression Function, lambda expression, functor class or any other callable object producing the varied values of the column. It must return a RVec (or any other indexable collection) with one element per variation tag.
+   /// \param[in] inputColumns Names of the columns/branches in input to the expression.
+   /// \param[in] variationTags Names of the variations, e.g. `{"down", "up"}`.
+   /// \param[in] variationName Name of the systematic variation. It defaults to the name of the column.
+   /// \return the first node of the computation graph for which the variations are registered.
+   ///
+   /// The Defines, Filters and actions booked downstream of this node that depend on `colName`, directly or through
+   /// other Define'd columns, are also computed with each of its varied values, in the same event loop as the nominal
+   /// ones. The varied results of an action are retrieved with ROOT::RDF::Experimental::VariationsFor, with keys
+   /// `"variationName:tag"`.
+   ///
+   /// Only the nodes that are affected by a variation are duplicated: Defines that do not depend on varied columns are
+   /// evaluated once per entry for all variations, and actions downstream of Filters that do not depend on varied
+   /// columns share their selection with the nominal results. Varied Filters are unnamed, so that Report only shows
+   /// the nominal selection. Foreach, Book, Snapshot and Cache only process the nominal values.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto scale = [](double pt) { return ROOT::RVec<double>{0.9 * pt, 1.1 * pt}; };
+   /// auto df = d.Vary("pt", scale, {"pt"}, {"down", "up"}, "ptScale");
+   /// auto h = df.Filter([](double pt) { return pt > 10.; }, {"pt"}).Histo1D<double>("pt");
+   /// auto hs = ROOT::RDF::Experimental::VariationsFor(h);
+   /// hs["ptScale:up"].Draw(); // runs the event loop, which fills the nominal and the varied histograms
+   /// ~~~
+   // clang-format on
+   template <typename F, typename std::enable_if<!std::is_convertible<F, std::string>::value, int>::type = 0>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F expression, const ColumnNames_t &inputColumns,
+                                  const std::vector<std::string> &variationTags, std::string_view variationName = "")
+   {
+      using RetType_t = typename TTraits::CallableTraits<F>::ret_type;
+      const auto validColName = CheckVary(colName, variationTags, variationName);
+
+      const auto firstIdx = fVariations ? fVariations->size() : 0u;
+      const auto allValuesName = "rdfvariations" + std::to_string(firstIdx) + "_";
+      auto base = *this;
+      base.fVariations = nullptr;
+      base = base.Define(allValuesName, std::move(expression), inputColumns);
+      const auto nTags = variationTags.size();
+      for (std::size_t i = 0; i < nTags; ++i) {
+         auto getValue = [i, nTags](const RetType_t &values) {
+            if (values.size() != nTags)
+               throw std::runtime_error("Vary: the expression must return one value per variation tag.");
+            return values[i];
+         };
+         base = base.Define("rdfvariation" + std::to_string(firstIdx + i) + "_", getValue, {allValuesName});
+      }
+      return AddVariations(std::move(base), colName, validColName, variationTags, variationName);
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for a column
+   /// \param[in] colName The name of the column to vary.
+   /// \param[in] expression An expression in C++ which represents the varied values of the column, with one element per variation tag.
+   /// \param[in] variationTags Names of the variations, e.g. `{"down", "up"}`.
+   /// \param[in] variationName Name of the systematic variation. It defaults to the name of the column.
+   /// \return the first node of the computation graph for which the variations are registered.
+   ///
+   /// The expression is just-in-time compiled, as in Define.
+   /// Refer to the first overload of this method for the full documentation.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto df = d.Vary("pt", "ROOT::RVec<double>{0.9 * pt, 1.1 * pt}", {"down", "up"}, "ptScale");
+   /// ~~~
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, std::string_view expression,
+                                  const std::vector<std::string> &variationTags, std::string_view variationName = "")
+   {
+      const auto validColName = CheckVary(colName, variationTags, variationName);
+
+      const auto firstIdx = fVariations ? fVariations->size() : 0u;
+      const auto allValuesName = "rdfvariations" + std::to_string(firstIdx) + "_";
+      auto base = *this;
+      base.fVariations = nullptr;
+      base = base.Define(allValuesName, expression);
+      for (std::size_t i = 0; i < variationTags.size(); ++i) {
+         base = base.Define("rdfvariation" + std::to_string(firstIdx + i) + "_",
+                            allValuesName + ".at(" + std::to_string(i) + ")");
+      }
+      return AddVariations(std::move(base), colName, validColName, variationTags, variationName);
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Allow to refer to a column with a different name
    /// \param[in] alias name of the column alias
@@ -425,6 +562,7 @@ public:
 
       newCols.AddName(alias);
       RInterface<Proxied, DS_t> newInterface(fProxiedPtr, *fLoopManager, std::move(newCols), fDataSource);
+      newInterface.fVariations = fVariations;
 
       return newInterface;
    }
@@ -689,6 +827,80 @@ public:
       return Cache(selectedColumns);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns on disk, reusing previously saved ones
+   /// \tparam ColumnTypes variadic list of branch/column types.
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] options RCacheOptions struct with the directory of the cache files and extra options.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// If `options.fDirectory` is empty, this is equivalent to the in-memory Cache. Otherwise, the selected columns
+   /// are written to a file in that directory, as for Snapshot, and the returned `RDataFrame` reads them from there.
+   /// The name of the file is a hash of the Filters, Defines and Ranges that lead to this node (names, jitted
+   /// expressions, input columns and their types, Range bounds and strides), of the aliases, of the cached columns and
+   /// their types, and of the input dataset (tree and file names, size and modification time of local files).
+   /// If a file with that name already exists, for instance because the same analysis ran before, no event loop is
+   /// run and the cached columns are read from the existing file.
+   ///
+   /// The code of the functions passed to Filter and Define cannot be inspected: only the types of the callables enter
+   /// the hash. Change `options.fTag` whenever the code changes in a way that invalidates the cached data, or remove
+   /// the files in the cache directory.
+   ///
+   /// The input of a data source, as well as a TTree that is not read from a file, cannot be identified across runs:
+   /// in these cases a `std::runtime_error` is thrown. Use the in-memory Cache instead.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// RCacheOptions opts("/scratch/rdfcache", "v2");
+   /// auto cached_df = df.Filter(expensiveCut, {"x", "y"}, "preselection").Cache<double, float>({"x", "y"}, opts);
+   /// ~~~
+   template <typename... ColumnTypes>
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, const RCacheOptions &options)
+   {
+      if (options.fDirectory.empty())
+         return Cache<ColumnTypes...>(columnList);
+
+      const std::vector<std::string> columnTypes{RDFInternal::TypeID2TypeName(typeid(ColumnTypes))...};
+      auto snapshot = [this, &columnList](const std::string &treeName, const std::string &fileName,
+                                          const RSnapshotOptions &snapshotOptions) {
+         Snapshot<ColumnTypes...>(treeName, fileName, columnList, snapshotOptions);
+      };
+      return PersistentCacheImpl(columnList, columnTypes, options, snapshot);
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns on disk, reusing previously saved ones
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] options RCacheOptions struct with the directory of the cache files and extra options.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// The types of the columns are inferred (this invocation relies on jitting). See the previous overload for more
+   /// information.
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, const RCacheOptions &options)
+   {
+      if (options.fDirectory.empty())
+         return Cache(columnList);
+
+      auto snapshot = [this, &columnList](const std::string &treeName, const std::string &fileName,
+                                          const RSnapshotOptions &snapshotOptions) {
+         Snapshot(treeName, fileName, columnList, snapshotOptions);
+      };
+      return PersistentCacheImpl(columnList, {}, options, snapshot);
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns on disk, reusing previously saved ones
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] options RCacheOptions struct with the directory of the cache files and extra options.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// See the previous overloads for more information.
+   RInterface<RLoopManager> Cache(std::initializer_list<std::string> columnList, const RCacheOptions &options)
+   {
+      ColumnNames_t selectedColumns(columnList);
+      return Cache(selectedColumns, options);
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates a node that filters entries based on range: [begin, end)
@@ -698,7 +910,11 @@ public:
    /// \return the first node of the computation graph for which the event loop is limited to a certain range of entries.
    ///
    /// Note that in case of previous Ranges and Filters the selected range refers to the transformed dataset.
-   /// Ranges are only available if EnableImplicitMT has _not_ been called. Multi-thread ranges are not supported.
+   /// In multi-thread event loops, ranges select entries by their global entry number in the dataset, and clusters
+   /// (or data source entry ranges) that lie entirely outside of the ranges booked on the RDataFrame are not read.
+   /// Because the entries that pass a Filter are only known once all threads are done, multi-thread ranges can only
+   /// be applied to the RDataFrame itself or to other Ranges, not after Filters. Ranges of TTrees with an entry list
+   /// are not supported in multi-thread event loops.
    ///
    /// ### Example usage:
    /// ~~~{.cpp}
@@ -712,12 +928,27 @@ public:
       // check invariants
       if (stride == 0 || (end != 0 && end < begin))
          throw std::runtime_error("Range: stride must be strictly greater than 0 and end must be greater than begin.");
-      CheckIMTDisabled("Range");
+      if (fLoopManager->IsMultiThreaded()) {
+         auto prevNode = static_cast<RDFDetail::RNodeBase *>(fProxiedPtr.get());
+         if (prevNode != fLoopManager && !dynamic_cast<RDFDetail::RRangeBase *>(prevNode))
+            throw std::runtime_error("Range: in multi-thread event loops, ranges can only be applied to the full "
+                                     "dataset or to other ranges, not after Filters.");
+      }
+
+      // ranges count the entries that pass the upstream filters, so varied branches of the graph need their own
+      auto variations = CopyVariations();
+      if (variations) {
+         for (auto &v : *variations) {
+            if (IsVariedBranch(v))
+               v.fNode = GetVariedBranch(v).Range(begin, end, stride).fProxiedPtr;
+         }
+      }
 
       using Range_t = RDFDetail::RRange<Proxied>;
       auto rangePtr = std::make_shared<Range_t>(begin, end, stride, fProxiedPtr);
       fLoopManager->Book(rangePtr.get());
       RInterface<RDFDetail::RRange<Proxied>> tdf_r(std::move(rangePtr), *fLoopManager, fCustomColumns, fDataSource);
+      tdf_r.fVariations = FollowNominalBranch(std::move(variations), tdf_r.fProxiedPtr);
       return tdf_r;
    }
 
@@ -876,10 +1107,13 @@ public:
       auto cSPtr = std::make_shared<ULong64_t>(0);
       using Helper_t = RDFInternal::CountHelper;
       using Action_t = RDFInternal::RAction<Helper_t, Proxied>;
-      auto action =
-         std::make_unique<Action_t>(Helper_t(cSPtr, nSlots), ColumnNames_t({}), fProxiedPtr, std::move(fCustomColumns));
+      auto action = std::make_unique<Action_t>(Helper_t(cSPtr, nSlots), ColumnNames_t({}), fProxiedPtr,
+                                               RDFInternal::RBookedCustomColumns(fCustomColumns));
       fLoopManager->Book(action.get());
-      return MakeResultPtr(cSPtr, *fLoopManager, std::move(action));
+      auto resPtr = MakeResultPtr(cSPtr, *fLoopManager, std::move(action));
+      resPtr.fVariedResults =
+         BookVariedActions<ULong64_t>({}, [](RNode &branch, const ColumnNames_t &) { return branch.Count(); });
+      return resPtr;
    }
 
    ////////////////////////////////////////////////////////////////////////////
@@ -919,7 +1153,12 @@ public:
       auto action =
          std::make_unique<Action_t>(Helper_t(valuesPtr, nSlots), validColumnNames, fProxiedPtr, std::move(newColumns));
       fLoopManager->Book(action.get());
-      return MakeResultPtr(valuesPtr, *fLoopManager, std::move(action));
+      auto resPtr = MakeResultPtr(valuesPtr, *fLoopManager, std::move(action));
+      resPtr.fVariedResults =
+         BookVariedActions<COLL>(validColumnNames, [](RNode &branch, const ColumnNames_t &variedColumns) {
+            return branch.template Take<T, COLL>(variedColumns[0]);
+         });
+      return resPtr;
    }
 
    ////////////////////////////////////////////////////////////////////////////
@@ -1989,6 +2228,95 @@ public:
    /// ~~~
    unsigned int GetNSlots() const { return fLoopManager->GetNSlots(); }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Run the event loops in several worker processes
+   /// \param[in] nProcesses The number of worker processes. 0 or 1 run the event loop in this process.
+   ///
+   /// The setting applies to the entire computation graph this node belongs to, and to all the following event
+   /// loops. The entries of the dataset are split in as many contiguous ranges as worker processes; for TTrees and
+   /// TChains, the boundaries of the ranges are cluster boundaries. The workers are forked from this process when the
+   /// event loop starts: each of them runs the computation graph sequentially on its range of entries and sends the
+   /// results of the actions back, where they are merged as the results of the different threads of a
+   /// multi-thread event loop would be. Processes do not share an allocator nor an interpreter, which makes this mode
+   /// attractive for machines with many cores when multi-thread event loops are limited by lock contention.
+   ///
+   /// Only the actions whose results can be merged across processes can be booked: Count, Sum, Min, Max, Mean, Fill,
+   /// the histogram and profile actions and Take. The event loop throws if other actions, Range or callbacks are
+   /// booked, if the dataset is read through a RDataSource or has friend trees, or if implicit multi-threading is
+   /// enabled, as forking a multi-threaded process is unsafe. Each worker opens the input files anew. The side effects
+   /// of the functions passed to Filter and Define are only visible in the worker processes. Multi-process event loops
+   /// are not available on Windows.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("tree", "file.root");
+   /// df.SetNProcesses(8);
+   /// auto h = df.Filter("pt > 10").Histo1D({"h", "h", 100, 0, 100}, "pt");
+   /// ~~~
+   void SetNProcesses(unsigned int nProcesses) { fLoopManager->SetNProcesses(nProcesses); }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Deduplicate equivalent Defines and Filters before each event loop
+   /// \param[in] optimize Whether the computation graph should be optimized. Graphs are not optimized by default.
+   ///
+   /// The setting applies to the entire computation graph this node belongs to, and to all the following event
+   /// loops. Right before each event loop, Defines that apply the same stateless callable (e.g. the same string
+   /// expression or a lambda without captures) to the same input columns are found, and only the first of them is
+   /// evaluated: the others read its values. The same holds for unnamed Filters with the same callable, input columns
+   /// and previous node, so that a chain of Filters booked again on another branch of the graph is only evaluated once
+   /// per entry. Named Filters keep their own counts for Report and are never deduplicated.
+   ///
+   /// The optimization assumes that expressions only depend on their input columns: expressions that draw random
+   /// numbers or otherwise depend on external state must not be deduplicated, hence the opt-in.
+   ///
+   /// Independently of this setting, the Defines that no Filter, Define or action of the event loop reads are never
+   /// evaluated nor initialized.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("tree", "file.root");
+   /// df.SetGraphOptimization(true);
+   /// auto sel = df.Define("ptGeV", "pt / 1000.");
+   /// auto h1 = sel.Filter("ptGeV > 20").Histo1D("eta");
+   /// auto h2 = sel.Filter("ptGeV > 20").Histo1D("phi"); // the second Filter reuses the results of the first
+   /// ~~~
+   void SetGraphOptimization(bool optimize) { fLoopManager->SetGraphOptimization(optimize); }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Profile the nodes of the computation graph during the following event loops
+   /// \param[in] profile Whether the event loops should be profiled. Event loops are not profiled by default.
+   ///
+   /// The setting applies to the entire computation graph this node belongs to. During a profiled event loop, each
+   /// Define, Filter and action records the wall-clock time spent evaluating it and the number of evaluations, summed
+   /// over all processing slots; so does the reader of each TTree branch or data-source column, which also records the
+   /// compressed bytes of the baskets it read. The time of a node excludes the time spent in the nodes it evaluates in
+   /// turn: the time of a Filter does not include the time to read its input branches or to compute its input
+   /// Defines. Times are wall-clock times, measured with a steady clock in each processing slot: they include the time
+   /// a thread waits for I/O or locks or is descheduled, and they add up over all threads rather than to the duration
+   /// of the event loop.
+   ///
+   /// The profile is retrieved with GetProfileReport and shown in the graphs drawn by ROOT::RDF::SaveGraph.
+   /// Profiling adds two clock reads per evaluation of a node, and is not supported by multi-process event loops.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("tree", "file.root");
+   /// df.SetProfiling(true);
+   /// auto h = df.Define("ptGeV", "pt / 1000.").Filter("ptGeV > 20").Histo1D("ptGeV");
+   /// h->Draw(); // runs the event loop
+   /// df.GetProfileReport().Print();
+   /// ~~~
+   void SetProfiling(bool profile) { fLoopManager->SetProfiling(profile); }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return the profile of the nodes in the last profiled event loop, see SetProfiling
+   ///
+   /// Unlike Report, this method does not trigger the event loop: the report is empty if no profiled event loop has
+   /// run yet. Nodes are reported with kind "Define", "Filter" (with their name or "Unnamed Filter"), "Action" (with
+   /// the name of the action as shown by SaveGraph, e.g. "Count") or "Column" (with the name of the branch or
+   /// data-source column).
+   ROOT::RDF::RProfileReport GetProfileReport() const { return fLoopManager->GetProfileReport(); }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Execute a user-defined accumulation operation on the processed column values in each processing slot
@@ -2049,6 +2377,12 @@ public:
 
       auto newColumns = CheckAndFillDSColumns(validColumnNames, std::make_index_sequence<nColumns>(), ArgTypes());
 
+      auto variedResults = BookVariedActions<U>(
+         validColumnNames, [&aggregator, &merger, &aggIdentity](RNode &branch, const ColumnNames_t &variedColumns) {
+            return branch.Aggregate(RDFInternal::CopyCallable(aggregator), RDFInternal::CopyCallable(merger),
+                                    variedColumns[0], aggIdentity);
+         });
+
       auto accObjPtr = std::make_shared<U>(aggIdentity);
       using Helper_t = RDFInternal::AggregateHelper<AccFun, MergeFun, R, T, U>;
       using Action_t = typename RDFInternal::RAction<Helper_t, Proxied>;
@@ -2056,7 +2390,9 @@ public:
          Helper_t(std::move(aggregator), std::move(merger), accObjPtr, fLoopManager->GetNSlots()), validColumnNames,
          fProxiedPtr, std::move(newColumns));
       fLoopManager->Book(action.get());
-      return MakeResultPtr(accObjPtr, *fLoopManager, std::move(action));
+      auto resPtr = MakeResultPtr(accObjPtr, *fLoopManager, std::move(action));
+      resPtr.fVariedResults = std::move(variedResults);
+      return resPtr;
    }
 
    // clang-format off
@@ -2269,6 +2605,99 @@ private:
       fCustomColumns.AddName("tdfslot_");
    }
 
+   /// Check the arguments of Vary and return the name of the column to vary, with aliases resolved
+   std::string
+   CheckVary(std::string_view colName, const std::vector<std::string> &variationTags, std::string_view variationName)
+   {
+      if (variationTags.empty())
+         throw std::runtime_error("Vary: at least one variation tag is required.");
+      const auto validColName = GetValidatedColumnNames(1, {std::string(colName)})[0];
+      const auto prefix = (variationName.empty() ? std::string(colName) : std::string(variationName)) + ":";
+      if (fVariations) {
+         for (const auto &v : *fVariations) {
+            if (v.fName.compare(0, prefix.size(), prefix) == 0)
+               throw std::runtime_error("Vary: variation \"" + prefix.substr(0, prefix.size() - 1) +
+                                        "\" has already been registered.");
+         }
+      }
+      return validColName;
+   }
+
+   /// Register on `base` one variation per tag, whose values are held by the columns Define'd by Vary
+   RInterface<Proxied, DS_t> AddVariations(RInterface<Proxied, DS_t> base, std::string_view colName,
+                                           const std::string &validColName,
+                                           const std::vector<std::string> &variationTags,
+                                           std::string_view variationName) const
+   {
+      const auto name = std::string(variationName.empty() ? colName : variationName);
+      auto variations = fVariations ? CopyVariations() : std::make_shared<std::vector<RDFInternal::RVariation>>();
+      const auto firstIdx = variations->size();
+      const auto thisNode = RDFInternal::UpcastNode(fProxiedPtr);
+      for (std::size_t i = 0; i < variationTags.size(); ++i) {
+         const auto variedName = "rdfvariation" + std::to_string(firstIdx + i) + "_";
+         variations->push_back(RDFInternal::RVariation{name + ":" + variationTags[i], thisNode, {{validColName, variedName}}});
+      }
+      base.fVariations = std::move(variations);
+      return base;
+   }
+
+   /// Return a copy of the variations of this node that can be modified for the next one, or null if there are none
+   std::shared_ptr<std::vector<RDFInternal::RVariation>> CopyVariations() const
+   {
+      return fVariations ? std::make_shared<std::vector<RDFInternal::RVariation>>(*fVariations) : nullptr;
+   }
+
+   /// Whether a Filter or Range affected by the variation already separated its branch of the graph from this node
+   bool IsVariedBranch(const RDFInternal::RVariation &v) const
+   {
+      return v.fNode != RDFInternal::UpcastNode(fProxiedPtr);
+   }
+
+   /// The branch of the graph of the variation, with the columns defined up to this node
+   RNode GetVariedBranch(const RDFInternal::RVariation &v) const
+   {
+      return RNode(v.fNode, *fLoopManager, fCustomColumns, fDataSource);
+   }
+
+   /// The variations whose branch is still this node continue with the new node `next`
+   std::shared_ptr<const std::vector<RDFInternal::RVariation>>
+   FollowNominalBranch(std::shared_ptr<std::vector<RDFInternal::RVariation>> variations,
+                       const std::shared_ptr<RDFDetail::RNodeBase> &next) const
+   {
+      if (variations) {
+         const auto thisNode = RDFInternal::UpcastNode(fProxiedPtr);
+         for (auto &v : *variations) {
+            if (v.fNode == thisNode)
+               v.fNode = next;
+         }
+      }
+      return variations;
+   }
+
+   /// Book an action for the variations that affect its input columns or its branch of the graph, see Vary.
+   /// `bookVaried` books the action on the varied branch with the varied input columns; it can return a null
+   /// RResultPtr if the action has no varied results. Return null if no variation affects the action.
+   template <typename T, typename BookVaried_t>
+   std::shared_ptr<const std::vector<std::pair<std::string, RResultPtr<T>>>>
+   BookVariedActions(const ColumnNames_t &validColumnNames, BookVaried_t bookVaried)
+   {
+      if (!fVariations)
+         return nullptr;
+      auto variedResults = std::make_shared<std::vector<std::pair<std::string, RResultPtr<T>>>>();
+      for (const auto &v : *fVariations) {
+         auto variedColumns = validColumnNames;
+         if (!RDFInternal::SubstituteVariedColumns(variedColumns, v) && !IsVariedBranch(v))
+            continue;
+         auto branch = GetVariedBranch(v);
+         auto variedResult = bookVaried(branch, variedColumns);
+         if (variedResult)
+            variedResults->emplace_back(v.fName, std::move(variedResult));
+      }
+      if (variedResults->empty())
+         return nullptr;
+      return variedResults;
+   }
+
    std::vector<std::string> GetColumnTypeNamesList(const ColumnNames_t &columnList)
    {
       std::vector<std::string> types;
@@ -2305,7 +2734,15 @@ private:
       auto action = RDFInternal::BuildAction<BranchTypes...>(validColumnNames, r, nSlots, fProxiedPtr, ActionTag{},
                                                              std::move(newColumns));
       fLoopManager->Book(action.get());
-      return MakeResultPtr(r, *fLoopManager, std::move(action));
+      auto resPtr = MakeResultPtr(r, *fLoopManager, std::move(action));
+      resPtr.fVariedResults = BookVariedActions<ActionResultType>(
+         validColumnNames, [&r](RNode &branch, const ColumnNames_t &variedColumns) {
+            auto variedResult = RDFInternal::CloneResult(*r);
+            if (!variedResult)
+               return RResultPtr<ActionResultType>();
+            return branch.template CreateAction<ActionTag, BranchTypes...>(variedColumns, variedResult);
+         });
+      return resPtr;
    }
 
    // User did not specify type, do type inference
@@ -2336,7 +2773,16 @@ private:
          tree, nSlots, fCustomColumns, fDataSource, jittedActionOnHeap, fLoopManager->GetID());
       fLoopManager->Book(jittedActionOnHeap->get());
       fLoopManager->ToJitExec(toJit);
-      return MakeResultPtr(r, *fLoopManager, *jittedActionOnHeap);
+      auto resPtr = MakeResultPtr(r, *fLoopManager, *jittedActionOnHeap);
+      resPtr.fVariedResults = BookVariedActions<ActionResultType>(
+         validColumnNames, [&r](RNode &branch, const ColumnNames_t &variedColumns) {
+            auto variedResult = RDFInternal::CloneResult(*r);
+            if (!variedResult)
+               return RResultPtr<ActionResultType>();
+            return branch.template CreateAction<ActionTag, BranchTypes...>(variedColumns, variedResult,
+                                                                           int(variedColumns.size()));
+         });
+      return resPtr;
    }
 
    template <typename F, typename CustomColumnType, typename RetType = typename TTraits::CallableTraits<F>::ret_type>
@@ -2357,6 +2803,27 @@ private:
 
       const auto validColumnNames = GetValidatedColumnNames(nColumns, columns);
 
+      if (fVariations) {
+         // define the varied versions of the column first, for the variations that affect its inputs (see Vary)
+         auto base = *this;
+         base.fVariations = nullptr;
+         auto variations = CopyVariations();
+         for (std::size_t i = 0; i < variations->size(); ++i) {
+            auto &v = (*variations)[i];
+            auto variedColumns = validColumnNames;
+            if (!RDFInternal::SubstituteVariedColumns(variedColumns, v))
+               continue;
+            const auto variedName = RDFInternal::GetVariedColumnName(name, i);
+            base = base.template DefineImpl<F, CustomColumnType>(variedName, RDFInternal::CopyCallable(expression),
+                                                                 variedColumns);
+            v.fColumns[std::string(name)] = variedName;
+         }
+         auto newInterface =
+            base.template DefineImpl<F, CustomColumnType>(name, std::forward<F>(expression), validColumnNames);
+         newInterface.fVariations = std::move(variations);
+         return newInterface;
+      }
+
       auto newColumns = CheckAndFillDSColumns(validColumnNames, std::make_index_sequence<nColumns>(), ColTypes_t());
 
       using NewCol_t = RDFDetail::RCustomColumn<F, CustomColumnType>;
@@ -2479,6 +2946,17 @@ private:
       return cachedRDF;
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Implementation of the persistent cache
+   RInterface<RLoopManager> PersistentCacheImpl(const ColumnNames_t &columnList,
+                                                const std::vector<std::string> &columnTypes,
+                                                const RCacheOptions &options, const RDFInternal::CacheSnapshot_t &snapshot)
+   {
+      auto cacheLoopManager = RDFInternal::GetPersistentCache(*fProxiedPtr, *fLoopManager, fCustomColumns, columnList,
+                                                              columnTypes, options, snapshot);
+      return RInterface<RLoopManager>(std::move(cacheLoopManager));
+   }
+
 protected:
    RInterface(const std::shared_ptr<Proxied> &proxied, RLoopManager &lm,
               const RDFInternal::RBookedCustomColumns &columns, RDataSource *ds)
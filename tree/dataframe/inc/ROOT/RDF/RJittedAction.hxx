@@ -45,11 +45,16 @@ public:
    void FinalizeSlot(unsigned int) final;
    void Finalize() final;
    void *PartialUpdate(unsigned int slot) final;
+   bool CanMergeResults() const final;
+   void SerializeResult(TBuffer &buf) final;
+   void MergeResult(TBuffer &buf) final;
    bool HasRun() const final;
    void SetHasRun() final;
    void ClearValueReaders(unsigned int slot) final;
 
    std::shared_ptr<GraphDrawing::GraphNode> GetGraph();
+   std::string GetActionName() final;
+   const RNodeProfiler &GetProfiler() const final;
 };
 
 } // ns RDF
@@ -16,6 +16,7 @@
 #include "RtypesCore.h"
 
 #include <memory>
+#include <string>
 #include <type_traits>
 
 class TTreeReader;
@@ -32,6 +33,8 @@ class RLoopManager;
 /// before the event-loop starts.
 class RJittedCustomColumn : public RCustomColumnBase {
    std::unique_ptr<RCustomColumnBase> fConcreteCustomColumn = nullptr;
+   /// Set at booking time, as the concrete custom column and its types are only known after jitting
+   std::string fCacheKey;
 
 public:
    RJittedCustomColumn(RLoopManager *lm, std::string_view name, unsigned int nSlots)
@@ -39,7 +42,8 @@ public:
    {
    }
 
-   void SetCustomColumn(std::unique_ptr<RCustomColumnBase> c) { fConcreteCustomColumn = std::move(c); }
+   void SetCustomColumn(std::unique_ptr<RCustomColumnBase> c);
+   void SetCacheKey(const std::string &key) { fCacheKey = key; }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void *GetValuePtr(unsigned int slot) final;
@@ -47,6 +51,10 @@ public:
    void Update(unsigned int slot, Long64_t entry) final;
    void ClearValueReaders(unsigned int slot) final;
    void InitNode() final;
+   std::string GetSignature(const RDFInternal::NodeId_t &nodeId) const final;
+   std::string GetCacheKey() const final { return fCacheKey; }
+   void SetEquivalentColumn(RCustomColumnBase *column) final;
+   const RDFInternal::RNodeProfiler &GetProfiler() const final;
 };
 
 } // ns RDF
@@ -38,12 +38,15 @@ namespace RDFGraphDrawing = ROOT::Internal::RDF::GraphDrawing;
 /// at a later time, from jitted code.
 class RJittedFilter final : public RFilterBase {
    std::unique_ptr<RFilterBase> fConcreteFilter = nullptr;
+   /// Set at booking time, as the concrete filter and its types are only known after jitting
+   std::string fCacheKey;
 
 public:
    RJittedFilter(RLoopManager *lm, std::string_view name);
    ~RJittedFilter() { fLoopManager->Deregister(this); }
 
    void SetFilter(std::unique_ptr<RFilterBase> f);
+   void SetCacheKey(const std::string &key) { fCacheKey = key; }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    bool CheckFilters(unsigned int slot, Long64_t entry) final;
@@ -59,6 +62,10 @@ public:
    void InitNode() final;
    void AddFilterName(std::vector<std::string> &filters) final;
    void ClearTask(unsigned int slot) final;
+   std::string GetSignature(const RDFInternal::NodeId_t &nodeId) const final;
+   std::string GetCacheKey() const final { return fCacheKey; }
+   void SetEquivalentFilter(RFilterBase *filter) final;
+   const RDFInternal::RNodeProfiler &GetProfiler() const final;
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph();
 };
 
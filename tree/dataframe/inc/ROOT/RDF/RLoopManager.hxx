@@ -13,10 +13,13 @@
 
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/NodesUtils.hxx"
+#include "ROOT/RDF/RNodeProfiler.hxx"
+#include "ROOT/RDF/RProfileReport.hxx"
 
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -123,6 +126,16 @@ class RLoopManager : public RNodeBase {
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
+   unsigned int fNProcesses{0}; ///< Number of worker processes of the event loop; 0 or 1 to run in this process
+   bool fOptimizeGraph{false};  ///< Whether equivalent Filters and custom columns are deduplicated before the event loop
+   bool fProfile{false};        ///< Whether the nodes are profiled during the event loop
+   /// One per slot if the current event loop is profiled, empty otherwise
+   std::vector<RDFInternal::RProfileSlot> fProfileSlots;
+   /// The profilers of the readers of TTree branches, by branch name. Filled by the nodes as they are initialized.
+   std::map<std::string, std::unique_ptr<RDFInternal::RNodeProfiler>> fColumnProfilers;
+   std::mutex fColumnProfilersMutex; ///< Protects fColumnProfilers, nodes are initialized concurrently
+   ROOT::RDF::RProfileReport fProfileReport; ///< The report of the last profiled event loop
+
    void CheckIndexedFriends();
    void RunEmptySourceMT();
    void RunEmptySource();
@@ -130,11 +143,18 @@ class RLoopManager : public RNodeBase {
    void RunTreeReader();
    void RunDataSourceMT();
    void RunDataSource();
+   void CheckRunMP();
+   void RunMP();
+   void RunPartition(ULong64_t begin, ULong64_t end);
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   std::pair<ULong64_t, ULong64_t> GetEntryWindow() const;
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
+   void ClearEquivalentNodes();
+   void OptimizeGraph();
    void InitNodes();
    void CleanUpNodes();
    void CleanUpTask(unsigned int slot);
+   void FillProfileReport();
    void EvalChildrenCounts();
    static unsigned int GetNextID();
 
@@ -147,6 +167,7 @@ public:
 
    void JitDeclarations();
    void Jit();
+   static void JitGraphs(const std::vector<RLoopManager *> &loopManagers);
    RLoopManager *GetLoopManagerUnchecked() final { return this; }
    void Run();
    const ColumnNames_t &GetDefaultColumnNames() const;
@@ -162,6 +183,7 @@ public:
    void Deregister(RRangeBase *rangePtr);
    bool CheckFilters(unsigned int, Long64_t) final;
    unsigned int GetNSlots() const { return fNSlots; }
+   bool IsMultiThreaded() const;
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final {}
@@ -174,9 +196,25 @@ public:
    const std::map<std::string, std::string> &GetAliasMap() const { return fAliasColumnNameMap; }
    void RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f);
    unsigned int GetID() const { return fID; }
+   void SetNProcesses(unsigned int nProcesses) { fNProcesses = nProcesses; }
+   unsigned int GetNProcesses() const { return fNProcesses; }
+   void SetGraphOptimization(bool optimize) { fOptimizeGraph = optimize; }
+   bool GetGraphOptimization() const { return fOptimizeGraph; }
+   void SetProfiling(bool profile) { fProfile = profile; }
+   bool GetProfiling() const { return fProfile; }
+   /// The state of the slot if the current event loop is profiled, nullptr otherwise
+   RDFInternal::RProfileSlot *GetProfileSlot(unsigned int slot)
+   {
+      return fProfileSlots.empty() ? nullptr : &fProfileSlots[slot];
+   }
+   std::vector<RDFInternal::RNodeProfiler *>
+   GetColumnProfilers(const ColumnNames_t &columns, const RDFInternal::RBookedCustomColumns &customColumns);
+   const ROOT::RDF::RProfileReport &GetProfileReport() const { return fProfileReport; }
 
    /// End of recursive chain of calls, does nothing
    void AddFilterName(std::vector<std::string> &) {}
+   /// End of recursive chain of calls, the dataset is added to the key by the persistent cache itself
+   std::string GetCacheKey() const { return ""; }
    /// For each booked filter, returns either the name or "Unnamed Filter"
    std::vector<std::string> GetFiltersNames();
 
@@ -54,6 +54,8 @@ public:
    virtual void StopProcessing() = 0;
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> GetGraph() = 0;
+   /// Describe the chain of Filters and Ranges from the RLoopManager to this node, as used by persistent caches.
+   virtual std::string GetCacheKey() const = 0;
 
    virtual void ResetChildrenCount()
    {
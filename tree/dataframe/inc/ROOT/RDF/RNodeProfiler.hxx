@@ -0,0 +1,122 @@
+// Author: The ROOT Team  10/2026
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RNODEPROFILER
+#define ROOT_RDF_RNODEPROFILER
+
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+class TBranch;
+class TTree;
+class TTreeReader;
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// The state of a processing slot in a profiled event loop, owned by the RLoopManager
+struct RProfileSlot {
+   /// Wall-clock time spent in the nodes that the node currently timed in this slot evaluated in turn
+   std::chrono::steady_clock::duration fNestedTime{0};
+};
+
+/// Counts the compressed bytes of the baskets that a TTreeReader reads for one branch, by following the basket that
+/// the branch reads from after each entry. The branch is looked up again whenever the reader moves to a new tree.
+class RBranchReadTracker {
+   TTree *fTree = nullptr;
+   TBranch *fBranch = nullptr;
+   Int_t fBasket = -1;
+
+public:
+   /// Return the number of bytes of the basket the branch moved to since the last call, 0 if it did not move
+   ULong64_t Update(TTreeReader &reader, const char *branchName);
+};
+
+/**
+\class ROOT::Internal::RDF::RNodeProfiler
+\ingroup dataframe
+\brief Accumulates the wall-clock time, the number of evaluations and the bytes read of a node in profiled event loops.
+
+Each processing slot has its own counters, which are summed in GetProfile. Times are wall-clock times read from a
+steady clock: they include the time the thread of the slot spends waiting, e.g. for I/O or for a lock, or descheduled by
+the OS. Nodes call InitSlot when they are initialized for a task: the counters of a slot are only updated if the event
+loop is profiled.
+*/
+class RNodeProfiler {
+   struct RCounters {
+      RProfileSlot *fSlot = nullptr; ///< Null if the event loop is not profiled
+      std::chrono::steady_clock::duration fTime{0};
+      ULong64_t fEntries = 0;
+      ULong64_t fBytesRead = 0;
+      RBranchReadTracker fReadTracker; ///< Only used by the profilers of the readers of TTree branches
+   };
+   std::vector<RCounters> fCounters;
+
+public:
+   /// Times one evaluation of a node, excluding the time spent in the nodes it evaluates in turn (e.g. the Defines
+   /// that a Filter reads). Does nothing if the event loop is not profiled.
+   class RScope {
+      RCounters *fCounters = nullptr;
+      std::chrono::steady_clock::time_point fStart;
+      std::chrono::steady_clock::duration fOuterNestedTime;
+
+   public:
+      RScope(RNodeProfiler &profiler, unsigned int slot)
+      {
+         auto &counters = profiler.fCounters[slot];
+         if (!counters.fSlot)
+            return;
+         fCounters = &counters;
+         fOuterNestedTime = counters.fSlot->fNestedTime;
+         counters.fSlot->fNestedTime = std::chrono::steady_clock::duration(0);
+         fStart = std::chrono::steady_clock::now();
+      }
+      RScope(const RScope &) = delete;
+      RScope &operator=(const RScope &) = delete;
+      ~RScope()
+      {
+         if (!fCounters)
+            return;
+         const auto elapsed = std::chrono::steady_clock::now() - fStart;
+         auto &nestedTime = fCounters->fSlot->fNestedTime;
+         fCounters->fTime += elapsed - nestedTime;
+         ++fCounters->fEntries;
+         nestedTime = fOuterNestedTime + elapsed;
+      }
+   };
+
+   /// Reset the counters, before each event loop
+   void Reset(unsigned int nSlots) { fCounters = std::vector<RCounters>(nSlots); }
+   /// Start or stop profiling the slot, profileSlot is null if the event loop is not profiled
+   void InitSlot(unsigned int slot, RProfileSlot *profileSlot) { fCounters[slot].fSlot = profileSlot; }
+   bool IsProfiling(unsigned int slot) const { return fCounters[slot].fSlot != nullptr; }
+   /// Count the bytes of the basket that the reader moved to for the given branch, if any
+   void AddBytesRead(unsigned int slot, TTreeReader &reader, const char *branchName)
+   {
+      auto &counters = fCounters[slot];
+      counters.fBytesRead += counters.fReadTracker.Update(reader, branchName);
+   }
+   /// The counters summed over all slots
+   ROOT::RDF::RNodeProfile GetProfile(const std::string &kind, const std::string &name) const;
+   /// A short summary of the profile, used to annotate the nodes of the graphs drawn by SaveGraph.
+   /// Empty if the node was not evaluated in a profiled event loop.
+   std::string GetLabel() const;
+};
+
+} // End NS RDF
+} // End NS Internal
+} // End NS ROOT
+
+#endif
@@ -0,0 +1,84 @@
+// Author: The ROOT Team  10/2026
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RPROFILEREPORT
+#define ROOT_RDF_RPROFILEREPORT
+
+#include "ROOT/RStringView.hxx"
+#include "RtypesCore.h"
+
+#include <string>
+#include <vector>
+
+namespace ROOT {
+
+namespace Internal {
+namespace RDF {
+class RNodeProfiler;
+} // End NS RDF
+} // End NS Internal
+
+namespace Detail {
+namespace RDF {
+class RLoopManager;
+} // End NS RDF
+} // End NS Detail
+
+namespace RDF {
+
+/// The profile of a node of the computation graph in the last profiled event loop, summed over all processing slots
+class RNodeProfile {
+   friend class ROOT::Internal::RDF::RNodeProfiler;
+
+private:
+   std::string fKind; ///< "Define", "Filter", "Action" or "Column" for the readers of the columns of the dataset
+   std::string fName;
+   double fWallTime;     ///< Wall-clock seconds spent evaluating the node, excluding the nodes it evaluated in turn
+   ULong64_t fEntries;  ///< Number of evaluations of the node
+   ULong64_t fBytesRead; ///< Compressed bytes of the baskets read, only for the readers of TTree branches
+   RNodeProfile(const std::string &kind, const std::string &name, double wallTime, ULong64_t entries,
+                ULong64_t bytesRead)
+      : fKind(kind), fName(name), fWallTime(wallTime), fEntries(entries), fBytesRead(bytesRead)
+   {
+   }
+
+public:
+   const std::string &GetKind() const { return fKind; }
+   const std::string &GetName() const { return fName; }
+   double GetWallTime() const { return fWallTime; }
+   ULong64_t GetEntries() const { return fEntries; }
+   ULong64_t GetBytesRead() const { return fBytesRead; }
+   /// Number of entries processed per wall-clock second, 0 if no time was measured
+   double GetThroughput() const { return fWallTime > 0. ? fEntries / fWallTime : 0.; }
+};
+
+/// The profiles of the nodes of a computation graph in the last profiled event loop, see RInterface::SetProfiling
+class RProfileReport {
+   friend class ROOT::Detail::RDF::RLoopManager;
+
+private:
+   std::vector<RNodeProfile> fProfiles;
+   void AddNode(RNodeProfile &&profile) { fProfiles.emplace_back(std::move(profile)); }
+
+public:
+   using const_iterator = typename std::vector<RNodeProfile>::const_iterator;
+   void Print() const;
+   /// A JSON array with one object per node, with keys "kind", "name", "wallTime", "entries" and "bytesRead"
+   std::string AsJSON() const;
+   /// The first profile with the given kind and name. Throws if there is none.
+   const RNodeProfile &At(std::string_view kind, std::string_view name) const;
+   const_iterator begin() const { return fProfiles.begin(); }
+   const_iterator end() const { return fProfiles.end(); }
+};
+
+} // End NS RDF
+} // End NS ROOT
+
+#endif
@@ -40,7 +40,10 @@ class RRange final : public RRangeBase {
 public:
    RRange(unsigned int start, unsigned int stop, unsigned int stride, std::shared_ptr<PrevData> pd)
       : RRangeBase(pd->GetLoopManagerUnchecked(), start, stop, stride, pd->GetLoopManagerUnchecked()->GetNSlots()),
-        fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr) {}
+        fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr)
+   {
+      fIsHeadRange = (static_cast<RNodeBase *>(fPrevDataPtr.get()) == fLoopManager);
+   }
 
    RRange(const RRange &) = delete;
    RRange &operator=(const RRange &) = delete;
@@ -51,6 +54,9 @@ public:
    /// Ranges act as filters when it comes to selecting entries that downstream nodes should process
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
+      if (fIsMT)
+         return fPrevData.CheckFilters(slot, entry) && IsInRange(RDFInternal::GetEntryRank(fPrevData, entry));
+
       if (entry != fLastCheckedEntry) {
          if (fHasStopped)
             return false;
@@ -60,11 +66,7 @@ public:
          } else {
             // apply range filter logic, cache the result
             ++fNProcessedEntries;
-            if (fNProcessedEntries <= fStart || (fStop > 0 && fNProcessedEntries > fStop) ||
-                (fStride != 1 && fNProcessedEntries % fStride != 0))
-               fLastResult = false;
-            else
-               fLastResult = true;
+            fLastResult = IsInRange(fNProcessedEntries);
             if (fNProcessedEntries == fStop) {
                fHasStopped = true;
                fPrevData.StopProcessing();
@@ -75,6 +77,12 @@ public:
       return fLastResult;
    }
 
+   ULong64_t GetEntryRank(Long64_t entry) final
+   {
+      const auto n = RDFInternal::GetEntryRank(fPrevData, entry);
+      return fStride == 1 ? n - fStart : n / fStride - fStart / fStride;
+   }
+
    // recursive chain of `Report`s
    // RRange simply forwards these calls to the previous node
    void Report(ROOT::RDF::RCutFlowReport &rep) const final { fPrevData.PartialReport(rep); }
@@ -98,6 +106,13 @@ public:
 
    /// This function must be defined by all nodes, but only the filters will add their name
    void AddFilterName(std::vector<std::string> &filters) { fPrevData.AddFilterName(filters); }
+
+   std::string GetCacheKey() const final
+   {
+      return fPrevData.GetCacheKey() + "range:" + std::to_string(fStart) + ' ' + std::to_string(fStop) + ' ' +
+             std::to_string(fStride) + '\n';
+   }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
    {
       // TODO: Ranges node have no information about custom columns, hence it is not possible now
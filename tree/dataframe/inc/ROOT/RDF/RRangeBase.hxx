@@ -39,8 +39,17 @@ protected:
    ULong64_t fNProcessedEntries{0};
    bool fHasStopped{false};    ///< True if the end of the range has been reached
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
+   /// In multi-thread event loops, entries are not counted as they arrive: the position of an entry within the
+   /// range is computed from its global entry number, see GetEntryRank()
+   const bool fIsMT;
+   bool fIsHeadRange{false}; ///< True if the range hangs directly from the RLoopManager
 
    void ResetCounters();
+   /// Whether the entry that is the nth one to reach this range (counting from 1) is selected
+   bool IsInRange(ULong64_t n) const
+   {
+      return n > fStart && (fStop == 0 || n <= fStop) && (fStride == 1 || n % fStride == 0);
+   }
 
 public:
    RRangeBase(RLoopManager *implPtr, unsigned int start, unsigned int stop, unsigned int stride,
@@ -50,11 +59,35 @@ public:
    virtual ~RRangeBase();
 
    void InitNode() { ResetCounters(); }
+   /// In multi-thread event loops, the position (counting from 1) of a selected entry among the entries selected by
+   /// this range. Ranges in multi-thread event loops only hang from the RLoopManager or from other ranges, so that
+   /// the position only depends on the global entry number.
+   virtual ULong64_t GetEntryRank(Long64_t entry) = 0;
+   bool IsHeadRange() const { return fIsHeadRange; }
+   bool HasChildren() const { return fNChildren > 0; }
+   unsigned int GetStart() const { return fStart; }
+   unsigned int GetStop() const { return fStop; }
    virtual std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph() = 0;
 };
 
 } // ns RDF
 } // ns Detail
+
+namespace Internal {
+namespace RDF {
+/// Position of the entry among the entries reaching a range node that hangs from `node`, see
+/// RRangeBase::GetEntryRank(). For the RLoopManager, this is the global entry number plus one.
+ULong64_t GetEntryRank(ROOT::Detail::RDF::RNodeBase &node, Long64_t entry);
+inline ULong64_t GetEntryRank(ROOT::Detail::RDF::RLoopManager &, Long64_t entry)
+{
+   return entry + 1;
+}
+inline ULong64_t GetEntryRank(ROOT::Detail::RDF::RRangeBase &range, Long64_t entry)
+{
+   return range.GetEntryRank(entry);
+}
+} // ns RDF
+} // ns Internal
 } // ns ROOT
 
 #endif // ROOT_RRANGEBASE
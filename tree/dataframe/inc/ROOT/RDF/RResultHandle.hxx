@@ -0,0 +1,105 @@
+// Author: The ROOT Team  10/2026
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RRESULTHANDLE
+#define ROOT_RDF_RRESULTHANDLE
+
+#include "ROOT/RResultPtr.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // TypeID2TypeName
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+
+/// A type-erased version of RResultPtr, so that the results of actions of different types can be stored in the same
+/// collection, e.g. to be passed to RunGraphs. The value of the result can be retrieved by specifying its type.
+class RResultHandle {
+   ROOT::Detail::RDF::RLoopManager *fLoopManager = nullptr; ///< Pointer to the loop manager
+   /// Owning pointer to the action that will produce this result.
+   /// Ownership is shared with RResultPtrs and RResultHandles that refer to the same result.
+   std::shared_ptr<ROOT::Internal::RDF::RActionBase> fActionPtr;
+   std::shared_ptr<void> fObjPtr; ///< Type erased shared pointer encapsulating the wrapped result
+   const std::type_info *fType = nullptr; ///< Type of the wrapped result
+
+   friend unsigned int RunGraphs(std::vector<RResultHandle> handles);
+
+   /// Get the pointer to the encapsulated result.
+   /// Ownership is not transferred to the caller.
+   /// Triggers event loop and execution of all actions booked in the associated RLoopManager.
+   void *Get()
+   {
+      if (!fActionPtr)
+         throw std::runtime_error("RResultHandle: the handle does not refer to any result.");
+      if (!fActionPtr->HasRun())
+         fLoopManager->Run();
+      return fObjPtr.get();
+   }
+
+   /// Compare given type to the type of the wrapped result and throw if the types don't match.
+   void CheckType(const std::type_info &type)
+   {
+      if (*fType != type) {
+         std::stringstream ss;
+         ss << "Got the type " << ROOT::Internal::RDF::TypeID2TypeName(type)
+            << " but the RResultHandle refers to a result of type " << ROOT::Internal::RDF::TypeID2TypeName(*fType)
+            << ".";
+         throw std::runtime_error(ss.str());
+      }
+   }
+
+public:
+   template <class T>
+   RResultHandle(const RResultPtr<T> &resultPtr)
+      : fLoopManager(resultPtr.fLoopManager), fActionPtr(resultPtr.fActionPtr), fObjPtr(resultPtr.fObjPtr),
+        fType(&typeid(T))
+   {
+   }
+
+   RResultHandle(const RResultHandle &) = default;
+   RResultHandle(RResultHandle &&) = default;
+   RResultHandle &operator=(const RResultHandle &) = default;
+   RResultHandle &operator=(RResultHandle &&) = default;
+
+   /// Get the pointer to the encapsulated object.
+   /// Triggers event loop and execution of all actions booked in the associated RLoopManager.
+   /// \tparam T Type of the action result
+   template <class T>
+   T *GetPtr()
+   {
+      CheckType(typeid(T));
+      return static_cast<T *>(Get());
+   }
+
+   /// Get a const reference to the encapsulated object.
+   /// Triggers event loop and execution of all actions booked in the associated RLoopManager.
+   /// \tparam T Type of the action result
+   template <class T>
+   const T &GetValue()
+   {
+      CheckType(typeid(T));
+      return *static_cast<T *>(Get());
+   }
+
+   /// Check whether the result has already been computed
+   bool IsReady() const { return fActionPtr && fActionPtr->HasRun(); }
+};
+
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_RRESULTHANDLE
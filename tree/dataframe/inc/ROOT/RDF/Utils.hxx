@@ -139,6 +139,30 @@ void InterpreterDeclare(const std::string &code);
 /// The pointer returned by the call to TInterpreter::Calc is returned in case of success.
 Long64_t InterpreterCalc(const std::string &code, const std::string &context = "");
 
+class RBookedCustomColumns;
+
+/// Maps a Filter or custom column node to the string that identifies it in the signatures of the nodes that read from
+/// it. See RLoopManager::OptimizeGraph.
+using NodeId_t = std::function<std::string(const void *)>;
+
+/// The part of the signature of a Filter or custom column that describes its input columns: TTree branches and
+/// data-source columns are identified by name, custom columns by the id of their node.
+std::string GetColumnsSignature(const ColumnNames_t &columns, const RBookedCustomColumns &customCols,
+                                const NodeId_t &nodeId);
+
+/// The name of a type as used in the keys of persistent caches (see RInterface::Cache): its ROOT name if it has one,
+/// its mangled name otherwise.
+std::string GetTypeCacheKey(const std::type_info &id);
+
+template <typename... Types>
+std::vector<std::string> GetTypeCacheKeys(ROOT::TypeTraits::TypeList<Types...>)
+{
+   return {GetTypeCacheKey(typeid(Types))...};
+}
+
+/// The part of the key of a persistent cache that describes the input columns of a Filter or custom column.
+std::string GetColumnsCacheKey(const ColumnNames_t &columns, const std::vector<std::string> &types);
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -15,6 +15,7 @@
 
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RDF/GraphUtils.hxx>
+#include <ROOT/RDF/RResultHandle.hxx>
 #include <ROOT/RIntegerSequence.hxx>
 #include <ROOT/TypeTraits.hxx>
 
@@ -108,11 +109,14 @@ class RInterface;
 // clang-format off
 /// Create a graphviz representation of the dataframe computation graph, return it as a string.
 /// \param[in] node any node of the graph. Called on the head (first) node, it prints the entire graph. Otherwise, only the branch the node belongs to.
+///
+/// After a profiled event loop (see RInterface::SetProfiling), the Define, Filter and action nodes also show their
+/// wall-clock time and number of evaluations.
 // clang-format on
 template <typename NodeType>
 std::string SaveGraph(NodeType node)
 {
-   ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper helper;
+   ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper helper(/*withProfiles=*/true);
    return helper(node);
 }
 
@@ -124,7 +128,7 @@ std::string SaveGraph(NodeType node)
 template <typename NodeType>
 void SaveGraph(NodeType node, const std::string &outputFile)
 {
-   ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper helper;
+   ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper helper(/*withProfiles=*/true);
    std::string dotGraph = helper(node);
 
    std::ofstream out(outputFile);
@@ -146,6 +150,36 @@ RNode AsRNode(NodeType node)
    return node;
 }
 
+// clang-format off
+/// Trigger the event loops of multiple RDataFrames concurrently
+/// \param[in] handles A vector of RResultHandles, one or more per computation graph whose event loop must run
+/// \return The number of distinct computation graphs whose event loop was run
+///
+/// The event loops of the computation graphs that the results belong to run at the same time, sharing the pool of
+/// threads of implicit multi-threading: the tasks of all event loops are scheduled on the same threads, which steal
+/// work from each other, so that many small datasets keep all cores busy even if none of them could on its own.
+/// Each computation graph runs its event loop once, however many of the handles belong to it, and computes all of its
+/// booked results as usual. All the graphs are just-in-time compiled in one go before the event loops start.
+///
+/// Without implicit multi-threading, the event loops run one after the other. Graphs with multi-process event loops
+/// (see RInterface::SetNProcesses) always run one after the other, after the others. Results that are ready already
+/// are skipped with a warning.
+///
+/// Example usage:
+/// ~~~{.cpp}
+/// ROOT::EnableImplicitMT();
+/// std::vector<ROOT::RDF::RResultHandle> handles;
+/// std::vector<ROOT::RDF::RResultPtr<TH1D>> histos;
+/// for (const auto &sample : samples) {
+///    ROOT::RDataFrame df("Events", sample);
+///    histos.emplace_back(df.Filter("nMuon == 2").Histo1D("Muon_pt"));
+///    handles.emplace_back(histos.back());
+/// }
+/// ROOT::RDF::RunGraphs(handles); // all event loops run concurrently here
+/// ~~~
+// clang-format on
+unsigned int RunGraphs(std::vector<RResultHandle> handles);
+
 } // namespace RDF
 } // namespace ROOT
 #endif
@@ -18,34 +18,60 @@
 
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RDataSource.hxx>
+#include <ROOT/RIntegerSequence.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace ROOT {
 namespace Experimental {
 
+class RNTupleModel;
 class RNTupleReader;
-class REntry;
+
+namespace Detail {
+class RFieldBase;
+class RPageSource;
+}
 
 
 class RNTupleDS final : public ROOT::RDF::RDataSource {
-   /// Clones of the first reader, one for each slot
+   /// The page source given to the constructor; provides the meta-data and is cloned for every slot
+   std::unique_ptr<ROOT::Experimental::Detail::RPageSource> fPrincipalSource;
+   /// Generated from the descriptor; its top-level fields are the prototypes for the fields of the slot readers
+   std::unique_ptr<ROOT::Experimental::RNTupleModel> fPrincipalModel;
+   /// The top-level fields of fPrincipalModel, in the order of fColumnNames
+   std::vector<ROOT::Experimental::Detail::RFieldBase *> fPrincipalFields;
+   /// One reader for each slot, each one with its own page source.  The readers are connected only to the
+   /// columns that are used by the computation graph, so that only those columns are read from storage.
    std::vector<std::unique_ptr<ROOT::Experimental::RNTupleReader>> fReaders;
-   std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fEntries;
-   /// The raw pointers wrapped by the RValue items of fEntries
+   /// The raw pointers wrapped by the RValue items of the default entries of fReaders, indexed by slot and column
    std::vector<std::vector<void*>> fValuePtrs;
+   /// The indexes into fColumnNames of the columns requested by GetColumnReaders()
+   std::vector<std::size_t> fActiveColumns;
+   /// Set if the active columns changed since the slot readers have been created
+   bool fHasNewActiveColumns = false;
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
    std::vector<std::string> fColumnNames;
    std::vector<std::string> fColumnTypes;
 
+   /// (Re-)creates the slot readers with a model that contains only the active columns
+   void CreateReaders();
+
 public:
+   explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource);
+   /// Reads from a clone of the page source of the given reader, which is not used anymore afterwards
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::RNTupleReader> ntuple);
-   ~RNTupleDS() = default;
+   ~RNTupleDS();
    void SetNSlots(unsigned int nSlots) final;
    const std::vector<std::string> &GetColumnNames() const final;
    bool HasColumn(std::string_view colName) const final;
@@ -62,6 +88,121 @@ protected:
 
 RDataFrame MakeNTupleDataFrame(std::string_view ntupleName, std::string_view fileName);
 
+} // ns Experimental
+
+namespace Internal {
+namespace RDF {
+
+/// The action helper of SnapshotNTuple: every slot fills the columns into its own RNTupleFillContext, so that the
+/// clusters are built concurrently and only appended to the output under the lock of the RNTupleParallelWriter.
+template <typename... ColumnTypes>
+class SnapshotNTupleHelper : public ROOT::Detail::RDF::RActionImpl<SnapshotNTupleHelper<ColumnTypes...>> {
+   const std::string fNTupleName;
+   const std::string fFileName;
+   const ColumnNames_t fFieldNames;
+   const ROOT::Experimental::RNTupleWriteOptions fOptions;
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   /// Created at the first task of each slot and kept until the end of the event loop, so that clusters span tasks
+   std::vector<std::unique_ptr<ROOT::Experimental::RNTupleFillContext>> fFillContexts;
+   /// The values of the default entries of fFillContexts, indexed by slot
+   std::vector<std::tuple<ColumnTypes *...>> fValues;
+   std::shared_ptr<ULong64_t> fNEntries = std::make_shared<ULong64_t>(0);
+
+   template <std::size_t... S>
+   void MakeFields(ROOT::Experimental::RNTupleModel &model, std::index_sequence<S...>)
+   {
+      int expander[] = {(model.MakeField<ColumnTypes>(fFieldNames[S]), 0)..., 0};
+      (void)expander;
+   }
+
+   template <std::size_t... S>
+   void SetValues(unsigned int slot, ROOT::Experimental::REntry &entry, std::index_sequence<S...>)
+   {
+      fValues[slot] = std::make_tuple(entry.Get<ColumnTypes>(fFieldNames[S])...);
+   }
+
+   template <std::size_t... S>
+   void CopyValues(unsigned int slot, ColumnTypes &... values, std::index_sequence<S...>)
+   {
+      int expander[] = {(*std::get<S>(fValues[slot]) = values, 0)..., 0};
+      (void)expander;
+   }
+
+public:
+   using Result_t = ULong64_t;
+   SnapshotNTupleHelper(unsigned int nSlots, std::string_view ntupleName, std::string_view fileName,
+                        const ColumnNames_t &fieldNames, const ROOT::Experimental::RNTupleWriteOptions &options)
+      : fNTupleName(ntupleName), fFileName(fileName), fFieldNames(ReplaceDotWithUnderscore(fieldNames)),
+        fOptions(options), fFillContexts(nSlots), fValues(nSlots)
+   {
+   }
+   SnapshotNTupleHelper(SnapshotNTupleHelper &&) = default;
+   SnapshotNTupleHelper(const SnapshotNTupleHelper &) = delete;
+
+   void Initialize()
+   {
+      auto model = ROOT::Experimental::RNTupleModel::Create();
+      MakeFields(*model, std::index_sequence_for<ColumnTypes...>());
+      fWriter = ROOT::Experimental::RNTupleParallelWriter::Recreate(std::move(model), fNTupleName, fFileName, fOptions);
+   }
+
+   void InitTask(TTreeReader *, unsigned int slot)
+   {
+      if (fFillContexts[slot])
+         return;
+      fFillContexts[slot] = fWriter->CreateFillContext();
+      SetValues(slot, *fFillContexts[slot]->GetModel()->GetDefaultEntry(), std::index_sequence_for<ColumnTypes...>());
+   }
+
+   void Exec(unsigned int slot, ColumnTypes &... values)
+   {
+      CopyValues(slot, values..., std::index_sequence_for<ColumnTypes...>());
+      fFillContexts[slot]->Fill();
+   }
+
+   void Finalize()
+   {
+      // destructing the fill contexts commits their last clusters, destructing the writer commits the data set
+      fFillContexts.clear();
+      *fNEntries = fWriter->GetNEntries();
+      fWriter.reset();
+   }
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fNEntries; }
+
+   std::string GetActionName() { return "SnapshotNTuple"; }
+};
+
+} // ns RDF
+} // ns Internal
+
+namespace Experimental {
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Save selected columns to disk, in a new ntuple `ntupleName` in file `fileName`.
+/// \tparam ColumnTypes variadic list of column types.
+/// \param[in] node The node of the computation graph whose entries are written.
+/// \param[in] ntupleName The name of the output ntuple.
+/// \param[in] fileName The name of the output file.
+/// \param[in] columnList The names of the columns to be written. Dots are replaced by underscores in the field names.
+/// \param[in] options The write options of the ntuple.
+/// \return a `RDataFrame` that wraps the written ntuple.
+///
+/// This is the RNTuple counterpart of RInterface::Snapshot. It runs the event loop right away. In multi-thread event
+/// loops, every slot fills its own clusters, which are appended to the output as they are complete. Hence, the order
+/// of the entries in the output is only preserved within clusters.
+template <typename... ColumnTypes>
+RDataFrame SnapshotNTuple(ROOT::RDF::RNode node, std::string_view ntupleName, std::string_view fileName,
+                          const std::vector<std::string> &columnList,
+                          const RNTupleWriteOptions &options = RNTupleWriteOptions())
+{
+   using Helper_t = ROOT::Internal::RDF::SnapshotNTupleHelper<ColumnTypes...>;
+   auto nEntries =
+      node.Book<ColumnTypes...>(Helper_t(node.GetNSlots(), ntupleName, fileName, columnList, options), columnList);
+   *nEntries;
+   return MakeNTupleDataFrame(ntupleName, fileName);
+}
+
 } // ns Experimental
 } // ns ROOT
 
@@ -0,0 +1,89 @@
+// Author: The ROOT Team  10/2026
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RRESULTMAP
+#define ROOT_RDF_RRESULTMAP
+
+#include "ROOT/RResultPtr.hxx"
+#include "ROOT/RStringView.hxx"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/**
+\class ROOT::RDF::Experimental::RResultMap
+\ingroup dataframe
+\brief The nominal and varied results of an action, as returned by VariationsFor.
+\tparam T Type of the action result
+
+The results are accessed by key: "nominal" for the nominal result, "variationName:tag" for the varied ones.
+Accessing any of the results triggers the event loop, which produces all of them at once.
+~~~{.cpp}
+auto h = df.Vary("pt", ptVariations, {"pt"}, {"down", "up"}).Histo1D<float>("pt");
+auto hs = VariationsFor(h);
+hs["nominal"].Draw();
+hs["pt:up"].Draw("SAME");
+~~~
+*/
+template <typename T>
+class RResultMap {
+   std::vector<std::string> fKeys;        ///< "nominal" followed by the names of the variations
+   std::vector<RResultPtr<T>> fResults;   ///< The results, in the same order as the keys
+
+public:
+   RResultMap(std::vector<std::string> keys, std::vector<RResultPtr<T>> results)
+      : fKeys(std::move(keys)), fResults(std::move(results))
+   {
+   }
+
+   /// Return the result for the given key, running the event loop if needed
+   T &operator[](std::string_view key)
+   {
+      const auto it = std::find(fKeys.begin(), fKeys.end(), key);
+      if (it == fKeys.end())
+         throw std::runtime_error("RResultMap: there is no result for \"" + std::string(key) + "\".");
+      return *fResults[std::distance(fKeys.begin(), it)];
+   }
+
+   /// Return "nominal" followed by the names of the variations that affect the action
+   const std::vector<std::string> &GetKeys() const { return fKeys; }
+};
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Return the nominal and the varied results of an action.
+/// \param[in] resPtr The result of an action booked on a computation graph with systematic variations.
+///
+/// Only the variations that affect the input columns of the action, or of the Filters upstream of it, have a
+/// separate result. See RInterface::Vary.
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr)
+{
+   std::vector<std::string> keys{"nominal"};
+   std::vector<RResultPtr<T>> results{resPtr};
+   if (resPtr.fVariedResults) {
+      for (const auto &nameAndResult : *resPtr.fVariedResults) {
+         keys.emplace_back(nameAndResult.first);
+         results.emplace_back(nameAndResult.second);
+      }
+   }
+   return RResultMap<T>(std::move(keys), std::move(results));
+}
+
+} // ns Experimental
+} // ns RDF
+} // ns ROOT
+
+#endif // ROOT_RDF_RRESULTMAP
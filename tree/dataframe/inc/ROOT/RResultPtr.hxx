@@ -18,6 +18,9 @@
 
 #include <memory>
 #include <functional>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
@@ -33,6 +36,19 @@ namespace RDF {
 template <typename T>
 class RResultPtr;
 
+template <typename Proxied, typename DataSource>
+class RInterface;
+
+class RResultHandle;
+
+namespace Experimental {
+template <typename T>
+class RResultMap;
+
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr);
+} // ns Experimental
+
 } // ns RDF
 
 namespace Detail {
@@ -95,6 +111,14 @@ class RResultPtr {
 
    friend class ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper;
 
+   friend class RResultHandle;
+
+   template <typename Proxied, typename DataSource>
+   friend class RInterface;
+
+   template <typename T1>
+   friend Experimental::RResultMap<T1> Experimental::VariationsFor(RResultPtr<T1> resPtr);
+
    /// \cond HIDDEN_SYMBOLS
    template <typename V, bool hasBeginEnd = TTraits::HasBeginAndEnd<V>::value>
    struct RIterationHelper {
@@ -118,6 +142,9 @@ class RResultPtr {
    /// Owning pointer to the action that will produce this result.
    /// Ownership is shared with other copies of this ResultPtr.
    std::shared_ptr<RDFInternal::RActionBase> fActionPtr;
+   /// The results of the same action for the systematic variations of its input columns, see RInterface::Vary.
+   /// Null if no variation affects the action.
+   std::shared_ptr<const std::vector<std::pair<std::string, RResultPtr<T>>>> fVariedResults;
 
    /// Triggers the event loop in the RLoopManager
    void TriggerRun();
@@ -175,6 +202,9 @@ public:
    /// Triggers event loop and execution of all actions booked in the associated RLoopManager.
    T *operator->() { return Get(); }
 
+   /// Check whether the result has already been computed, i.e. whether accessing it would not trigger an event loop.
+   bool IsReady() const { return fActionPtr && fActionPtr->HasRun(); }
+
    /// Return an iterator to the beginning of the contained object if this makes
    /// sense, throw a compilation error otherwise
    typename RIterationHelper<T>::Iterator_t begin()
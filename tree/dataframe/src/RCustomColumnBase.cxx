@@ -41,6 +41,16 @@ RCustomColumnBase::~RCustomColumnBase()
    fLoopManager->DeRegisterCustomColumn(this);
 }
 
+void RCustomColumnBase::InitProfiler(unsigned int slot)
+{
+   fProfiler.InitSlot(slot, fLoopManager->GetProfileSlot(slot));
+}
+
+std::vector<RDFInternal::RNodeProfiler *> RCustomColumnBase::GetColumnProfilers(const ColumnNames_t &columns) const
+{
+   return fLoopManager->GetColumnProfilers(columns, fCustomColumns);
+}
+
 std::string RCustomColumnBase::GetName() const
 {
    return fName;
@@ -49,4 +59,5 @@ std::string RCustomColumnBase::GetName() const
 void RCustomColumnBase::InitNode()
 {
    fLastCheckedEntry = std::vector<Long64_t>(fNSlots, -1);
+   fProfiler.Reset(fNSlots);
 }
@@ -37,6 +37,18 @@ ULong64_t &CountHelper::PartialUpdate(unsigned int slot)
    return fCounts[slot];
 }
 
+void CountHelper::SerializeResult(TBuffer &buf)
+{
+   WritePartialResult(buf, *fResultCount);
+}
+
+void CountHelper::MergeResult(TBuffer &buf)
+{
+   ULong64_t count = 0;
+   ReadPartialResult(buf, count);
+   fCounts[0] += count;
+}
+
 void FillHelper::UpdateMinMax(unsigned int slot, double v)
 {
    auto &thisMin = fMin[slot];
@@ -105,6 +117,34 @@ void FillHelper::Finalize()
    }
 }
 
+/// The buffered values are transferred rather than the histogram: the axes of the result can then be extended to the
+/// range of the values of all processes, exactly as in a single-process event loop.
+void FillHelper::SerializeResult(TBuffer &buf)
+{
+   Buf_t values;
+   Buf_t weights;
+   for (unsigned int i = 0; i < fNSlots; ++i) {
+      values.insert(values.end(), fBuffers[i].begin(), fBuffers[i].end());
+      weights.insert(weights.end(), fWBuffers[i].begin(), fWBuffers[i].end());
+   }
+   WritePartialResult(buf, values);
+   WritePartialResult(buf, weights);
+}
+
+void FillHelper::MergeResult(TBuffer &buf)
+{
+   Buf_t values;
+   Buf_t weights;
+   ReadPartialResult(buf, values);
+   ReadPartialResult(buf, weights);
+   if (!weights.empty() && weights.size() != values.size())
+      throw std::runtime_error("Cannot fill weighted histogram with values in containers of different sizes.");
+   for (auto v : values)
+      UpdateMinMax(0, v);
+   fBuffers[0].insert(fBuffers[0].end(), values.begin(), values.end());
+   fWBuffers[0].insert(fWBuffers[0].end(), weights.begin(), weights.end());
+}
+
 template void FillHelper::Exec(unsigned int, const std::vector<float> &);
 template void FillHelper::Exec(unsigned int, const std::vector<double> &);
 template void FillHelper::Exec(unsigned int, const std::vector<char> &);
@@ -157,6 +197,28 @@ double &MeanHelper::PartialUpdate(unsigned int slot)
    return fPartialMeans[slot];
 }
 
+void MeanHelper::SerializeResult(TBuffer &buf)
+{
+   double sumOfSums = 0;
+   for (auto &s : fSums)
+      sumOfSums += s;
+   ULong64_t sumOfCounts = 0;
+   for (auto &c : fCounts)
+      sumOfCounts += c;
+   WritePartialResult(buf, sumOfSums);
+   WritePartialResult(buf, sumOfCounts);
+}
+
+void MeanHelper::MergeResult(TBuffer &buf)
+{
+   double sum = 0;
+   ULong64_t count = 0;
+   ReadPartialResult(buf, sum);
+   ReadPartialResult(buf, count);
+   fSums[0] += sum;
+   fCounts[0] += count;
+}
+
 template void MeanHelper::Exec(unsigned int, const std::vector<float> &);
 template void MeanHelper::Exec(unsigned int, const std::vector<double> &);
 template void MeanHelper::Exec(unsigned int, const std::vector<char> &);
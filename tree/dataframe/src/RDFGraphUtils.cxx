@@ -14,8 +14,8 @@ std::string GraphCreatorHelper::FromGraphLeafToDot(std::shared_ptr<GraphNode> le
 
    // Explore the graph bottom-up and store its dot representation.
    while (leaf) {
-      dotStringLabels << "\t" << leaf->fCounter << " [label=\"" << leaf->fName << "\", style=\"filled\", fillcolor=\""
-                      << leaf->fColor << "\", shape=\"" << leaf->fShape << "\"];\n";
+      dotStringLabels << "\t" << leaf->fCounter << " [label=\"" << GetLabel(*leaf)
+                      << "\", style=\"filled\", fillcolor=\"" << leaf->fColor << "\", shape=\"" << leaf->fShape << "\"];\n";
       if (leaf->fPrevNode) {
          dotStringGraph << "\t" << leaf->fPrevNode->fCounter << " -> " << leaf->fCounter << ";\n";
       }
@@ -34,7 +34,7 @@ std::string GraphCreatorHelper::FromGraphActionsToDot(std::vector<std::shared_pt
 
    for (auto leaf : leaves) {
       while (leaf && !leaf->fIsExplored) {
-         dotStringLabels << "\t" << leaf->fCounter << " [label=\"" << leaf->fName
+         dotStringLabels << "\t" << leaf->fCounter << " [label=\"" << GetLabel(*leaf)
                          << "\", style=\"filled\", fillcolor=\"" << leaf->fColor << "\", shape=\"" << leaf->fShape
                          << "\"];\n";
          if (leaf->fPrevNode) {
@@ -89,6 +89,7 @@ CreateDefineNode(const std::string &columnName, const ROOT::Detail::RDF::RCustom
    }
 
    auto node = std::make_shared<GraphNode>("Define\n" + columnName);
+   node->SetProfileLabel(columnPtr->GetProfiler().GetLabel());
    node->SetDefine();
 
    sColumnsMap[columnPtr] = node;
@@ -107,6 +108,7 @@ std::shared_ptr<GraphNode> CreateFilterNode(const ROOT::Detail::RDF::RFilterBase
    }
    auto filterName = (filterPtr->HasName() ? filterPtr->GetName() : "Filter");
    auto node = std::make_shared<GraphNode>(filterName);
+   node->SetProfileLabel(filterPtr->GetProfiler().GetLabel());
 
    sFiltersMap[filterPtr] = node;
    node->SetFilter();
@@ -0,0 +1,73 @@
+// Author: The ROOT Team  10/2026
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RConfigure.h" // R__USE_IMT
+#include "ROOT/RDFHelpers.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "TError.h" // Warning
+#include "TROOT.h"  // IsImplicitMTEnabled
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using ROOT::Detail::RDF::RLoopManager;
+
+unsigned int ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
+{
+   if (handles.empty()) {
+      Warning("RunGraphs", "Got an empty list of handles, now quitting.");
+      return 0u;
+   }
+
+   // each graph runs its event loop once, in the order of the handles
+   std::vector<RLoopManager *> loopManagers;
+   for (const auto &handle : handles) {
+      if (!handle.fActionPtr)
+         throw std::runtime_error("RunGraphs: got a handle that does not refer to any result.");
+      if (handle.IsReady()) {
+         Warning("RunGraphs", "Got a handle to a result that is ready already, its event loop will not run again.");
+         continue;
+      }
+      if (std::find(loopManagers.begin(), loopManagers.end(), handle.fLoopManager) == loopManagers.end())
+         loopManagers.emplace_back(handle.fLoopManager);
+   }
+
+   // the interpreter must not be invoked concurrently
+   RLoopManager::JitGraphs(loopManagers);
+
+   // forking worker processes from several threads is not safe: multi-process event loops run one after the other
+   const auto firstMP = std::stable_partition(loopManagers.begin(), loopManagers.end(),
+                                              [](RLoopManager *lm) { return lm->GetNProcesses() <= 1; });
+
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled()) {
+      ROOT::Experimental::TTaskGroup tg;
+      for (auto it = loopManagers.begin(); it != firstMP; ++it) {
+         auto lm = *it;
+         tg.Run([lm]() { lm->Run(); });
+      }
+      tg.Wait();
+   } else
+#endif
+   {
+      for (auto it = loopManagers.begin(); it != firstMP; ++it)
+         (*it)->Run();
+   }
+
+   for (auto it = firstMP; it != loopManagers.end(); ++it)
+      (*it)->Run();
+
+   return loopManagers.size();
+}
@@ -16,14 +16,21 @@
 #include <RtypesCore.h>
 #include <TDirectory.h>
 #include <TChain.h>
+#include <TChainElement.h>
 #include <TClass.h>
 #include <TClassEdit.h>
+#include <TEnv.h>
+#include <TEntryList.h>
+#include <TFile.h>
 #include <TFriendElement.h>
 #include <TInterpreter.h>
+#include <TLockFile.h>
+#include <TMD5.h>
 #include <TObject.h>
 #include <TRegexp.h>
 #include <TPRegexp.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 
 // pragma to disable warnings on Rcpp which have
@@ -38,11 +45,19 @@
 #pragma GCC diagnostic pop
 #endif
 
+#include <algorithm>
+#include <fstream>
+#include <functional>
 #include <iosfwd>
+#include <mutex>
 #include <set>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace ROOT {
 namespace Detail {
@@ -136,6 +151,116 @@ HeadNode_t CreateSnapshotRDF(const ColumnNames_t &validCols,
    return snapshotRDFResPtr;
 }
 
+/// Describe the files of a tree, of its friends and its entry list, so that changes of the input dataset change the
+/// cache key. Only the name of files that cannot be stat'ed (e.g. remote files) is known. Trees that are not backed
+/// by a file cannot be identified across runs and are refused.
+static void AddTreeToCacheKey(TTree &tree, std::ostream &key)
+{
+   key << "tree:" << tree.GetName() << '\n';
+   std::vector<std::string> fileNames;
+   if (auto chain = dynamic_cast<TChain *>(&tree)) {
+      for (auto element : *chain->GetListOfFiles())
+         fileNames.emplace_back(element->GetTitle());
+   } else if (auto file = tree.GetCurrentFile()) {
+      fileNames.emplace_back(file->GetName());
+   } else {
+      throw std::runtime_error("Cache: tree " + std::string(tree.GetName()) +
+                               " is not read from a file, its content cannot be identified across runs. "
+                               "Use Cache without a cache directory instead.");
+   }
+   for (const auto &fileName : fileNames) {
+      key << "file:" << fileName;
+      FileStat_t stat;
+      if (gSystem->GetPathInfo(fileName.c_str(), stat) == 0)
+         key << ' ' << stat.fSize << ' ' << stat.fMtime;
+      key << '\n';
+   }
+   if (auto entryList = tree.GetEntryList())
+      key << "entrylist:" << entryList->GetName() << ' ' << entryList->GetN() << '\n';
+   if (auto friends = tree.GetListOfFriends()) {
+      for (auto friendElObj : *friends) {
+         auto friendEl = static_cast<TFriendElement *>(friendElObj);
+         key << "friend:" << friendEl->GetName() << '\n';
+         if (auto friendTree = friendEl->GetTree())
+            AddTreeToCacheKey(*friendTree, key);
+      }
+   }
+}
+
+std::shared_ptr<RLoopManager> GetPersistentCache(const RNodeBase &node, RLoopManager &lm,
+                                                 const RBookedCustomColumns &customColumns,
+                                                 const ColumnNames_t &columns,
+                                                 const std::vector<std::string> &columnTypes,
+                                                 const RCacheOptions &options, const CacheSnapshot_t &snapshot)
+{
+   // The cache key describes the chain of Filters and Ranges that leads to node with their parameters, the custom
+   // columns, the cached columns and the input dataset. Jitted expressions are part of the key, but the code of
+   // compiled callables cannot be inspected: users mark changes to it via fTag.
+   std::stringstream key;
+   key << "graph:\n" << node.GetCacheKey();
+   key << "defines:\n";
+   for (const auto &c : customColumns.GetColumns())
+      key << c.second->GetCacheKey();
+   key << "aliases:";
+   for (const auto &a : lm.GetAliasMap())
+      key << a.first << '=' << a.second << ' ';
+   key << "\ncolumns:";
+   for (const auto &c : columns)
+      key << c << ' ';
+   key << "\ntypes:";
+   for (const auto &t : columnTypes)
+      key << t << ' ';
+   key << "\ntag:" << options.fTag << '\n';
+   if (auto ds = lm.GetDataSource()) {
+      // The data source interface does not tell which input is read: the key would be the same for all the inputs
+      // of a data source type and stale results would be reused.
+      throw std::runtime_error("Cache: the input of the " + ds->GetLabel() +
+                               " data source cannot be identified across runs. "
+                               "Use Cache without a cache directory instead.");
+   } else if (auto tree = lm.GetTree()) {
+      AddTreeToCacheKey(*tree, key);
+   } else {
+      key << "entries:" << lm.GetNEmptyEntries() << '\n';
+   }
+   const auto keyStr = key.str();
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(keyStr.data()), keyStr.size());
+   md5.Final();
+
+   const std::string treeName = "rdfcache";
+   const std::string fileName = options.fDirectory + "/rdfcache_" + md5.AsString() + ".root";
+
+   // Cache files are written under a temporary name and renamed once complete, so that an existing cache file
+   // is a valid one also if a previous process was interrupted or several processes fill the cache concurrently
+   bool isValid = false;
+   if (!gSystem->AccessPathName(fileName.c_str())) {
+      ::TDirectory::TContext ctxt;
+      std::unique_ptr<TFile> file(TFile::Open(fileName.c_str(), "READ"));
+      isValid = file && !file->IsZombie() && file->Get(treeName.c_str());
+   }
+   if (!isValid) {
+      if (gSystem->AccessPathName(options.fDirectory.c_str()) &&
+          gSystem->mkdir(options.fDirectory.c_str(), /*recursive=*/true) != 0) {
+         throw std::runtime_error("Cache: cannot create the cache directory " + options.fDirectory);
+      }
+      const auto tmpFileName = fileName + ".tmp" + std::to_string(gSystem->GetPid());
+      RSnapshotOptions snapshotOptions;
+      snapshotOptions.fCompressionAlgorithm = options.fCompressionAlgorithm;
+      snapshotOptions.fCompressionLevel = options.fCompressionLevel;
+      snapshot(treeName, tmpFileName, snapshotOptions);
+      if (gSystem->Rename(tmpFileName.c_str(), fileName.c_str()) != 0) {
+         gSystem->Unlink(tmpFileName.c_str());
+         throw std::runtime_error("Cache: cannot write the cache file " + fileName);
+      }
+   }
+
+   auto chain = std::make_shared<TChain>(treeName.c_str());
+   chain->Add(fileName.c_str());
+   auto cacheLoopManager = std::make_shared<RLoopManager>(nullptr, columns);
+   cacheLoopManager->SetTree(chain);
+   return cacheLoopManager;
+}
+
 std::string DemangleTypeIdName(const std::type_info &typeInfo)
 {
    int dummy(0);
@@ -391,6 +516,68 @@ unsigned int Replace(std::string &s, const std::string what, const std::string w
    return numReplacements;
 }
 
+std::string GetVariedColumnName(std::string_view name, std::size_t idx)
+{
+   // the rdf prefix and the trailing underscore make it an internal column, hidden from GetColumnNames
+   return "rdfvaried" + std::to_string(idx) + "_" + std::string(name) + "_";
+}
+
+bool SubstituteVariedColumns(ColumnNames_t &columns, const RVariation &variation)
+{
+   bool replaced = false;
+   for (auto &c : columns) {
+      const auto it = variation.fColumns.find(c);
+      if (it != variation.fColumns.end()) {
+         c = it->second;
+         replaced = true;
+      }
+   }
+   return replaced;
+}
+
+std::string SubstituteVariedColumns(std::string_view expression, const RVariation &variation,
+                                    const std::map<std::string, std::string> &aliasMap)
+{
+   // pairs of patterns that match the names of varied columns and of their replacements
+   std::vector<std::pair<std::string, std::string>> substitutions;
+   for (const auto &potCol : GetPotentialColumnNames(std::string(expression))) {
+      const auto aliasIt = aliasMap.find(potCol);
+      const auto &colName = aliasIt == aliasMap.end() ? potCol : aliasIt->second;
+      const auto variedIt = variation.fColumns.find(colName);
+      if (variedIt == variation.fColumns.end())
+         continue;
+      // match the whole name only, e.g. not `x` in `x2` or in `obj.x`, but `x` in `x.size()`
+      std::string escapedName = potCol;
+      Replace(escapedName, ".", "\\.");
+      substitutions.emplace_back("(^|[^\\w.])" + escapedName + "(?!\\w)", "$1" + variedIt->second);
+   }
+   if (substitutions.empty())
+      return std::string(expression);
+
+   // substitute in the code between string and character literals only, the literals are copied as they are
+   std::string result;
+   std::size_t pos = 0;
+   while (pos < expression.size()) {
+      auto literalBegin = expression.find_first_of("\"'", pos);
+      if (literalBegin == std::string_view::npos)
+         literalBegin = expression.size();
+      TString code(expression.data() + pos, literalBegin - pos);
+      for (const auto &s : substitutions)
+         TPRegexp(s.first).Substitute(code, s.second, "g");
+      result += code.Data();
+      if (literalBegin == expression.size())
+         break;
+
+      auto literalEnd = literalBegin + 1;
+      while (literalEnd < expression.size() && expression[literalEnd] != expression[literalBegin])
+         literalEnd += expression[literalEnd] == '\\' ? 2 : 1; // skip escaped characters
+      literalEnd = std::min(literalEnd + 1, expression.size());
+      result.append(expression.data() + literalBegin, literalEnd - literalBegin);
+      pos = literalEnd;
+   }
+   return result;
+}
+
 // Match expression against names of branches passed as parameter
 // Return vector of names of the branches used in the expression
 std::vector<std::string> FindUsedColumnNames(std::string_view expression, ColumnNames_t branches,
@@ -531,36 +718,6 @@ std::vector<std::string> ColumnTypesAsString(ColumnNames_t &colNames, ColumnName
    return colTypes;
 }
 
-// Jit expression "in the vacuum", throw if cling exits with an error
-// This is to make sure that column names, types and expression string are proper C++
-void TryToJitExpression(const std::string &expression, const ColumnNames_t &colNames,
-                        const std::vector<std::string> &colTypes, bool hasReturnStmt)
-{
-   R__ASSERT(colNames.size() == colTypes.size());
-
-   static unsigned int iNs = 0U;
-   std::stringstream dummyDecl;
-   dummyDecl << "namespace __rdf_" << std::to_string(iNs++) << "{ auto rdf_f = []() {";
-
-   for (auto col = colNames.begin(), type = colTypes.begin(); col != colNames.end(); ++col, ++type) {
-      dummyDecl << *type << " " << *col << ";\n";
-   }
-
-   // Now that branches are declared as variables, put the body of the
-   // lambda in dummyDecl and close scopes of f and namespace __rdf_N
-   if (hasReturnStmt)
-      dummyDecl << expression << "\n;};}";
-   else
-      dummyDecl << "return " << expression << "\n;};}";
-
-   // Try to declare the dummy lambda, error out if it does not compile
-   if (!gInterpreter->Declare(dummyDecl.str().c_str())) {
-      auto msg =
-         "Cannot interpret the following expression:\n" + std::string(expression) + "\n\nMake sure it is valid C++.";
-      throw std::runtime_error(msg);
-   }
-}
-
 std::string
 BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes, bool hasReturnStmt)
 {
@@ -585,6 +742,129 @@ BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const Colu
    return ss.str();
 }
 
+/// The directory where jitted expressions are kept as compiled libraries across processes, empty if there is none.
+/// It is set with the ROOT_RDF_JITCACHE_DIR environment variable or with the RDataFrame.JitCacheDir rootrc entry.
+static std::string GetJitCacheDir()
+{
+   const char *dir = gSystem->Getenv("ROOT_RDF_JITCACHE_DIR");
+   if (!dir || !dir[0])
+      dir = gEnv->GetValue("RDataFrame.JitCacheDir", "");
+   return dir;
+}
+
+/// Write the source of the library that holds the lambda of a jitted expression. The library exports a function that
+/// calls the lambda, its body is hidden from the interpreter so that the compiled code is used instead of jitting it.
+static bool WriteJitCacheSource(const std::string &fileName, const std::string &funcName,
+                                const std::string &lambdaCode, const ColumnNames_t &argTypes)
+{
+   std::stringstream params, args;
+   for (auto i = 0u; i < argTypes.size(); ++i) {
+      params << (i ? ", " : "") << argTypes[i] << " &arg" << i;
+      args << (i ? ", " : "") << "arg" << i;
+   }
+   const auto guard = funcName + "_C";
+
+   std::ofstream out(fileName);
+   out << "// Generated by RDataFrame, see RDataFrame.JitCacheDir\n"
+       << "#ifndef " << guard << "\n#define " << guard << "\n"
+       << "#include <ROOT/RVec.hxx>\n#include <ROOT/TypeTraits.hxx>\n#include <RtypesCore.h>\n#include <TMath.h>\n"
+       << "#include <cmath>\n#include <string>\n#include <vector>\n"
+       << "using namespace std;\n"
+       << "namespace __rdf {\n"
+       << "inline auto " << funcName << "_lambda()\n{\n   return " << lambdaCode << ";\n}\n"
+       << "using " << funcName << "_ret_t = ROOT::TypeTraits::CallableTraits<decltype(" << funcName
+       << "_lambda())>::ret_type;\n"
+       << funcName << "_ret_t " << funcName << "(" << params.str() << ");\n"
+       << "}\n"
+       << "#if !defined(__CLING__) && !defined(__ROOTCLING__)\n"
+       << "__rdf::" << funcName << "_ret_t __rdf::" << funcName << "(" << params.str() << ")\n{\n"
+       << "   return " << funcName << "_lambda()(" << args.str() << ");\n}\n"
+       << "#endif\n#endif\n";
+   out.close();
+   return !out.fail();
+}
+
+/// Return the name of the function that calls the lambda in the library of the jit cache directory, or an empty
+/// string if there is no such library. If the library is not there yet, it is built for the next processes.
+/// Expressions that cannot be compiled outside of the interpreter, e.g. because they call functions that were only
+/// declared to the interpreter, are remembered and not compiled again.
+static std::string GetCachedLambda(const std::string &cacheDir, const std::string &lambdaCode,
+                                   const ColumnNames_t &argTypes, const std::function<void()> &declareInProcess)
+{
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(lambdaCode.data()), lambdaCode.size());
+   md5.Final();
+   const std::string funcName = std::string("rdflambda_") + md5.AsString();
+   const std::string base = cacheDir + '/' + funcName;
+   const std::string sourceName = base + ".C";
+   const std::string failedName = base + ".failed";
+
+   if (gSystem->AccessPathName(cacheDir.c_str()) && gSystem->mkdir(cacheDir.c_str(), /*recursive=*/true) != 0) {
+      Warning("RDataFrame::Jit", "Cannot create the jit cache directory %s", cacheDir.c_str());
+      return "";
+   }
+
+   // Serializes the compilation of the library among the processes that share the cache directory
+   TLockFile lock((base + ".lock").c_str());
+   if (!gSystem->AccessPathName(failedName.c_str()))
+      return "";
+   if (!gSystem->AccessPathName(sourceName.c_str())) {
+      // Loads the library, the interpreter only sees the declaration of the function
+      const auto include = "#include \"" + sourceName + "\"";
+      if (gSystem->CompileMacro(sourceName.c_str(), "ks") && gInterpreter->Declare(include.c_str()))
+         return "__rdf::" + funcName;
+      std::ofstream(failedName).close();
+      return "";
+   }
+
+   // Only valid expressions are compiled, this process jits the lambda as usual
+   declareInProcess();
+   if (!WriteJitCacheSource(sourceName, funcName, lambdaCode, argTypes) ||
+       !gSystem->CompileMacro(sourceName.c_str(), "kcs"))
+      std::ofstream(failedName).close();
+   return "";
+}
+
+// Declare the lambda to the interpreter and return the name of the variable that holds it, throw if cling exits with
+// an error. Lambdas are declared once per process: Filters and Defines with the same expression on columns of the same
+// types, also in different RDataFrames, reuse the code that was compiled for the first of them. Expressions that read
+// Define'd columns are compiled once per RDataFrame, as the types of those columns are spelled as per-RDataFrame
+// aliases. If a jit cache directory is set, the other lambdas are also compiled into libraries that are kept there
+// and loaded by the next processes instead of jitting the lambdas again.
+std::string DeclareLambda(const std::string &lambdaCode, const std::string &expression, const ColumnNames_t &argTypes)
+{
+   static std::mutex mutex;
+   static std::unordered_map<std::string, std::string> lambdaNames;
+
+   std::lock_guard<std::mutex> lock(mutex);
+   auto it = lambdaNames.find(lambdaCode);
+   if (it != lambdaNames.end())
+      return it->second;
+
+   const auto lambdaID = std::to_string(lambdaNames.size());
+   const auto lambdaName = "__rdf::lambda" + lambdaID;
+   bool isDeclared = false;
+   auto declareInProcess = [&] {
+      const auto lambdaDecl = "namespace __rdf { auto lambda" + lambdaID + " = " + lambdaCode + ";\n}";
+      if (!gInterpreter->Declare(lambdaDecl.c_str())) {
+         auto msg = "Cannot interpret the following expression:\n" + expression + "\n\nMake sure it is valid C++.";
+         throw std::runtime_error(msg);
+      }
+      isDeclared = true;
+   };
+
+   const auto cacheDir = GetJitCacheDir();
+   if (!cacheDir.empty() && lambdaCode.find("__rdf") == std::string::npos) {
+      auto cachedName = GetCachedLambda(cacheDir, lambdaCode, argTypes, declareInProcess);
+      if (!cachedName.empty())
+         return lambdaNames[lambdaCode] = cachedName;
+   }
+
+   if (!isDeclared)
+      declareInProcess();
+   return lambdaNames[lambdaCode] = lambdaName;
+}
+
 std::string PrettyPrintAddr(const void *const addr)
 {
    std::stringstream s;
@@ -593,6 +873,21 @@ std::string PrettyPrintAddr(const void *const addr)
    return s.str();
 }
 
+/// The part of the key of a persistent cache that describes the input columns of a jitted expression. The types of
+/// custom columns are left out: they are jitted aliases whose names depend on the booking order, and the keys of the
+/// custom columns themselves already describe them.
+static std::string GetJitColumnsCacheKey(const ColumnNames_t &columns, std::vector<std::string> types,
+                                         const std::map<std::string, std::string> &aliasMap,
+                                         const RBookedCustomColumns &customCols)
+{
+   for (auto i = 0u; i < columns.size() && i < types.size(); ++i) {
+      const auto aliasMapIt = aliasMap.find(columns[i]);
+      if (customCols.HasName(aliasMapIt == aliasMap.end() ? columns[i] : aliasMapIt->second))
+         types[i].clear();
+   }
+   return GetColumnsCacheKey(columns, types);
+}
+
 // Jit a string filter expression and jit-and-call this->Filter with the appropriate arguments
 // Return pointer to the new functional chain node returned by the call, cast to Long_t
 
@@ -614,11 +909,15 @@ void BookFilterJit(RJittedFilter *jittedFilter, void *prevNodeOnHeap, std::strin
    Ssiz_t matchedLen;
    const bool hasReturnStmt = re.Index(dotlessExpr, &matchedLen) != -1;
 
-   auto lm = jittedFilter->GetLoopManagerUnchecked();
-   lm->JitDeclarations(); // TryToJitExpression might need some of the Define'd column type aliases
-   TryToJitExpression(dotlessExpr, varNames, usedColTypes, hasReturnStmt);
+   const auto &prevNode = *static_cast<std::shared_ptr<RNodeBase> *>(prevNodeOnHeap);
+   jittedFilter->SetCacheKey(prevNode->GetCacheKey() + "filter:" + std::string(name) + '|' + std::string(expression) +
+                             '|' + GetJitColumnsCacheKey(usedBranches, usedColTypes, aliasMap, customCols) + '\n');
 
-   const auto filterLambda = BuildLambdaString(dotlessExpr, varNames, usedColTypes, hasReturnStmt);
+   auto lm = jittedFilter->GetLoopManagerUnchecked();
+   lm->JitDeclarations(); // the lambda might need some of the Define'd column type aliases
+   const auto filterLambda =
+      DeclareLambda(BuildLambdaString(dotlessExpr, varNames, usedColTypes, hasReturnStmt), std::string(expression),
+                    usedColTypes);
 
    const auto jittedFilterAddr = PrettyPrintAddr(jittedFilter);
    const auto prevNodeAddr = PrettyPrintAddr(prevNodeOnHeap);
@@ -669,23 +968,25 @@ void BookDefineJit(std::string_view name, std::string_view expression, RLoopMana
    Ssiz_t matchedLen;
    const bool hasReturnStmt = re.Index(dotlessExpr, &matchedLen) != -1;
 
-   lm.JitDeclarations(); // TryToJitExpression might need some of the Define'd column type aliases
-   TryToJitExpression(dotlessExpr, varNames, usedColTypes, hasReturnStmt);
+   jittedCustomColumn->SetCacheKey("define:" + std::string(name) + '|' + std::string(expression) + '|' +
+                                   GetJitColumnsCacheKey(usedBranches, usedColTypes, aliasMap, customCols) + '\n');
 
-   const auto definelambda = BuildLambdaString(dotlessExpr, varNames, usedColTypes, hasReturnStmt);
+   lm.JitDeclarations(); // the lambda might need some of the Define'd column type aliases
+   const auto definelambda =
+      DeclareLambda(BuildLambdaString(dotlessExpr, varNames, usedColTypes, hasReturnStmt), std::string(expression),
+                    usedColTypes);
    const auto customColID = std::to_string(jittedCustomColumn->GetID());
-   const auto lambdaName = "eval_" + std::string(name) + customColID;
    const auto ns = "__rdf" + std::to_string(namespaceID);
 
    auto customColumnsCopy = new RDFInternal::RBookedCustomColumns(customCols);
    auto customColumnsAddr = PrettyPrintAddr(customColumnsCopy);
 
-   // Declare the lambda variable and an alias for the type of the defined column in namespace __rdf
+   // Declare an alias for the type of the defined column in namespace __rdfN
    // This assumes that a given variable is Define'd once per RDataFrame -- we might want to relax this requirement
    // to let python users execute a Define cell multiple times
-   const auto defineDeclaration =
-      "namespace " + ns + " { auto " + lambdaName + " = " + definelambda + ";\n" + "using " + std::string(name) +
-      customColID + "_type = typename ROOT::TypeTraits::CallableTraits<decltype(" + lambdaName + " )>::ret_type;  }\n";
+   const auto defineDeclaration = "namespace " + ns + " { using " + std::string(name) + customColID +
+                                  "_type = typename ROOT::TypeTraits::CallableTraits<decltype(" + definelambda +
+                                  ")>::ret_type; }\n";
    lm.ToJitDeclare(defineDeclaration);
 
    std::stringstream defineInvocation;
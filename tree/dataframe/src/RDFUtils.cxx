@@ -10,6 +10,8 @@
 
 #include "RConfigure.h" // R__USE_IMT
 #include "ROOT/RDataSource.hxx"
+#include "ROOT/RDF/RBookedCustomColumns.hxx"
+#include "ROOT/RDF/RCustomColumnBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "RtypesCore.h"
 #include "TBranch.h"
@@ -308,6 +310,44 @@ Long64_t InterpreterCalc(const std::string &code, const std::string &context)
    return res;
 }
 
+std::string GetColumnsSignature(const ColumnNames_t &columns, const RBookedCustomColumns &customCols,
+                                const NodeId_t &nodeId)
+{
+   const auto &customColumns = customCols.GetColumns();
+   std::string signature;
+   for (const auto &column : columns) {
+      const auto it = customColumns.find(column);
+      if (it == customColumns.end())
+         signature += "branch:" + column;
+      else if (it->second->IsDataSourceColumn()) // booked separately by each node that reads it
+         signature += "ds:" + column;
+      else
+         signature += nodeId(it->second.get());
+      signature += ';';
+   }
+   return signature;
+}
+
+std::string GetTypeCacheKey(const std::type_info &id)
+{
+   auto name = TypeID2TypeName(id);
+   if (name.empty())
+      name = id.name();
+   return name;
+}
+
+std::string GetColumnsCacheKey(const ColumnNames_t &columns, const std::vector<std::string> &types)
+{
+   std::string key;
+   for (auto i = 0u; i < columns.size(); ++i) {
+      key += columns[i];
+      if (i < types.size() && !types[i].empty())
+         key += ':' + types[i];
+      key += ';';
+   }
+   return key;
+}
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -69,6 +69,7 @@ Transformations are a way to manipulate the data.
 | [DefineSlotEntry](classROOT_1_1RDF_1_1RInterface.html#a4f17074d5771916e3df18f8458186de7) | Same as `DefineSlot`, but the entry number is passed in addition to the slot number. This is meant as a helper in case some dependency on the entry number needs to be honoured. |
 | [Filter](classROOT_1_1RDF_1_1RInterface.html#a70284a3bedc72b19610aaa91b5007ebd) | Filter the rows of the dataset. |
 | [Range](classROOT_1_1RDF_1_1RInterface.html#a1b36b7868831de2375e061bb06cfc225) | Creates a node that filters entries based on range of entries |
+| Vary | Registers systematic variations of a column: downstream results are also computed for each of its varied values, see [Systematic variations](#systematic-variations). |
 
 ### Actions
 Actions are a way to produce a result out of the data. Each one is described in more detail in the reference guide.
@@ -729,6 +730,12 @@ will create a new column called "pt" the value of which is calculated starting f
 builds a just-in-time compiled function starting from the expression after having deduced the list of necessary branches
 from the names of the variables specified by the user.
 
+Each expression is compiled once per process. If the `RDataFrame.JitCacheDir` rootrc entry or the
+`ROOT_RDF_JITCACHE_DIR` environment variable name a directory, the expressions are also compiled with ACLiC into
+libraries that are kept in that directory: the next processes load them instead of compiling the expressions again.
+The first process pays the compilation of the libraries. Expressions that read Define'd columns, or that call code that
+is only known to the interpreter, are always compiled by the interpreter.
+
 #### Custom columns as function of slot and entry number
 
 It is possible to create custom columns also as a function of the processing slot and entry numbers. The methods that can
@@ -738,6 +745,26 @@ first parameter is the slot number which ranges from 0 to ROOT::GetImplicitMTPoo
 - `DefineSlotEntry(name, f, columnList)`. In this case the callable f has this signature `R(unsigned int, ULong64_t,
 T1, T2, ...)`: the first parameter is the slot number while the second one the number of the entry being processed.
 
+### <a name="systematic-variations"></a> Systematic variations
+`Vary(colName, f, columnList, tags)` registers systematic variations of a column: `f` returns a `RVec` with one varied
+value of `colName` per tag. The Defines, Filters and actions booked afterwards that depend on `colName`, directly or
+through other custom columns, are also computed for each of the varied values, in the same event loop as the nominal
+ones. `ROOT::RDF::Experimental::VariationsFor` returns all the results of an action, with keys `"nominal"` and
+`"variationName:tag"`:
+
+~~~{.cpp}
+auto h = df.Vary("pt", "ROOT::RVec<double>{0.9 * pt, 1.1 * pt}", {"down", "up"}, "ptScale")
+            .Filter("pt > 10")
+            .Histo1D("pt");
+auto hs = ROOT::RDF::Experimental::VariationsFor(h);
+hs["ptScale:down"].Draw(); // runs the event loop once, for the nominal and the varied histograms
+~~~
+
+Only the affected nodes of the computation graph are duplicated for each variation. Custom columns that do not depend on
+varied columns are evaluated once per entry, and actions downstream of Filters that do not depend on varied columns share
+the nominal selection. Foreach, Book, Snapshot and Cache only process the nominal values, and varied Filters do not show
+up in the cut-flow report.
+
 ##  <a name="actions"></a>Actions
 ### Instant and lazy actions
 Actions can be **instant** or **lazy**. Instant actions are executed as soon as they are called, while lazy actions are
@@ -774,6 +801,53 @@ will never receive the same slot at the same time.
 This extra parameter might facilitate writing safe parallel code by having each thread write/modify a different
 *processing slot*, e.g. a different element of a list. See [here](#generic-actions) for an example usage of `ForeachSlot`.
 
+### Multi-process event loops
+On machines with many cores, the threads of a multi-thread event loop can end up contending for the memory allocator or
+the interpreter. As an alternative, `SetNProcesses(n)` runs the event loops of a computation graph in `n`
+worker processes forked from the current one: each worker processes a contiguous range of entries, aligned to the
+cluster boundaries of the input `TTree`, and the results of the actions are sent back and merged. Only actions whose
+results can be merged this way, i.e. `Count`, `Sum`, `Min`, `Max`, `Mean`, `Fill`, the histogram and profile actions
+and `Take`, can be booked, and `Range`, callbacks and friend trees are not supported. Implicit multi-threading must be
+disabled, as processes with running threads cannot be forked safely. `Take` returns the values in the order of the
+entries, as in a single-thread event loop.
+~~~{.cpp}
+ROOT::RDataFrame df("tree", "file.root");
+df.SetNProcesses(16);
+auto h = df.Filter("pt > 10").Histo1D({"h", "h", 100, 0, 100}, "pt");
+~~~
+
+### Optimizing the computation graph
+Computation graphs that are generated programmatically often book the same Define or Filter expression on several
+branches. With `SetGraphOptimization(true)`, the graph is optimized right before each event loop: Defines and unnamed
+Filters that apply the same stateless callable to the same inputs (and, for Filters, to the entries selected by
+equivalent previous nodes) are evaluated once per entry, and their duplicates reuse the results. Since the results of
+expressions that depend on external state, e.g. on a random number generator, would be shared as well, the optimization
+is opt-in. Custom columns that no node of the event loop reads are never evaluated, independently of this setting.
+~~~{.cpp}
+ROOT::RDataFrame df("tree", "file.root");
+df.SetGraphOptimization(true);
+auto nMuons = df.Filter("nMuon > 1").Count();
+auto h = df.Filter("nMuon > 1").Histo1D("Muon_pt"); // "nMuon > 1" is evaluated once per entry
+~~~
+
+### Profiling the event loop
+`SetProfiling(true)` makes the following event loops record, for each Define, Filter and action and for the reader of
+each branch, the wall-clock time spent evaluating it, the number of evaluations and (for branches) the compressed bytes
+read, summed over all processing slots. The time of a node does not include the time spent in the nodes it reads in
+turn, so that the slowest columns of large graphs stand out. `GetProfileReport` returns the profile of the last profiled
+event loop, which can be printed or exported as JSON; `SaveGraph` shows the time and the number of evaluations of each
+node.
+~~~{.cpp}
+ROOT::RDataFrame df("Events", "file.root");
+df.SetProfiling(true);
+auto h = df.Define("good_pt", "Muon_pt[Muon_pt > 20]").Histo1D("good_pt");
+h->Draw();
+auto report = df.GetProfileReport();
+report.Print();
+std::ofstream("profile.json") << report.AsJSON();
+ROOT::RDF::SaveGraph(df, "profiled_graph.dot");
+~~~
+
 <a name="reference"></a>
 */
 // clang-format on
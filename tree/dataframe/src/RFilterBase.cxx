@@ -44,6 +44,7 @@ void RFilterBase::FillReport(ROOT::RDF::RCutFlowReport &rep) const
 void RFilterBase::InitNode()
 {
    fLastCheckedEntry = std::vector<Long64_t>(fNSlots, -1);
+   fProfiler.Reset(fNSlots);
    if (!fName.empty()) // if this is a named filter we care about its report count
       ResetReportCount();
 }
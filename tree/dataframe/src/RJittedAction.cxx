@@ -60,6 +60,24 @@ void *RJittedAction::PartialUpdate(unsigned int slot)
    return fConcreteAction->PartialUpdate(slot);
 }
 
+bool RJittedAction::CanMergeResults() const
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->CanMergeResults();
+}
+
+void RJittedAction::SerializeResult(TBuffer &buf)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->SerializeResult(buf);
+}
+
+void RJittedAction::MergeResult(TBuffer &buf)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->MergeResult(buf);
+}
+
 bool RJittedAction::HasRun() const
 {
    if (fConcreteAction != nullptr) {
@@ -87,3 +105,15 @@ std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RJittedAction::Get
    R__ASSERT(fConcreteAction != nullptr);
    return fConcreteAction->GetGraph();
 }
+
+std::string RJittedAction::GetActionName()
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetActionName();
+}
+
+const ROOT::Internal::RDF::RNodeProfiler &RJittedAction::GetProfiler() const
+{
+   // nothing to profile if the action has not been jitted yet
+   return fConcreteAction ? fConcreteAction->GetProfiler() : fProfiler;
+}
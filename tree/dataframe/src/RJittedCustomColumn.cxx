@@ -9,10 +9,18 @@
  *************************************************************************/
 
 #include <ROOT/RDF/RJittedCustomColumn.hxx>
+#include <ROOT/RDF/RLoopManager.hxx>
 #include <TError.h> // R__ASSERT
 
 using namespace ROOT::Detail::RDF;
 
+void RJittedCustomColumn::SetCustomColumn(std::unique_ptr<RCustomColumnBase> c)
+{
+   // the concrete column is only reached through this node: the loop manager must only see one of the two
+   fLoopManager->DeRegisterCustomColumn(c.get());
+   fConcreteCustomColumn = std::move(c);
+}
+
 void RJittedCustomColumn::InitSlot(TTreeReader *r, unsigned int slot)
 {
    R__ASSERT(fConcreteCustomColumn != nullptr);
@@ -48,3 +56,21 @@ void RJittedCustomColumn::InitNode()
    R__ASSERT(fConcreteCustomColumn != nullptr);
    fConcreteCustomColumn->InitNode();
 }
+
+std::string RJittedCustomColumn::GetSignature(const RDFInternal::NodeId_t &nodeId) const
+{
+   R__ASSERT(fConcreteCustomColumn != nullptr);
+   return fConcreteCustomColumn->GetSignature(nodeId);
+}
+
+void RJittedCustomColumn::SetEquivalentColumn(RCustomColumnBase *column)
+{
+   R__ASSERT(fConcreteCustomColumn != nullptr);
+   fConcreteCustomColumn->SetEquivalentColumn(column);
+}
+
+const RDFInternal::RNodeProfiler &RJittedCustomColumn::GetProfiler() const
+{
+   // nothing to profile if the column has not been jitted yet
+   return fConcreteCustomColumn ? fConcreteCustomColumn->GetProfiler() : fProfiler;
+}
@@ -95,6 +95,24 @@ void RJittedFilter::ClearTask(unsigned int slot)
    fConcreteFilter->ClearTask(slot);
 }
 
+std::string RJittedFilter::GetSignature(const RDFInternal::NodeId_t &nodeId) const
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetSignature(nodeId);
+}
+
+void RJittedFilter::SetEquivalentFilter(RFilterBase *filter)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   fConcreteFilter->SetEquivalentFilter(filter);
+}
+
+const RDFInternal::RNodeProfiler &RJittedFilter::GetProfiler() const
+{
+   // nothing to profile if the filter has not been jitted yet
+   return fConcreteFilter ? fConcreteFilter->GetProfiler() : fProfiler;
+}
+
 void RJittedFilter::InitNode()
 {
    R__ASSERT(fConcreteFilter != nullptr);
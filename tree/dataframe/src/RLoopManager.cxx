@@ -1,3 +1,4 @@
+#include "RConfig.h"    // R__WIN32
 #include "RConfigure.h" // R__USE_IMT
 #include "ROOT/RDF/RActionBase.hxx"
 #include "ROOT/RDF/RCustomColumnBase.hxx"
@@ -8,9 +9,13 @@
 #include "ROOT/TTreeProcessorMT.hxx"
 #include "RtypesCore.h" // Long64_t
 #include "TBranchElement.h"
+#include "TBufferFile.h"
 #include "TBranchObject.h"
+#include "TChain.h"
+#include "TDirectory.h"
 #include "TEntryList.h"
 #include "TError.h"
+#include "TFile.h"
 #include "TInterpreter.h"
 #include "TROOT.h" // IsImplicitMTEnabled
 #include "TTreeReader.h"
@@ -19,11 +24,21 @@
 #include "ROOT/TThreadExecutor.hxx"
 #endif
 
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#endif
+
+#include <algorithm>
 #include <atomic>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 using namespace ROOT::Detail::RDF;
@@ -185,6 +200,55 @@ ColumnNames_t ROOT::Internal::RDF::GetBranchNames(TTree &t, bool allowDuplicates
    return bNames;
 }
 
+/// The global entry number of the first entry of each cluster of a tree or chain, followed by the number of entries
+static std::vector<ULong64_t> GetClusterBoundaries(TTree &tree)
+{
+   std::vector<ULong64_t> boundaries;
+   const auto nEntries = tree.GetEntries();
+   Long64_t entry = 0;
+   while (entry < nEntries) {
+      // for chains, this loads the tree that contains the entry
+      const auto localEntry = tree.LoadTree(entry);
+      if (localEntry < 0)
+         throw std::runtime_error("RDataFrame: cannot load entry " + std::to_string(entry) + " of tree " +
+                                  tree.GetName());
+      auto t = tree.GetTree();
+      const auto offset = entry - localEntry;
+      const auto entries = t->GetEntries();
+      auto clusterIter = t->GetClusterIterator(localEntry);
+      Long64_t start = 0;
+      while ((start = clusterIter()) < entries)
+         boundaries.emplace_back(start + offset);
+      entry = offset + entries;
+   }
+   boundaries.emplace_back(nEntries);
+   return boundaries;
+}
+
+/// A chain over the same files and tree as the given tree or chain, for the workers of multi-process event loops.
+/// The files opened before the fork share their file offsets with the parent and the other workers: each worker must
+/// read through files opened by itself, as the workers of TTreeProcessorMP do.
+static std::unique_ptr<TChain> MakeWorkerChain(TTree &tree)
+{
+   if (auto inChain = dynamic_cast<TChain *>(&tree)) {
+      auto chain = std::make_unique<TChain>(inChain->GetName());
+      // the name of a chain element is the name of the tree, its title the name of the file
+      for (auto element : *inChain->GetListOfFiles())
+         chain->AddFile(element->GetTitle(), TTree::kMaxEntries, element->GetName());
+      return chain;
+   }
+
+   // the path of the tree inside its file, e.g. "dir/tree" for a tree in "file.root:/dir"
+   std::string treePath = tree.GetName();
+   const std::string dirPath = tree.GetDirectory()->GetPath();
+   const auto dirInFile = dirPath.substr(dirPath.find(":/") + 2);
+   if (!dirInFile.empty())
+      treePath = dirInFile + "/" + treePath;
+   auto chain = std::make_unique<TChain>(tree.GetName());
+   chain->AddFile(tree.GetCurrentFile()->GetName(), TTree::kMaxEntries, treePath.c_str());
+   return chain;
+}
+
 
 RLoopManager::RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches)
    : fTree(std::shared_ptr<TTree>(tree, [](TTree *) {})), fDefaultColumns(defaultBranches),
@@ -232,12 +296,15 @@ void RLoopManager::RunEmptySourceMT()
 #ifdef R__USE_IMT
    RSlotStack slotStack(fNSlots);
    // Working with an empty tree.
-   // Evenly partition the entries according to fNSlots. Produce around 2 tasks per slot.
-   const auto nEntriesPerSlot = fNEmptyEntries / (fNSlots * 2);
-   auto remainder = fNEmptyEntries % (fNSlots * 2);
+   // Evenly partition the entries that ranges let through according to fNSlots. Produce around 2 tasks per slot.
+   const auto window = GetEntryWindow();
+   const auto stop = std::min(window.second, fNEmptyEntries);
+   const auto nEntries = stop > window.first ? stop - window.first : 0ull;
+   const auto nEntriesPerSlot = nEntries / (fNSlots * 2);
+   auto remainder = nEntries % (fNSlots * 2);
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   ULong64_t start = 0;
-   while (start < fNEmptyEntries) {
+   ULong64_t start = window.first;
+   while (start < stop) {
       ULong64_t end = start + nEntriesPerSlot;
       if (remainder > 0) {
          ++end;
@@ -283,9 +350,20 @@ void RLoopManager::RunTreeProcessorMT()
    const auto &entryList = fTree->GetEntryList() ? *fTree->GetEntryList() : TEntryList();
    auto tp = std::make_unique<ROOT::TTreeProcessorMT>(*fTree, entryList);
 
+   // Ranges rely on global entry numbers, and clusters outside of the entries they let through are skipped
+   const bool hasRanges = !fBookedRanges.empty();
+   if (hasRanges) {
+      if (fTree->GetEntryList())
+         throw std::runtime_error("Range: multi-thread event loops do not support ranges together with entry lists.");
+      const auto window = GetEntryWindow();
+      const auto stop = window.second == std::numeric_limits<ULong64_t>::max() ? std::numeric_limits<Long64_t>::max()
+                                                                               : Long64_t(window.second);
+      tp->SetEntriesRange(window.first, stop);
+   }
+
    std::atomic<ULong64_t> entryCount(0ull);
 
-   tp->Process([this, &slotStack, &entryCount](TTreeReader &r) -> void {
+   tp->Process([this, &slotStack, &entryCount, hasRanges](TTreeReader &r) -> void {
       auto slot = slotStack.GetSlot();
       InitNodeSlots(&r, slot);
       const auto entryRange = r.GetEntriesRange(); // we trust TTreeProcessorMT to call SetEntriesRange
@@ -293,7 +371,7 @@ void RLoopManager::RunTreeProcessorMT()
       auto count = entryCount.fetch_add(nEntries);
       // recursive call to check filters and conditionally execute actions
       while (r.Next()) {
-         RunAndCheckFilters(slot, count++);
+         RunAndCheckFilters(slot, hasRanges ? r.GetCurrentEntry() : count++);
       }
       CleanUpTask(slot);
       slotStack.ReturnSlot(slot);
@@ -366,9 +444,22 @@ void RLoopManager::RunDataSourceMT()
       slotStack.ReturnSlot(slot);
    };
 
+   // entry ranges of the data source that do not overlap with the entries selected by ranges are skipped
+   const auto window = GetEntryWindow();
+   auto clipToWindow = [&window](std::vector<std::pair<ULong64_t, ULong64_t>> &ranges) {
+      std::vector<std::pair<ULong64_t, ULong64_t>> clipped;
+      for (const auto &range : ranges) {
+         if (range.second <= window.first || range.first >= window.second)
+            continue;
+         clipped.emplace_back(std::max(range.first, window.first), std::min(range.second, window.second));
+      }
+      std::swap(ranges, clipped);
+   };
+
    fDataSource->Initialise();
    auto ranges = fDataSource->GetEntryRanges();
    while (!ranges.empty()) {
+      clipToWindow(ranges);
       pool.Foreach(runOnRange, ranges);
       ranges = fDataSource->GetEntryRanges();
    }
@@ -376,6 +467,117 @@ void RLoopManager::RunDataSourceMT()
 #endif // not implemented otherwise (never called)
 }
 
+/// Multi-process event loops run the computation graph in other processes, so that some of its features are not
+/// available. Throws before any node is initialized.
+void RLoopManager::CheckRunMP()
+{
+#ifdef R__WIN32
+   throw std::runtime_error("RDataFrame: multi-process event loops are not supported on Windows.");
+#else
+   if (ROOT::IsImplicitMTEnabled()) {
+      throw std::runtime_error("RDataFrame: multi-process event loops cannot fork worker processes while implicit "
+                               "multi-threading is enabled. Call ROOT::DisableImplicitMT() first.");
+   }
+   if (fDataSource)
+      throw std::runtime_error("RDataFrame: multi-process event loops are not supported for data sources.");
+   if (!fBookedRanges.empty())
+      throw std::runtime_error("RDataFrame: multi-process event loops do not support Range.");
+   if (!fCallbacks.empty() || !fCallbacksOnce.empty())
+      throw std::runtime_error("RDataFrame: multi-process event loops do not support callbacks.");
+   if (fProfile)
+      throw std::runtime_error("RDataFrame: multi-process event loops do not support profiling.");
+   if (fTree && fTree->GetEntryList())
+      throw std::runtime_error("RDataFrame: multi-process event loops do not support entry lists.");
+   if (fTree && fTree->GetListOfFriends() && fTree->GetListOfFriends()->GetEntries() > 0)
+      throw std::runtime_error("RDataFrame: multi-process event loops do not support friend trees.");
+   for (auto actionPtr : fBookedActions) {
+      if (!actionPtr->CanMergeResults()) {
+         throw std::runtime_error("RDataFrame: the results of one of the booked actions cannot be merged across "
+                                  "processes. Multi-process event loops support Count, Sum, Min, Max, Mean, Fill, "
+                                  "Histo1D/2D/3D, Profile1D/2D and Take.");
+      }
+   }
+#endif
+}
+
+/// Run the event loop in fNProcesses worker processes forked from this one.
+/// The entries are partitioned in contiguous ranges, whose boundaries are cluster boundaries of the input tree, one
+/// per worker. Each worker runs the computation graph on its range in sequence, finalizes the actions and sends
+/// their results back. The results are merged here, in the order of the entries, before the actions are finalized.
+void RLoopManager::RunMP()
+{
+#ifndef R__WIN32
+   std::vector<std::pair<ULong64_t, ULong64_t>> partitions;
+   const auto boundaries = fTree ? GetClusterBoundaries(*fTree) : std::vector<ULong64_t>{0ull, fNEmptyEntries};
+   const auto nEntries = boundaries.back();
+   ULong64_t start = 0;
+   for (ULong64_t i = 1; i <= fNProcesses && start < nEntries; ++i) {
+      const auto target = nEntries * i / fNProcesses;
+      // without a tree there are no clusters: any entry can start a partition
+      const auto end = fTree ? *std::lower_bound(boundaries.begin(), boundaries.end(), target) : target;
+      if (end > start) {
+         partitions.emplace_back(start, end);
+         start = end;
+      }
+   }
+   if (partitions.empty())
+      return;
+
+   const auto actions = fBookedActions;
+   auto runPartition = [this, &partitions, &actions](unsigned int idx) {
+      RunPartition(partitions[idx].first, partitions[idx].second);
+      CleanUpNodes();
+      TBufferFile buf(TBuffer::kWrite);
+      buf << idx;
+      for (auto actionPtr : actions)
+         actionPtr->SerializeResult(buf);
+      return std::string(buf.Buffer(), buf.Length());
+   };
+
+   std::vector<unsigned int> partitionIds(partitions.size());
+   std::iota(partitionIds.begin(), partitionIds.end(), 0u);
+   ROOT::TProcessExecutor pool(partitions.size());
+   auto results = pool.Map(runPartition, partitionIds);
+   if (results.size() != partitions.size()) {
+      throw std::runtime_error("RDataFrame: " + std::to_string(partitions.size() - results.size()) + " out of " +
+                               std::to_string(partitions.size()) + " worker processes failed.");
+   }
+
+   // results are received in order of completion
+   std::vector<std::unique_ptr<TBufferFile>> buffers(results.size());
+   for (auto &result : results) {
+      auto buf = std::make_unique<TBufferFile>(TBuffer::kRead, result.size(), &result[0], false);
+      unsigned int idx = 0;
+      *buf >> idx;
+      buffers[idx] = std::move(buf);
+   }
+   for (auto &buf : buffers) {
+      for (auto actionPtr : actions)
+         actionPtr->MergeResult(*buf);
+   }
+#endif // not implemented otherwise (never called)
+}
+
+/// Run the event loop on the entries [begin, end) in sequence, in a worker process of a multi-process event loop.
+/// Trees stored in files are read through a chain that reopens the files in this process.
+void RLoopManager::RunPartition(ULong64_t begin, ULong64_t end)
+{
+   if (fTree) {
+      const auto chain = fTree->GetCurrentFile() ? MakeWorkerChain(*fTree) : nullptr;
+      TTreeReader r(chain ? chain.get() : fTree.get());
+      r.SetEntriesRange(begin, end);
+      InitNodeSlots(&r, 0u);
+      while (r.Next())
+         RunAndCheckFilters(0u, r.GetCurrentEntry());
+      CleanUpTask(0u);
+   } else {
+      InitNodeSlots(nullptr, 0u);
+      for (auto entry = begin; entry < end; ++entry)
+         RunAndCheckFilters(0u, entry);
+      CleanUpTask(0u);
+   }
+}
+
 /// Execute actions and make sure named filters are called for each event.
 /// Named filters must be called even if the analysis logic would not require it, lest they report confusing results.
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
@@ -388,6 +590,26 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       callback(slot);
 }
 
+/// In multi-thread event loops, the range [first, second) of global entry numbers that can reach any node of the
+/// computation graph. If all the children of the RLoopManager are ranges, entries outside of the ranges need not be
+/// read at all. second is the maximum ULong64_t value if the window is open-ended.
+std::pair<ULong64_t, ULong64_t> RLoopManager::GetEntryWindow() const
+{
+   const auto kAll = std::numeric_limits<ULong64_t>::max();
+   unsigned int nHeadRanges = 0;
+   std::pair<ULong64_t, ULong64_t> window{kAll, 0ull};
+   for (auto range : fBookedRanges) {
+      if (!range->IsHeadRange() || !range->HasChildren())
+         continue;
+      ++nHeadRanges;
+      window.first = std::min<ULong64_t>(window.first, range->GetStart());
+      window.second = (range->GetStop() == 0) ? kAll : std::max<ULong64_t>(window.second, range->GetStop());
+   }
+   if (nHeadRanges == 0 || nHeadRanges < fNChildren)
+      return {0ull, kAll};
+   return window;
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitRDFValues` methods. It is called once per node per slot, before
@@ -403,6 +625,98 @@ void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
       callback(slot);
 }
 
+/// Make every Filter and custom column evaluate its own expression again, undoing OptimizeGraph.
+void RLoopManager::ClearEquivalentNodes()
+{
+   for (auto &ptr : fBookedFilters)
+      ptr->SetEquivalentFilter(nullptr);
+   for (auto column : fCustomColumns)
+      column->SetEquivalentColumn(nullptr);
+}
+
+/// Deduplicate the custom columns and the Filters that are guaranteed to compute the same values, see
+/// RInterface::SetGraphOptimization. Nodes are visited in booking order, so that the inputs and previous nodes of a
+/// node have been deduplicated before its signature is computed; a node whose signature matches the one of an earlier
+/// node reuses the per-entry results of the latter. Common sub-filters are hoisted this way: the Filters further down
+/// two equivalent chains of Filters are equivalent in turn.
+void RLoopManager::OptimizeGraph()
+{
+   std::unordered_map<const void *, const void *> equivalentNodes;
+   auto nodeId = [&equivalentNodes](const void *node) {
+      const auto it = equivalentNodes.find(node);
+      return std::to_string(reinterpret_cast<std::uintptr_t>(it == equivalentNodes.end() ? node : it->second));
+   };
+
+   std::unordered_map<std::string, RCustomColumnBase *> columnsBySignature;
+   for (auto column : fCustomColumns) {
+      const auto signature = column->GetSignature(nodeId);
+      if (signature.empty())
+         continue;
+      const auto canonical = columnsBySignature.emplace(signature, column).first->second;
+      if (canonical != column) {
+         column->SetEquivalentColumn(canonical);
+         equivalentNodes[column] = canonical;
+      }
+   }
+
+   std::unordered_map<std::string, RFilterBase *> filtersBySignature;
+   for (auto filter : fBookedFilters) {
+      const auto signature = filter->GetSignature(nodeId);
+      if (signature.empty())
+         continue;
+      const auto canonical = filtersBySignature.emplace(signature, filter).first->second;
+      if (canonical != filter) {
+         filter->SetEquivalentFilter(canonical);
+         equivalentNodes[static_cast<RNodeBase *>(filter)] = static_cast<RNodeBase *>(canonical);
+      }
+   }
+}
+
+/// Collect the profiles of all nodes that took part in the event loop that just ran, see RInterface::SetProfiling.
+/// Data-source columns are reported as column readers, like TTree branches.
+void RLoopManager::FillProfileReport()
+{
+   fProfileReport = ROOT::RDF::RProfileReport();
+   for (auto column : fCustomColumns) {
+      const auto kind = column->IsDataSourceColumn() ? "Column" : "Define";
+      fProfileReport.AddNode(column->GetProfiler().GetProfile(kind, column->GetName()));
+   }
+   for (auto filter : fBookedFilters) {
+      const auto name = filter->HasName() ? filter->GetName() : "Unnamed Filter";
+      fProfileReport.AddNode(filter->GetProfiler().GetProfile("Filter", name));
+   }
+   for (auto action : fBookedActions)
+      fProfileReport.AddNode(action->GetProfiler().GetProfile("Action", action->GetActionName()));
+   for (auto &column : fColumnProfilers)
+      fProfileReport.AddNode(column.second->GetProfile("Column", column.first));
+}
+
+/// Return the profilers of the readers of the given input columns of a node, creating them on first use: nullptr for
+/// custom columns, which are profiled by their own node. Return an empty vector if the event loop is not profiled.
+std::vector<RDFInternal::RNodeProfiler *>
+RLoopManager::GetColumnProfilers(const ColumnNames_t &columns, const RDFInternal::RBookedCustomColumns &customColumns)
+{
+   std::vector<RDFInternal::RNodeProfiler *> profilers;
+   if (fProfileSlots.empty())
+      return profilers;
+   std::lock_guard<std::mutex> lock(fColumnProfilersMutex);
+   for (const auto &column : columns) {
+      if (customColumns.HasName(column)) {
+         profilers.emplace_back(nullptr);
+         continue;
+      }
+      auto &profiler = fColumnProfilers[column];
+      if (!profiler) {
+         profiler = std::make_unique<RDFInternal::RNodeProfiler>();
+         profiler->Reset(fNSlots);
+         for (auto slot = 0u; slot < fNSlots; ++slot)
+            profiler->InitSlot(slot, &fProfileSlots[slot]);
+      }
+      profilers.emplace_back(profiler.get());
+   }
+   return profilers;
+}
+
 /// Initialize all nodes of the functional graph before running the event loop.
 /// This method is called once per event-loop and performs generic initialization
 /// operations that do not depend on the specific processing slot (i.e. operations
@@ -442,6 +756,9 @@ void RLoopManager::CleanUpNodes()
 
    fCallbacks.clear();
    fCallbacksOnce.clear();
+
+   // nodes might be deleted before the next event loop
+   ClearEquivalentNodes();
 }
 
 /// Perform clean-up operations. To be called at the end of each task execution.
@@ -476,6 +793,28 @@ void RLoopManager::Jit()
    fToJitExec.clear();
 }
 
+/// Jit the nodes of several computation graphs with one interpreter call for all declarations and one for all
+/// executions, e.g. before running their event loops concurrently (see RunGraphs): the interpreter must not be
+/// invoked concurrently, and each invocation has a fixed cost.
+void RLoopManager::JitGraphs(const std::vector<RLoopManager *> &loopManagers)
+{
+   std::string toJitDeclare;
+   std::string toJitExec;
+   for (auto lm : loopManagers) {
+      toJitDeclare.append(lm->fToJitDeclare);
+      toJitExec.append(lm->fToJitExec);
+   }
+   // as in Jit, the code is only dropped once the interpreter has accepted it
+   if (!toJitDeclare.empty())
+      RDFInternal::InterpreterDeclare(toJitDeclare);
+   for (auto lm : loopManagers)
+      lm->fToJitDeclare.clear();
+   if (!toJitExec.empty())
+      RDFInternal::InterpreterCalc(toJitExec, "RunGraphs");
+   for (auto lm : loopManagers)
+      lm->fToJitExec.clear();
+}
+
 /// Trigger counting of number of children nodes for each node of the functional graph.
 /// This is done once before starting the event loop. Each action sends an `increase children count` signal
 /// upstream, which is propagated until RLoopManager. Each time a node receives the signal, in increments its
@@ -503,20 +842,51 @@ void RLoopManager::Run()
 {
    Jit();
 
+   const bool runMP = fNProcesses > 1;
+   if (runMP)
+      CheckRunMP();
+
+   // also if the previous event loop threw before cleaning up, or graph optimization was switched off since then
+   ClearEquivalentNodes();
+   if (fOptimizeGraph)
+      OptimizeGraph();
    InitNodes();
 
-   switch (fLoopType) {
-   case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
-   case ELoopType::kROOTFilesMT: RunTreeProcessorMT(); break;
-   case ELoopType::kDataSourceMT: RunDataSourceMT(); break;
-   case ELoopType::kNoFiles: RunEmptySource(); break;
-   case ELoopType::kROOTFiles: RunTreeReader(); break;
-   case ELoopType::kDataSource: RunDataSource(); break;
+   fColumnProfilers.clear();
+   if (fProfile)
+      fProfileSlots = std::vector<RDFInternal::RProfileSlot>(fNSlots);
+   else
+      fProfileSlots.clear();
+
+   if (runMP) {
+      RunMP();
+   } else {
+      switch (fLoopType) {
+      case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
+      case ELoopType::kROOTFilesMT: RunTreeProcessorMT(); break;
+      case ELoopType::kDataSourceMT: RunDataSourceMT(); break;
+      case ELoopType::kNoFiles: RunEmptySource(); break;
+      case ELoopType::kROOTFiles: RunTreeReader(); break;
+      case ELoopType::kDataSource: RunDataSource(); break;
+      }
    }
 
+   if (fProfile)
+      FillProfileReport();
+   fProfileSlots.clear();
    CleanUpNodes();
 }
 
+bool RLoopManager::IsMultiThreaded() const
+{
+   switch (fLoopType) {
+   case ELoopType::kNoFilesMT:
+   case ELoopType::kROOTFilesMT:
+   case ELoopType::kDataSourceMT: return true;
+   default: return false;
+   }
+}
+
 /// Return the list of default columns -- empty if none was provided when constructing the RDataFrame
 const ColumnNames_t &RLoopManager::GetDefaultColumnNames() const
 {
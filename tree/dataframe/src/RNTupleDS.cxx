@@ -13,12 +13,17 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RField.hxx>
 #include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleDS.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageStorage.hxx>
 #include <ROOT/RStringView.hxx>
 
 #include <TError.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -27,18 +32,31 @@
 namespace ROOT {
 namespace Experimental {
 
-ROOT::Experimental::RNTupleDS::RNTupleDS(std::unique_ptr<ROOT::Experimental::RNTupleReader> ntuple)
+ROOT::Experimental::RNTupleDS::RNTupleDS(std::unique_ptr<Detail::RPageSource> pageSource)
+   : fPrincipalSource(std::move(pageSource))
 {
-   fReaders.emplace_back(std::move(ntuple));
-   auto rootField = fReaders[0]->GetModel()->GetRootField();
+   fPrincipalSource->Attach();
+   fPrincipalModel = fPrincipalSource->GetDescriptor().GenerateModel();
+   auto rootField = fPrincipalModel->GetRootField();
    for (auto &f : *rootField) {
       if (f.GetParent() != rootField)
          continue;
       fColumnNames.push_back(f.GetName());
       fColumnTypes.push_back(f.GetType());
+      fPrincipalFields.push_back(&f);
    }
 }
 
+
+ROOT::Experimental::RNTupleDS::RNTupleDS(std::unique_ptr<RNTupleReader> ntuple)
+   : RNTupleDS(ntuple->fSource->Clone())
+{
+}
+
+
+RNTupleDS::~RNTupleDS() = default;
+
+
 const std::vector<std::string>& RNTupleDS::GetColumnNames() const
 {
    return fColumnNames;
@@ -47,11 +65,17 @@ const std::vector<std::string>& RNTupleDS::GetColumnNames() const
 
 RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view name, const std::type_info& /* ti */)
 {
-   const auto index = std::distance(
+   const std::size_t index = std::distance(
       fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), name));
    // TODO(jblomer): check expected type info like in, e.g., RRootDS.cxx
    // There is a problem extracting the type info for std::int32_t and company though
 
+   if (std::find(fActiveColumns.begin(), fActiveColumns.end(), index) == fActiveColumns.end()) {
+      fActiveColumns.emplace_back(index);
+      fHasNewActiveColumns = true;
+   }
+
+   // The value pointers are set once the slot readers are created in Initialise()
    std::vector<void*> ptrs;
    for (unsigned i = 0; i < fNSlots; ++i)
       ptrs.push_back(&fValuePtrs[i][index]);
@@ -61,28 +85,30 @@ RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view name
 
 bool RNTupleDS::SetEntry(unsigned int slot, ULong64_t entryIndex)
 {
-   fReaders[slot]->LoadEntry(entryIndex, fEntries[slot].get());
+   fReaders[slot]->LoadEntry(entryIndex);
    return true;
 }
 
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
-   // TODO(jblomer): use cluster boundaries for the entry ranges
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
    if (fHasSeenAllRanges) return ranges;
 
-   auto nEntries = fReaders[0]->GetNEntries();
-   const auto chunkSize = nEntries / fNSlots;
-   const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
-   auto start = 0UL;
-   auto end = 0UL;
-   for (auto i : ROOT::TSeqU(fNSlots)) {
-      start = end;
-      end += chunkSize;
-      ranges.emplace_back(start, end);
-      (void)i;
+   // Ranges never split a cluster, so that every cluster is read and decompressed by a single slot.  In order to
+   // balance the load, consecutive clusters are merged into about twice as many ranges as there are slots.
+   const auto &descriptor = fPrincipalSource->GetDescriptor();
+   const auto nEntries = descriptor.GetNEntries();
+   const auto minRangeSize = nEntries / (2 * fNSlots);
+   // Cluster ids are issued sequentially in the order of the entries
+   for (DescriptorId_t clusterId = 0; clusterId < descriptor.GetNClusters(); ++clusterId) {
+      const auto &clusterDesc = descriptor.GetClusterDescriptor(clusterId);
+      const ULong64_t start = clusterDesc.GetFirstEntryIndex();
+      const ULong64_t end = start + clusterDesc.GetNEntries();
+      if (!ranges.empty() && (ranges.back().second - ranges.back().first < minRangeSize))
+         ranges.back().second = end;
+      else
+         ranges.emplace_back(start, end);
    }
-   ranges.back().second += reminder;
    fHasSeenAllRanges = true;
    return ranges;
 }
@@ -103,9 +129,31 @@ bool RNTupleDS::HasColumn(std::string_view colName) const
 }
 
 
+void RNTupleDS::CreateReaders()
+{
+   fReaders.clear();
+   for (unsigned int i = 0; i < fNSlots; ++i) {
+      auto model = RNTupleModel::Create();
+      for (auto index : fActiveColumns) {
+         model->AddField(
+            std::unique_ptr<Detail::RFieldBase>(fPrincipalFields[index]->Clone(fColumnNames[index])));
+      }
+      // Every slot has its own page source, and thus its own page pool and cluster pool
+      auto reader = std::make_unique<RNTupleReader>(std::move(model), fPrincipalSource->Clone());
+      auto entry = reader->GetModel()->GetDefaultEntry();
+      for (auto index : fActiveColumns)
+         fValuePtrs[i][index] = entry->GetValue(fColumnNames[index]).GetRawPtr();
+      fReaders.emplace_back(std::move(reader));
+   }
+   fHasNewActiveColumns = false;
+}
+
+
 void RNTupleDS::Initialise()
 {
    fHasSeenAllRanges = false;
+   if (fReaders.empty() || fHasNewActiveColumns)
+      CreateReaders();
 }
 
 
@@ -114,26 +162,13 @@ void RNTupleDS::SetNSlots(unsigned int nSlots)
    R__ASSERT(fNSlots == 0);
    R__ASSERT(nSlots > 0);
    fNSlots = nSlots;
-
-   for (unsigned int i = 1; i < fNSlots; ++i) {
-      fReaders.emplace_back(fReaders[0]->Clone());
-   }
-
-   for (unsigned int i = 0; i < fNSlots; ++i) {
-      auto entry = fReaders[i]->GetModel()->CreateEntry();
-      fValuePtrs.emplace_back(std::vector<void*>());
-      for (unsigned j = 0; j < fColumnNames.size(); ++j) {
-         fValuePtrs[i].emplace_back(entry->GetValue(fColumnNames[j]).GetRawPtr());
-      }
-      fEntries.emplace_back(std::move(entry));
-   }
+   fValuePtrs.assign(fNSlots, std::vector<void*>(fColumnNames.size(), nullptr));
 }
 
 
 RDataFrame MakeNTupleDataFrame(std::string_view ntupleName, std::string_view fileName)
 {
-   auto ntuple = RNTupleReader::Open(ntupleName, fileName);
-   ROOT::RDataFrame rdf(std::make_unique<RNTupleDS>(std::move(ntuple)));
+   ROOT::RDataFrame rdf(std::make_unique<RNTupleDS>(Detail::RPageSource::Create(ntupleName, fileName)));
    return rdf;
 }
 
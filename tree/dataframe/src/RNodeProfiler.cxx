@@ -0,0 +1,70 @@
+// Author: The ROOT Team  10/2026
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RNodeProfiler.hxx"
+#include "TBranch.h"
+#include "TTree.h"
+#include "TTreeReader.h"
+
+#include <chrono>
+#include <cstdio> // snprintf
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+ULong64_t RBranchReadTracker::Update(TTreeReader &reader, const char *branchName)
+{
+   auto chain = reader.GetTree();
+   if (!chain)
+      return 0;
+   // the tree of the current file if reading a TChain
+   auto tree = chain->GetTree();
+   if (tree != fTree) {
+      fTree = tree;
+      fBranch = tree ? tree->FindBranch(branchName) : nullptr;
+      fBasket = -1;
+   }
+   if (!fBranch)
+      return 0;
+   const auto basket = fBranch->GetReadBasket();
+   if (basket == fBasket || basket < 0 || basket >= fBranch->GetMaxBaskets())
+      return 0;
+   fBasket = basket;
+   return fBranch->GetBasketBytes()[basket];
+}
+
+ROOT::RDF::RNodeProfile RNodeProfiler::GetProfile(const std::string &kind, const std::string &name) const
+{
+   std::chrono::steady_clock::duration time{0};
+   ULong64_t entries = 0;
+   ULong64_t bytesRead = 0;
+   for (const auto &counters : fCounters) {
+      time += counters.fTime;
+      entries += counters.fEntries;
+      bytesRead += counters.fBytesRead;
+   }
+   const auto seconds = std::chrono::duration_cast<std::chrono::duration<double>>(time).count();
+   return ROOT::RDF::RNodeProfile(kind, name, seconds, entries, bytesRead);
+}
+
+std::string RNodeProfiler::GetLabel() const
+{
+   const auto profile = GetProfile("", "");
+   if (profile.GetEntries() == 0)
+      return "";
+   char label[64];
+   snprintf(label, sizeof(label), "\n%.3g s wall, %llu entries", profile.GetWallTime(), profile.GetEntries());
+   return label;
+}
+
+} // End NS RDF
+} // End NS Internal
+} // End NS ROOT
@@ -0,0 +1,79 @@
+// Author: The ROOT Team  10/2026
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "TString.h" // Printf, Form
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+std::string EscapeJSON(const std::string &s)
+{
+   std::string escaped;
+   for (const auto c : s) {
+      switch (c) {
+      case '"': escaped += "\\\""; break;
+      case '\\': escaped += "\\\\"; break;
+      case '\n': escaped += "\\n"; break;
+      case '\t': escaped += "\\t"; break;
+      default: escaped += c;
+      }
+   }
+   return escaped;
+}
+} // anonymous namespace
+
+namespace ROOT {
+
+namespace RDF {
+
+void RProfileReport::Print() const
+{
+   Printf("%-8s %-30s %12s %12s %14s %14s", "Kind", "Name", "Wall time [s]", "Entries", "Entries/s", "Bytes read");
+   for (const auto &p : fProfiles) {
+      Printf("%-8s %-30s %12.6f %12lld %14.1f %14lld", p.GetKind().c_str(), p.GetName().c_str(), p.GetWallTime(),
+             p.GetEntries(), p.GetThroughput(), p.GetBytesRead());
+   }
+}
+
+std::string RProfileReport::AsJSON() const
+{
+   std::string json = "[";
+   for (const auto &p : fProfiles) {
+      if (json.size() > 1)
+         json += ",";
+      json += Form("\n  {\"kind\": \"%s\", \"name\": \"%s\", \"wallTime\": %.9g, \"entries\": %lld, "
+                   "\"bytesRead\": %lld}",
+                   EscapeJSON(p.GetKind()).c_str(), EscapeJSON(p.GetName()).c_str(), p.GetWallTime(), p.GetEntries(),
+                   p.GetBytesRead());
+   }
+   json += "\n]";
+   return json;
+}
+
+const RNodeProfile &RProfileReport::At(std::string_view kind, std::string_view name) const
+{
+   auto pred = [&](const RNodeProfile &p) { return p.GetKind() == kind && p.GetName() == name; };
+   const auto it = std::find_if(fProfiles.begin(), fProfiles.end(), pred);
+   if (it == fProfiles.end()) {
+      std::string err = "Cannot find a profiled node of kind \"";
+      err += kind;
+      err += "\" called \"";
+      err += name;
+      err += "\".";
+      throw std::runtime_error(err);
+   }
+   return *it;
+}
+
+} // End NS RDF
+
+} // End NS ROOT
@@ -8,14 +8,17 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
+#include "TError.h" // R__ASSERT
 
 using ROOT::Detail::RDF::RRangeBase;
 using ROOT::Detail::RDF::RLoopManager;
 
 RRangeBase::RRangeBase(RLoopManager *implPtr, unsigned int start, unsigned int stop, unsigned int stride,
                        const unsigned int nSlots)
-   : RNodeBase(implPtr), fStart(start), fStop(stop), fStride(stride), fNSlots(nSlots) { }
+   : RNodeBase(implPtr), fStart(start), fStop(stop), fStride(stride), fNSlots(nSlots),
+     fIsMT(implPtr->IsMultiThreaded()) { }
 
 void RRangeBase::ResetCounters()
 {
@@ -26,3 +29,11 @@ void RRangeBase::ResetCounters()
 
 // outlined to pin virtual table
 RRangeBase::~RRangeBase() { }
+
+ULong64_t ROOT::Internal::RDF::GetEntryRank(ROOT::Detail::RDF::RNodeBase &node, Long64_t entry)
+{
+   if (auto range = dynamic_cast<RRangeBase *>(&node))
+      return range->GetEntryRank(entry);
+   R__ASSERT(dynamic_cast<RLoopManager *>(&node) != nullptr);
+   return entry + 1;
+}
@@ -4,10 +4,14 @@
 #include "TH1F.h"
 #include "TRandom.h"
 #include "TSystem.h"
+#include "TTree.h"
 
 #include "gtest/gtest.h"
 
 #include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
 
 using namespace ROOT::RDF;
 using namespace ROOT::VecOps;
@@ -224,6 +228,94 @@ TEST(Cache, evtCounter)
 
 }
 
+TEST(Cache, Persistent)
+{
+   const auto cacheDir = "dataframe_cache_persistent";
+   RCacheOptions opts(cacheDir);
+   auto nCalls = 0u;
+   auto countCalls = [&nCalls](ULong64_t e) {
+      ++nCalls;
+      return e % 2 == 0;
+   };
+   auto cacheAndSum = [&]() {
+      ROOT::RDataFrame tdf(10);
+      auto cached = tdf.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                       .Filter(countCalls, {"rdfentry_"}, "evens")
+                       .Cache<double>({"x"}, opts);
+      return *cached.Sum<double>("x");
+   };
+
+   // the first run fills the cache, the second one reads it without running the filter again
+   EXPECT_DOUBLE_EQ(20., cacheAndSum());
+   EXPECT_EQ(10u, nCalls);
+   EXPECT_DOUBLE_EQ(20., cacheAndSum());
+   EXPECT_EQ(10u, nCalls);
+
+   // a different tag invalidates the cache
+   opts.fTag = "v2";
+   EXPECT_DOUBLE_EQ(20., cacheAndSum());
+   EXPECT_EQ(20u, nCalls);
+
+   // so does a different input dataset
+   ROOT::RDataFrame tdf(20);
+   auto cached = tdf.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                    .Filter(countCalls, {"rdfentry_"}, "evens")
+                    .Cache<double>({"x"}, opts);
+   EXPECT_DOUBLE_EQ(90., *cached.Sum<double>("x"));
+   EXPECT_EQ(40u, nCalls);
+
+   // Ranges and jitted Filters with different parameters do not share cache files
+   auto cachedRange = [&](unsigned int stop) {
+      return *tdf.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                 .Range(stop)
+                 .Cache<double>({"x"}, opts)
+                 .Count();
+   };
+   EXPECT_EQ(5u, cachedRange(5));
+   EXPECT_EQ(8u, cachedRange(8));
+   auto cachedFilter = [&](const std::string &expr) {
+      return *tdf.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                 .Filter(expr)
+                 .Cache<double>({"x"}, opts)
+                 .Count();
+   };
+   EXPECT_EQ(5u, cachedFilter("x < 5"));
+   EXPECT_EQ(8u, cachedFilter("x < 8"));
+
+   auto dir = gSystem->OpenDirectory(cacheDir);
+   while (auto entry = gSystem->GetDirEntry(dir)) {
+      if (std::string(entry).find("rdfcache_") == 0)
+         gSystem->Unlink((std::string(cacheDir) + "/" + entry).c_str());
+   }
+   gSystem->FreeDirectory(dir);
+   gSystem->Unlink(cacheDir);
+}
+
+TEST(Cache, PersistentUnidentifiableInput)
+{
+   RCacheOptions opts("dataframe_cache_unidentifiable");
+
+   // the key would be the same for every input of the data source type
+   ROOT::RDataFrame dsdf(std::make_unique<RTrivialDS>(4));
+   EXPECT_THROW(dsdf.Cache<ULong64_t>({"col0"}, opts), std::runtime_error);
+
+   // an in-memory tree is only known by its name and number of entries
+   TTree t("t", "t");
+   int x = 0;
+   t.Branch("x", &x);
+   t.Fill();
+   ROOT::RDataFrame treedf(t);
+   EXPECT_THROW(treedf.Cache<int>({"x"}, opts), std::runtime_error);
+   EXPECT_TRUE(gSystem->AccessPathName("dataframe_cache_unidentifiable"));
+}
+
+TEST(Cache, PersistentInMemoryFallback)
+{
+   ROOT::RDataFrame tdf(4);
+   auto cached = tdf.Define("x", []() { return 42; }).Cache<int>({"x"}, RCacheOptions());
+   EXPECT_EQ(168, *cached.Sum<int>("x"));
+}
+
 #ifdef R__B64
 
 TEST(Cache, Regex)
@@ -275,3 +275,61 @@ TEST(RDFHelpers, SaveGraphToFile)
 
    gSystem->Unlink(outFileName);
 }
+
+TEST(RDFHelpers, RunGraphs)
+{
+   ROOT::RDataFrame df1(10);
+   ROOT::RDataFrame df2(20);
+   auto c1 = df1.Count();
+   auto s1 = df1.Define("x", [] { return 1; }).Sum<int>("x");
+   auto c2 = df2.Filter("rdfentry_ % 2 == 0").Count();
+
+   const auto nGraphs = RunGraphs({c1, s1, c2});
+   EXPECT_EQ(2u, nGraphs);
+   EXPECT_TRUE(c1.IsReady());
+   EXPECT_TRUE(c2.IsReady());
+   EXPECT_EQ(10u, *c1);
+   EXPECT_EQ(10, *s1);
+   EXPECT_EQ(10u, *c2);
+}
+
+TEST(RDFHelpers, RunGraphsSkipsReadyResults)
+{
+   ROOT::RDataFrame df(10);
+   auto c = df.Count();
+   *c;
+   EXPECT_EQ(0u, RunGraphs({c}));
+}
+
+TEST(RDFHelpers, RResultHandle)
+{
+   ROOT::RDataFrame df(10);
+   RResultHandle h = df.Count();
+   EXPECT_FALSE(h.IsReady());
+   EXPECT_EQ(10u, h.GetValue<ULong64_t>());
+   EXPECT_TRUE(h.IsReady());
+   EXPECT_THROW(h.GetValue<int>(), std::runtime_error);
+
+   RResultHandle empty = ROOT::RDF::RResultPtr<ULong64_t>();
+   EXPECT_FALSE(empty.IsReady());
+   EXPECT_THROW(empty.GetValue<ULong64_t>(), std::runtime_error);
+   EXPECT_THROW(RunGraphs({empty}), std::runtime_error);
+}
+
+#ifdef R__USE_IMT
+TEST(RDFHelpers, RunGraphsMT)
+{
+   ROOT::EnableImplicitMT(4);
+   std::vector<ROOT::RDataFrame> dfs;
+   std::vector<RResultPtr<ULong64_t>> counts;
+   for (auto i = 1u; i <= 50u; ++i) {
+      dfs.emplace_back(i * 100);
+      counts.emplace_back(dfs.back().Filter("rdfentry_ % 2 == 0").Count());
+   }
+   std::vector<RResultHandle> handles(counts.begin(), counts.end());
+   EXPECT_EQ(50u, RunGraphs(handles));
+   for (auto i = 1u; i <= 50u; ++i)
+      EXPECT_EQ(i * 50, counts[i - 1].GetValue());
+   ROOT::DisableImplicitMT();
+}
+#endif
@@ -1,5 +1,7 @@
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/RTrivialDS.hxx"
+#include "TEnv.h"
+#include "TInterpreter.h"
 #include "TMemFile.h"
 #include "TSystem.h"
 #include "TTree.h"
@@ -365,4 +367,78 @@ TEST(RDataFrameInterface, DefineAliasedColumn)
    auto r0 = rdf.Define("myVar", [](){return 1;});
    auto r1 = r0.Alias("newVar", "myVar");
    EXPECT_ANY_THROW(r0.Define("newVar", [](int i){return i;}, {"myVar"})) << "No exception thrown when defining a column with a name which is already an alias.";
-}
\ No newline at end of file
+}
+
+TEST(RDataFrameInterface, JitSameExpressionTwice)
+{
+   // lambdas are numbered in order of declaration: the distance between the numbers of two probes is the number of
+   // lambdas declared in between, plus one
+   auto probeCount = 0;
+   auto declareProbe = [&probeCount]() {
+      const auto code = "[]() { return " + std::to_string(++probeCount) + "; }";
+      const auto name = ROOT::Internal::RDF::DeclareLambda(code, "JitSameExpressionTwice probe", {});
+      return std::stoul(name.substr(name.find("lambda") + 6));
+   };
+
+   // the second RDataFrame reuses the code compiled for the expressions of the first one
+   for (auto n : {10u, 20u}) {
+      const auto before = declareProbe();
+      ROOT::RDataFrame df(n);
+      auto d = df.Define("x3", "rdfentry_ * 3");
+      auto c = d.Filter("rdfentry_ * 3 < 15").Count();
+      auto s = d.Filter("rdfentry_ * 3 < 15").Sum<ULong64_t>("x3");
+      EXPECT_EQ(5u, *c);
+      EXPECT_EQ(30u, *s);
+      const auto after = declareProbe();
+      if (n == 10u)
+         EXPECT_EQ(before + 3, after);
+      else
+         EXPECT_EQ(before + 1, after);
+   }
+}
+
+TEST(RDataFrameInterface, JitCacheDir)
+{
+   const std::string dir = "JitCacheDir_" + std::to_string(gSystem->GetPid());
+   gEnv->SetValue("RDataFrame.JitCacheDir", dir.c_str());
+   ROOT::RDataFrame df(4);
+   auto s = df.Define("y", "rdfentry_ * 41 + 1").Sum<ULong64_t>("y");
+   EXPECT_EQ(250u, *s);
+   gEnv->SetValue("RDataFrame.JitCacheDir", "");
+
+   // the library for the next processes is there: load it as they do and call the compiled lambda
+   std::vector<std::string> files;
+   auto dirp = gSystem->OpenDirectory(dir.c_str());
+   ASSERT_NE(nullptr, dirp);
+   while (auto entry = gSystem->GetDirEntry(dirp))
+      files.emplace_back(entry);
+   gSystem->FreeDirectory(dirp);
+   std::string funcName;
+   for (const auto &f : files) {
+      EXPECT_EQ(std::string::npos, f.find(".failed")) << f;
+      if (f.size() > 2 && f.compare(f.size() - 2, 2, ".C") == 0)
+         funcName = f.substr(0, f.size() - 2);
+   }
+   ASSERT_FALSE(funcName.empty());
+   const auto source = dir + '/' + funcName + ".C";
+   EXPECT_TRUE(gSystem->CompileMacro(source.c_str(), "ks"));
+   EXPECT_TRUE(gInterpreter->Declare(("#include \"" + source + "\"").c_str()));
+   EXPECT_EQ(83, gInterpreter->Calc(("[] { ULong64_t e = 2; return __rdf::" + funcName + "(e); }()").c_str()));
+
+   dirp = gSystem->OpenDirectory(dir.c_str());
+   files.clear();
+   while (auto entry = gSystem->GetDirEntry(dirp))
+      files.emplace_back(entry);
+   gSystem->FreeDirectory(dirp);
+   for (const auto &f : files)
+      if (f != "." && f != "..")
+         gSystem->Unlink((dir + '/' + f).c_str());
+   gSystem->Unlink(dir.c_str());
+}
+
+TEST(RDataFrameInterface, JitInvalidExpression)
+{
+   ROOT::RDataFrame df(1);
+   EXPECT_THROW(df.Filter("rdfentry_ +"), std::runtime_error);
+   EXPECT_THROW(df.Define("x", "rdfentry_ +"), std::runtime_error);
+}
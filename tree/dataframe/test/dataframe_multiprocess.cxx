@@ -0,0 +1,104 @@
+#include <RConfigure.h> // R__USE_IMT
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RTrivialDS.hxx>
+#include <TFile.h>
+#include <TROOT.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#include "gtest/gtest.h"
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST(RDFMultiProcess, EmptySource)
+{
+   ROOT::RDataFrame d(1000);
+   d.SetNProcesses(4);
+   auto df = d.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto c = df.Filter([](double x) { return x < 100; }, {"x"}).Count();
+   auto s = df.Sum<double>("x", 1.);
+   auto mi = df.Min<double>("x");
+   auto ma = df.Max<double>("x");
+   auto me = df.Mean<double>("x");
+   auto t = df.Take<ULong64_t>("rdfentry_");
+   auto h = df.Histo1D<double>({"h", "h", 10, 0, 1000}, "x");
+   auto hExt = df.Histo1D<double>("x");
+
+   EXPECT_EQ(100u, *c);
+   EXPECT_DOUBLE_EQ(499501., *s);
+   EXPECT_DOUBLE_EQ(0., *mi);
+   EXPECT_DOUBLE_EQ(999., *ma);
+   EXPECT_DOUBLE_EQ(499.5, *me);
+   std::vector<ULong64_t> entries(1000);
+   std::iota(entries.begin(), entries.end(), 0ull);
+   EXPECT_EQ(entries, *t);
+   EXPECT_EQ(1000, h->GetEntries());
+   EXPECT_DOUBLE_EQ(100., h->GetBinContent(1));
+   EXPECT_EQ(1000, hExt->GetEntries());
+   EXPECT_DOUBLE_EQ(0., hExt->GetXaxis()->GetXmin());
+   EXPECT_DOUBLE_EQ(999., hExt->GetXaxis()->GetXmax());
+}
+
+TEST(RDFMultiProcess, Tree)
+{
+   const auto fileName = "dataframe_multiprocess.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(64);
+      int i = 0;
+      t.Branch("i", &i);
+      for (i = 0; i < 1000; ++i)
+         t.Fill();
+      t.Write();
+   }
+
+   ROOT::RDataFrame d("t", fileName);
+   d.SetNProcesses(3);
+   auto df = d.Filter([](int i) { return i % 2 == 0; }, {"i"});
+   auto c = df.Count();
+   auto s = df.Sum<int>("i");
+   auto t = df.Take<int>("i");
+
+   EXPECT_EQ(500u, *c);
+   EXPECT_EQ(249500, *s);
+   ASSERT_EQ(500u, t->size());
+   for (auto j = 0u; j < t->size(); ++j)
+      EXPECT_EQ(int(2 * j), t->at(j));
+
+   gSystem->Unlink(fileName);
+}
+
+TEST(RDFMultiProcess, Unsupported)
+{
+   // a fresh computation graph for each case, so that each event loop only has the unsupported node under test
+   {
+      ROOT::RDataFrame d(10);
+      d.SetNProcesses(2);
+      EXPECT_THROW(d.Foreach([](ULong64_t) {}, {"rdfentry_"}), std::runtime_error);
+   }
+   {
+      ROOT::RDataFrame d(10);
+      d.SetNProcesses(2);
+      auto c = d.Range(5).Count();
+      EXPECT_THROW(*c, std::runtime_error);
+   }
+   {
+      auto ds = ROOT::RDF::MakeTrivialDataFrame(10);
+      ds.SetNProcesses(2);
+      auto c = ds.Count();
+      EXPECT_THROW(*c, std::runtime_error);
+   }
+#ifdef R__USE_IMT
+   {
+      ROOT::EnableImplicitMT(2);
+      ROOT::RDataFrame d(10);
+      d.SetNProcesses(2);
+      auto c = d.Count();
+      EXPECT_THROW(*c, std::runtime_error);
+      ROOT::DisableImplicitMT();
+   }
+#endif
+}
@@ -0,0 +1,111 @@
+#include <ROOT/RDataFrame.hxx>
+#include <TInterpreter.h>
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+// stateless callables can only count their calls through global state
+static unsigned int gNFilterCalls = 0;
+static unsigned int gNDefineCalls = 0;
+
+TEST(RDFOptimization, DuplicateFilters)
+{
+   for (const bool optimize : {false, true}) {
+      gNFilterCalls = 0;
+      ROOT::RDataFrame d(100);
+      d.SetGraphOptimization(optimize);
+      auto isEven = [](ULong64_t e) {
+         ++gNFilterCalls;
+         return e % 2 == 0;
+      };
+      auto c = d.Filter(isEven, {"rdfentry_"}).Count();
+      auto m = d.Filter(isEven, {"rdfentry_"}).Max<ULong64_t>("rdfentry_");
+      EXPECT_EQ(50u, *c);
+      EXPECT_EQ(98u, *m);
+      EXPECT_EQ(optimize ? 100u : 200u, gNFilterCalls);
+   }
+}
+
+TEST(RDFOptimization, DuplicateDefines)
+{
+   for (const bool optimize : {false, true}) {
+      gNDefineCalls = 0;
+      ROOT::RDataFrame d(100);
+      d.SetGraphOptimization(optimize);
+      auto twice = [](ULong64_t e) {
+         ++gNDefineCalls;
+         return 2 * e;
+      };
+      auto df = d.Define("x", twice, {"rdfentry_"}).Define("y", twice, {"rdfentry_"});
+      auto sx = df.Sum<ULong64_t>("x");
+      auto sy = df.Sum<ULong64_t>("y");
+      EXPECT_EQ(9900u, *sx);
+      EXPECT_EQ(9900u, *sy);
+      EXPECT_EQ(optimize ? 100u : 200u, gNDefineCalls);
+   }
+}
+
+TEST(RDFOptimization, CommonSubFilters)
+{
+   gNFilterCalls = 0;
+   ROOT::RDataFrame d(100);
+   d.SetGraphOptimization(true);
+   auto isEven = [](ULong64_t e) {
+      ++gNFilterCalls;
+      return e % 2 == 0;
+   };
+   auto c1 = d.Filter(isEven, {"rdfentry_"}).Filter("rdfentry_ > 50").Count();
+   auto c2 = d.Filter(isEven, {"rdfentry_"}).Filter("rdfentry_ > 50").Count();
+   auto c3 = d.Filter(isEven, {"rdfentry_"}).Filter("rdfentry_ > 80").Count();
+   EXPECT_EQ(24u, *c1);
+   EXPECT_EQ(24u, *c2);
+   EXPECT_EQ(9u, *c3);
+   EXPECT_EQ(100u, gNFilterCalls);
+}
+
+TEST(RDFOptimization, JittedAndNamed)
+{
+   gInterpreter->Declare("unsigned int gRDFOptNCalls = 0; bool RDFOptIsOdd(ULong64_t e) { ++gRDFOptNCalls; return e % 2; }");
+   ROOT::RDataFrame d(10);
+   d.SetGraphOptimization(true);
+   auto df = d.Define("x", "rdfentry_ * 3").Define("y", "rdfentry_ * 3");
+   auto c1 = df.Filter("RDFOptIsOdd(rdfentry_)").Count();
+   auto c2 = df.Filter("RDFOptIsOdd(rdfentry_)").Count();
+   auto c3 = df.Filter("RDFOptIsOdd(rdfentry_)", "odd").Count();
+   auto sx = df.Sum<ULong64_t>("x");
+   auto sy = df.Sum<ULong64_t>("y");
+   auto report = d.Report();
+   EXPECT_EQ(5u, *c1);
+   EXPECT_EQ(5u, *c2);
+   EXPECT_EQ(5u, *c3);
+   EXPECT_EQ(135u, *sx);
+   EXPECT_EQ(135u, *sy);
+   EXPECT_EQ(5u, report->At("odd").GetPass());
+   // the named filter is evaluated separately
+   EXPECT_EQ(20, gInterpreter->Calc("gRDFOptNCalls"));
+}
+
+TEST(RDFOptimization, SwitchedOffBetweenRuns)
+{
+   gNFilterCalls = 0;
+   ROOT::RDataFrame d(100);
+   d.SetGraphOptimization(true);
+   auto isEven = [](ULong64_t e) {
+      ++gNFilterCalls;
+      return e % 2 == 0;
+   };
+   auto f1 = d.Filter(isEven, {"rdfentry_"});
+   auto f2 = d.Filter(isEven, {"rdfentry_"});
+   EXPECT_EQ(50u, *f1.Count());
+   EXPECT_EQ(100u, gNFilterCalls);
+
+   // the next event loop evaluates each filter again
+   gNFilterCalls = 0;
+   d.SetGraphOptimization(false);
+   auto c1 = f1.Count();
+   auto c2 = f2.Count();
+   EXPECT_EQ(50u, *c1);
+   EXPECT_EQ(50u, *c2);
+   EXPECT_EQ(200u, gNFilterCalls);
+}
@@ -0,0 +1,87 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx>
+#include <TFile.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <string>
+
+TEST(RDFProfile, DisabledByDefault)
+{
+   ROOT::RDataFrame d(10);
+   auto c = d.Define("x", [] { return 1; }).Count();
+   EXPECT_EQ(10u, *c);
+   const auto report = d.GetProfileReport();
+   EXPECT_EQ(report.begin(), report.end());
+}
+
+TEST(RDFProfile, NodeCounts)
+{
+   ROOT::RDataFrame d(100);
+   d.SetProfiling(true);
+   auto c = d.Define("x", [](ULong64_t e) { return e; }, {"rdfentry_"})
+               .Filter([](ULong64_t x) { return x % 2 == 0; }, {"x"}, "even")
+               .Count();
+   EXPECT_EQ(50u, *c);
+
+   const auto report = d.GetProfileReport();
+   EXPECT_EQ(100u, report.At("Define", "x").GetEntries());
+   EXPECT_EQ(100u, report.At("Filter", "even").GetEntries());
+   EXPECT_EQ(50u, report.At("Action", "Count").GetEntries());
+   EXPECT_GE(report.At("Define", "x").GetWallTime(), 0.);
+   EXPECT_THROW(report.At("Filter", "odd"), std::runtime_error);
+
+   // SaveGraph shows the profiles next to the names of the nodes
+   EXPECT_NE(std::string::npos, ROOT::RDF::SaveGraph(d).find("even\n"));
+   EXPECT_NE(std::string::npos, ROOT::RDF::SaveGraph(d).find(" s wall, 100 entries"));
+}
+
+TEST(RDFProfile, ProfileIsResetAtEachEventLoop)
+{
+   ROOT::RDataFrame d(10);
+   d.SetProfiling(true);
+   auto df = d.Define("x", [] { return 42; });
+   *df.Count();
+   *df.Count();
+   EXPECT_EQ(10u, d.GetProfileReport().At("Define", "x").GetEntries());
+}
+
+TEST(RDFProfile, TreeColumns)
+{
+   const auto fileName = "dataframe_profile_treecolumns.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int x = 0;
+      t.Branch("x", &x);
+      for (x = 0; x < 1000; ++x)
+         t.Fill();
+      t.Write();
+   }
+
+   ROOT::RDataFrame d("t", fileName);
+   d.SetProfiling(true);
+   auto s = d.Sum<int>("x");
+   EXPECT_EQ(499500, *s);
+
+   const auto &column = d.GetProfileReport().At("Column", "x");
+   EXPECT_EQ(1000u, column.GetEntries());
+   EXPECT_GT(column.GetBytesRead(), 0u);
+
+   gSystem->Unlink(fileName);
+}
+
+TEST(RDFProfile, AsJSON)
+{
+   ROOT::RDataFrame d(10);
+   d.SetProfiling(true);
+   *d.Filter([] { return true; }, {}, "all").Count();
+   const auto json = d.GetProfileReport().AsJSON();
+   EXPECT_EQ('[', json.front());
+   EXPECT_EQ(']', json.back());
+   EXPECT_NE(std::string::npos, json.find("{\"kind\": \"Filter\", \"name\": \"all\""));
+   EXPECT_NE(std::string::npos, json.find("\"entries\": 10"));
+}
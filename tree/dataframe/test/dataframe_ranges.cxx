@@ -1,6 +1,10 @@
 #include "ROOT/RDataFrame.hxx"
 #include <TROOT.h>
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 using namespace ROOT;
@@ -91,18 +95,53 @@ TEST_F(RDFRanges, NoEarlyStopping)
 }
 
 #ifdef R__USE_IMT
-TEST(RDFRangesMT, ThrowIfIMT)
+TEST(RDFRangesMT, EmptySource)
+{
+   ROOT::EnableImplicitMT(4);
+   {
+      RDataFrame d(100);
+      auto count = d.Range(10, 50).Count();
+      auto min = d.Range(10, 50).Min<ULong64_t>("rdfentry_");
+      auto chained = d.Range(10, 50).Range(10, 20).Take<ULong64_t>("rdfentry_");
+      auto strided = d.Range(15, 0, 20).Take<ULong64_t>("rdfentry_");
+      EXPECT_EQ(40u, *count);
+      EXPECT_EQ(10u, *min);
+      auto chainedVals = *chained;
+      std::sort(chainedVals.begin(), chainedVals.end());
+      std::vector<ULong64_t> expected(10);
+      std::iota(expected.begin(), expected.end(), 20u);
+      EXPECT_EQ(expected, chainedVals);
+      auto stridedVals = *strided;
+      std::sort(stridedVals.begin(), stridedVals.end());
+      // the same entries that the sequential event loop selects
+      EXPECT_EQ(std::vector<ULong64_t>({19, 39, 59, 79, 99}), stridedVals);
+   }
+   ROOT::DisableImplicitMT();
+}
+
+TEST(RDFRangesMT, OnlyRangeChildren)
+{
+   ROOT::EnableImplicitMT(4);
+   {
+      // the action on the RDataFrame itself requires all entries to be processed
+      RDataFrame d(1000);
+      auto all = d.Count();
+      auto some = d.Range(100, 200).Count();
+      EXPECT_EQ(1000u, *all);
+      EXPECT_EQ(100u, *some);
+   }
+   ROOT::DisableImplicitMT();
+}
+
+TEST(RDFRangesMT, ThrowAfterFilter)
 {
-   bool hasThrown = false;
    ROOT::EnableImplicitMT();
-   RDataFrame d(0);
-   try {
-      d.Range(0);
-   } catch (const std::exception &e) {
-      hasThrown = true;
-      EXPECT_STREQ(e.what(), "Range was called with ImplicitMT enabled, but multi-thread is not supported.");
+   {
+      RDataFrame d(10);
+      auto f = d.Filter([] { return true; });
+      EXPECT_THROW(f.Range(2), std::runtime_error);
    }
-   EXPECT_TRUE(hasThrown);
+   ROOT::DisableImplicitMT();
 }
 #endif
 
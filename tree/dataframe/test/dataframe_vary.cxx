@@ -0,0 +1,133 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RVec.hxx>
+#include <TH1D.h>
+
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ROOT::RDF::Experimental::VariationsFor;
+using ROOT::VecOps::RVec;
+
+TEST(RDFVary, SimpleSum)
+{
+   ROOT::RDataFrame d(10);
+   auto df = d.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                .Vary("x", [](int x) { return RVec<int>{x - 1, x + 1}; }, {"x"}, {"down", "up"});
+   auto s = df.Sum<int>("x");
+   auto ss = VariationsFor(s);
+
+   EXPECT_EQ(std::vector<std::string>({"nominal", "x:down", "x:up"}), ss.GetKeys());
+   EXPECT_EQ(45, ss["nominal"]);
+   EXPECT_EQ(35, ss["x:down"]);
+   EXPECT_EQ(55, ss["x:up"]);
+   EXPECT_EQ(45, *s);
+   EXPECT_THROW(ss["x:sideways"], std::runtime_error);
+}
+
+TEST(RDFVary, DefinesAndFilters)
+{
+   ROOT::RDataFrame d(10);
+   unsigned int nNominalCalls = 0;
+   auto df = d.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                .Define("y", [&nNominalCalls](ULong64_t e) {
+                   ++nNominalCalls;
+                   return double(e);
+                }, {"rdfentry_"})
+                .Vary("x", [](double x) { return RVec<double>{2. * x}; }, {"x"}, {"twice"}, "scale")
+                .Define("z", [](double x) { return x + 1.; }, {"x"});
+   auto filtered = df.Filter([](double z) { return z > 6.; }, {"z"}, "cut");
+   auto c = filtered.Count();
+   auto sumY = filtered.Sum<double>("y");
+   auto t = filtered.Take<double>("z");
+   auto unaffected = df.Filter([](double y) { return y < 3.; }, {"y"}).Sum<double>("y");
+   auto report = d.Report();
+
+   auto cs = VariationsFor(c);
+   auto sumYs = VariationsFor(sumY);
+   auto ts = VariationsFor(t);
+   EXPECT_EQ(4u, cs["nominal"]);
+   EXPECT_EQ(7u, cs["scale:twice"]);
+   // y is not varied, but the entries that pass the filter are
+   EXPECT_DOUBLE_EQ(30., sumYs["nominal"]);
+   EXPECT_DOUBLE_EQ(42., sumYs["scale:twice"]);
+   EXPECT_EQ(std::vector<double>({7., 8., 9., 10.}), ts["nominal"]);
+   EXPECT_EQ(std::vector<double>({7., 9., 11., 13., 15., 17., 19.}), ts["scale:twice"]);
+   // y is only evaluated once per entry, for the nominal and the varied branches of the graph
+   EXPECT_EQ(10u, nNominalCalls);
+
+   // results that do not depend on the variations have no varied counterpart
+   EXPECT_EQ(std::vector<std::string>({"nominal"}), VariationsFor(unaffected).GetKeys());
+   EXPECT_DOUBLE_EQ(3., *unaffected);
+
+   // varied filters are not named
+   EXPECT_EQ(4u, report->At("cut").GetPass());
+   EXPECT_EQ(10u, report->At("cut").GetAll());
+}
+
+TEST(RDFVary, JittedStringLiteral)
+{
+   // names of varied columns inside string literals are not replaced
+   ROOT::RDataFrame d(4);
+   auto df = d.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                .Vary("x", [](int x) { return RVec<int>{x + 1}; }, {"x"}, {"up"})
+                .Define("n", "int(std::string(\"x\").size()) + x");
+   auto ss = VariationsFor(df.Sum<int>("n"));
+
+   EXPECT_EQ(10, ss["nominal"]);
+   EXPECT_EQ(14, ss["x:up"]);
+}
+
+TEST(RDFVary, MultipleVariations)
+{
+   ROOT::RDataFrame d(4);
+   auto df = d.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                .Define("y", [](ULong64_t e) { return 10 * int(e); }, {"rdfentry_"})
+                .Vary("x", [](int x) { return RVec<int>{x + 1}; }, {"x"}, {"up"})
+                .Vary("y", [](int y) { return RVec<int>{y + 10}; }, {"y"}, {"up"})
+                .Define("xy", [](int x, int y) { return x * y; }, {"x", "y"});
+   auto ss = VariationsFor(df.Sum<int>("xy"));
+   auto sxs = VariationsFor(df.Sum<int>("x"));
+
+   EXPECT_EQ(std::vector<std::string>({"nominal", "x:up", "y:up"}), ss.GetKeys());
+   EXPECT_EQ(140, ss["nominal"]);
+   EXPECT_EQ(200, ss["x:up"]);
+   EXPECT_EQ(200, ss["y:up"]);
+   EXPECT_EQ(std::vector<std::string>({"nominal", "x:up"}), sxs.GetKeys());
+   EXPECT_EQ(10, sxs["x:up"]);
+}
+
+TEST(RDFVary, RangesAndNodes)
+{
+   ROOT::RDataFrame d(10);
+   ROOT::RDF::RNode df = d.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                            .Vary("x", [](int x) { return RVec<int>{-x}; }, {"x"}, {"neg"});
+   auto cs = VariationsFor(df.Filter([](int x) { return x >= 0; }, {"x"}).Range(3).Count());
+   EXPECT_EQ(3u, cs["nominal"]);
+   EXPECT_EQ(1u, cs["x:neg"]);
+}
+
+TEST(RDFVary, Histo)
+{
+   ROOT::RDataFrame d(10);
+   auto df = d.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                .Vary("x", [](double x) { return RVec<double>{x + 10.}; }, {"x"}, {"shift"});
+   auto hs = VariationsFor(df.Histo1D<double>({"h", "h", 20, 0., 20.}, "x"));
+   EXPECT_DOUBLE_EQ(4.5, hs["nominal"].GetMean());
+   EXPECT_DOUBLE_EQ(14.5, hs["x:shift"].GetMean());
+   EXPECT_EQ(nullptr, hs["x:shift"].GetDirectory());
+}
+
+TEST(RDFVary, Errors)
+{
+   ROOT::RDataFrame d(1);
+   auto vary = [](ULong64_t e) { return RVec<ULong64_t>{e, e}; };
+   EXPECT_THROW(d.Vary("y", vary, {"rdfentry_"}, {"a", "b"}), std::runtime_error);
+   EXPECT_THROW(d.Vary("rdfentry_", vary, {"rdfentry_"}, {}), std::runtime_error);
+   auto df = d.Vary("rdfentry_", vary, {"rdfentry_"}, {"a", "b"});
+   EXPECT_THROW(df.Vary("rdfentry_", vary, {"rdfentry_"}, {"c", "d"}), std::runtime_error);
+   auto wrongSize = d.Vary("rdfentry_", vary, {"rdfentry_"}, {"a"}, "e").Sum<ULong64_t>("rdfentry_");
+   EXPECT_THROW(VariationsFor(wrongSize)["e:a"], std::runtime_error);
+}
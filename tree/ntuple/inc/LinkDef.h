@@ -23,6 +23,8 @@
 #pragma link C++ class ROOT::Experimental::RFieldVector-;
 #pragma link C++ class ROOT::Experimental::RNTupleReader-;
 #pragma link C++ class ROOT::Experimental::RNTupleWriter-;
+#pragma link C++ class ROOT::Experimental::RNTupleParallelWriter-;
+#pragma link C++ class ROOT::Experimental::RNTupleFillContext-;
 #pragma link C++ class ROOT::Experimental::RNTupleModel-;
 
 #pragma link C++ class ROOT::Experimental::Internal::RNTupleBlob+;
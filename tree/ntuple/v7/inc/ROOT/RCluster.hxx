@@ -0,0 +1,217 @@
+/// \file ROOT/RCluster.hxx
+/// \ingroup NTuple ROOT7
+/// \author The ROOT Team
+/// \date 2026-10-16
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RCluster
+#define ROOT7_RCluster
+
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPage.hxx>
+#include <ROOT/RPageAllocator.hxx>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::ROnDiskPage
+\ingroup NTuple
+\brief A page as being stored on disk, that is packed and compressed
+
+Used by the cluster pool to cache pages from the physical storage. Such pages generally need to be
+uncompressed and unpacked before they can be used by RNTuple upper layers.
+*/
+// clang-format on
+class ROnDiskPage {
+private:
+   /// The memory location of the bytes
+   const void *fAddress = nullptr;
+   /// The compressed and packed size of the page
+   std::size_t fSize = 0;
+
+public:
+   /// On-disk pages within a page source are identified by the column and page number. The key is used for
+   /// associative finding of the page in the cluster.
+   struct Key {
+      DescriptorId_t fColumnId;
+      NTupleSize_t fPageNo;
+      Key(DescriptorId_t columnId, NTupleSize_t pageNo) : fColumnId(columnId), fPageNo(pageNo) {}
+      friend bool operator ==(const Key &lhs, const Key &rhs) {
+         return lhs.fColumnId == rhs.fColumnId && lhs.fPageNo == rhs.fPageNo;
+      }
+   };
+
+   ROnDiskPage() = default;
+   ROnDiskPage(const void *address, std::size_t size) : fAddress(address), fSize(size) {}
+
+   const void *GetAddress() const { return fAddress; }
+   std::size_t GetSize() const { return fSize; }
+
+   bool IsNull() const { return fAddress == nullptr; }
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+// For hash maps ROnDiskPage::Key --> ROnDiskPage
+namespace std
+{
+   template <>
+   struct hash<ROOT::Experimental::Detail::ROnDiskPage::Key>
+   {
+      // TODO(jblomer): quick and dirty hash, likely very sub-optimal, to be revised later.
+      size_t operator()(const ROOT::Experimental::Detail::ROnDiskPage::Key &key) const
+      {
+         return ((std::hash<ROOT::Experimental::DescriptorId_t>()(key.fColumnId) ^
+                 (hash<ROOT::Experimental::NTupleSize_t>()(key.fPageNo) << 1)) >> 1);
+      }
+   };
+}
+
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::ROnDiskPageMap
+\ingroup NTuple
+\brief A memory region that contains packed and compressed pages
+
+Derived classes implement how the on-disk pages are stored in memory, e.g. mmap'd or in a heap buffer.
+The page map owns the memory region; the on-disk pages registered with the map point into this region.
+*/
+// clang-format on
+class ROnDiskPageMap {
+   friend class RCluster;
+
+private:
+   /// Pages of a cluster may be spread across several page maps, e.g. one per vectored read request
+   std::unordered_map<ROnDiskPage::Key, ROnDiskPage> fOnDiskPages;
+
+public:
+   ROnDiskPageMap() = default;
+   ROnDiskPageMap(const ROnDiskPageMap &other) = delete;
+   ROnDiskPageMap(ROnDiskPageMap &&other) = default;
+   ROnDiskPageMap &operator =(const ROnDiskPageMap &other) = delete;
+   ROnDiskPageMap &operator =(ROnDiskPageMap &&other) = default;
+   virtual ~ROnDiskPageMap();
+
+   /// Inform the map about the location of a page on disk
+   void Register(const ROnDiskPage::Key &key, const ROnDiskPage &onDiskPage) { fOnDiskPages.emplace(key, onDiskPage); }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::ROnDiskPageMapHeap
+\ingroup NTuple
+\brief An ROnDiskPageMap that is used for an fMemory allocated as an array of unsigned char.
+*/
+// clang-format on
+class ROnDiskPageMapHeap : public ROnDiskPageMap {
+private:
+   /// The memory region containing the on-disk pages.
+   std::unique_ptr<unsigned char []> fMemory;
+
+public:
+   explicit ROnDiskPageMapHeap(std::unique_ptr<unsigned char []> memory) : fMemory(std::move(memory)) {}
+   ROnDiskPageMapHeap(const ROnDiskPageMapHeap &other) = delete;
+   ROnDiskPageMapHeap(ROnDiskPageMapHeap &&other) = default;
+   ROnDiskPageMapHeap &operator =(const ROnDiskPageMapHeap &other) = delete;
+   ROnDiskPageMapHeap &operator =(ROnDiskPageMapHeap &&other) = default;
+   ~ROnDiskPageMapHeap();
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RCluster
+\ingroup NTuple
+\brief An in-memory subset of the packed and compressed pages of a cluster
+
+Binds to the memory regions (page maps) that hold the on-disk pages and provides lookup by column and page number.
+Typically, the page source reads the on-disk pages of all active columns of the cluster in one go. In addition,
+the cluster can keep pages that have been already uncompressed and unpacked ahead of time by the cluster pool.
+Such unzipped pages are handed over to the page source on request, which from then on takes care of their lifetime.
+*/
+// clang-format on
+class RCluster {
+public:
+   using ColumnSet_t = std::unordered_set<DescriptorId_t>;
+
+private:
+   /// A page that has been uncompressed and unpacked; the deleter frees the page buffer if the page is not taken
+   struct RUnzippedPage {
+      RPage fPage;
+      RPageDeleter fDeleter;
+   };
+
+   /// References the cluster identifier in the page source that created the cluster
+   DescriptorId_t fClusterId;
+   /// Multiple page maps can be combined in a single RCluster
+   std::vector<std::unique_ptr<ROnDiskPageMap>> fPageMaps;
+   /// List of the (complete) columns represented by the RCluster
+   ColumnSet_t fAvailColumns;
+   /// Lookup table for the on-disk pages
+   std::unordered_map<ROnDiskPage::Key, ROnDiskPage> fOnDiskPages;
+   /// Pages that have been uncompressed ahead of time, e.g. by a background thread
+   std::unordered_map<ROnDiskPage::Key, RUnzippedPage> fUnzippedPages;
+
+public:
+   explicit RCluster(DescriptorId_t clusterId) : fClusterId(clusterId) {}
+   RCluster(const RCluster &other) = delete;
+   RCluster &operator =(const RCluster &other) = delete;
+   ~RCluster();
+
+   /// Move the given page map into this cluster; on-disk pages that are present in both the cluster at hand and
+   /// pageMap are ignored, i.e. the pages of the cluster take precedence.
+   void Adopt(std::unique_ptr<ROnDiskPageMap> pageMap);
+   /// Move the contents of other cluster into this one; the other cluster must have the same id.  Used to add
+   /// columns that have been loaded later to a cluster that is already in memory.
+   void Adopt(RCluster &&other);
+   /// Marks the column as complete; must be done for all columns, even empty ones without associated pages,
+   /// before the cluster is given from the page storage to the cluster pool.  Marking the available columns is
+   /// typically the last step of RPageSource::LoadCluster().
+   void SetColumnAvailable(DescriptorId_t columnId);
+   const ROnDiskPage *GetOnDiskPage(const ROnDiskPage::Key &key) const;
+
+   /// Registers a page that is ready to be used, i.e. uncompressed and unpacked. The cluster owns the page's memory
+   /// until the page is taken by TakeUnzippedPage().
+   void AddUnzippedPage(const ROnDiskPage::Key &key, const RPage &page, const RPageDeleter &deleter);
+   /// Returns the unzipped page and hands the ownership of its memory over to the caller, along with the deleter
+   /// that has been registered with the page.  Returns a null page if the page has not been unzipped ahead of time.
+   RPage TakeUnzippedPage(const ROnDiskPage::Key &key, RPageDeleter &deleter);
+
+   DescriptorId_t GetId() const { return fClusterId; }
+   const ColumnSet_t &GetAvailColumns() const { return fAvailColumns; }
+   bool ContainsColumn(DescriptorId_t columnId) const { return fAvailColumns.count(columnId) > 0; }
+   size_t GetNOnDiskPages() const { return fOnDiskPages.size(); }
+   size_t GetNUnzippedPages() const { return fUnzippedPages.size(); }
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
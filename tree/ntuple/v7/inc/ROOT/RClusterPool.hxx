@@ -0,0 +1,133 @@
+/// \file ROOT/RClusterPool.hxx
+/// \ingroup NTuple ROOT7
+/// \author The ROOT Team
+/// \date 2026-10-16
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RClusterPool
+#define ROOT7_RClusterPool
+
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RNTupleUtil.hxx>
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+class RPageSource;
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RClusterPool
+\ingroup NTuple
+\brief Manages a set of clusters containing compressed and packed pages
+
+The cluster pool steers the preloading of (partial) clusters. It keeps the cluster that is currently being processed
+plus a window of the next clusters in memory. Clusters are loaded by an I/O thread, which calls
+RPageSource::LoadCluster() and thus gives the page source the opportunity to read the pages of a cluster in a single
+vectored read.  A second thread calls RPageSource::UnzipCluster() on the loaded clusters, such that the pages of the
+upcoming clusters are decompressed ahead of time.  The pool is bound to a single page source and is not thread-safe:
+GetCluster() must only be called from the thread that owns the page source.
+*/
+// clang-format on
+class RClusterPool {
+private:
+   /// Request to load a subset of the columns of a particular cluster
+   struct RReadItem {
+      std::promise<std::unique_ptr<RCluster>> fPromise;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      RCluster::ColumnSet_t fColumns;
+   };
+
+   /// Request to decompress the pages of a loaded cluster
+   struct RUnzipItem {
+      std::promise<std::unique_ptr<RCluster>> fPromise;
+      std::unique_ptr<RCluster> fCluster;
+   };
+
+   /// A cluster (or a subset of its columns) that is being processed by the I/O and the unzip thread
+   struct RInFlightCluster {
+      std::future<std::unique_ptr<RCluster>> fFuture;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      RCluster::ColumnSet_t fColumns;
+      /// Set if the cluster left the window before it arrived; such clusters are discarded upon arrival
+      bool fIsExpired = false;
+   };
+
+   /// Every cluster pool is responsible for exactly one page source that triggers loading of the clusters
+   /// (GetCluster()) and is used for implementing the I/O and cluster memory allocation (LoadCluster() and
+   /// UnzipCluster())
+   RPageSource &fPageSource;
+   /// The number of clusters following the requested one that are loaded ahead of time
+   unsigned int fLookahead;
+   /// The clusters that arrived from the I/O pipeline and that are within the current window
+   std::vector<std::unique_ptr<RCluster>> fPool;
+   /// The clusters that were handed over to the I/O thread but did not yet arrive
+   std::vector<RInFlightCluster> fInFlightClusters;
+
+   /// Protects the shared state between the main thread and the I/O thread
+   std::mutex fLockReadQueue;
+   /// Signals a non-empty I/O work queue
+   std::condition_variable fCvHasReadWork;
+   /// The communication channel to the I/O thread
+   std::deque<RReadItem> fReadQueue;
+   /// Protects the shared state between the I/O thread and the unzip thread
+   std::mutex fLockUnzipQueue;
+   /// Signals a non-empty unzip work queue
+   std::condition_variable fCvHasUnzipWork;
+   /// The communication channel from the I/O thread to the unzip thread
+   std::deque<RUnzipItem> fUnzipQueue;
+
+   /// The I/O thread calls RPageSource::LoadCluster() asynchronously
+   std::thread fThreadIo;
+   /// The unzip thread calls RPageSource::UnzipCluster() on the clusters delivered by the I/O thread
+   std::thread fThreadUnzip;
+
+   /// The I/O thread routine; there is exactly one I/O thread in-flight for every cluster pool
+   void ExecReadClusters();
+   /// The unzip thread routine; there is exactly one unzip thread in-flight for every cluster pool
+   void ExecUnzipClusters();
+   /// Returns the cluster with the given id from the pool or nullptr
+   RCluster *FindInPool(DescriptorId_t clusterId) const;
+   /// Moves a cluster that arrived from the I/O pipeline into the pool; partial clusters are merged with the
+   /// cluster already in the pool.  Expired clusters are discarded.
+   void Receive(RInFlightCluster &inFlight);
+
+public:
+   RClusterPool(RPageSource &pageSource, unsigned int lookahead);
+   RClusterPool(const RClusterPool &other) = delete;
+   RClusterPool &operator =(const RClusterPool &other) = delete;
+   ~RClusterPool();
+
+   /// Returns the requested cluster either from the pool or, in case of a cache miss, waits for the I/O pipeline to
+   /// deliver it.  Triggers loading of the clusters in the lookahead window and evicts the clusters outside of it.
+   /// The returned pointer is valid until the next call to GetCluster().  The cluster contains at least the
+   /// given columns, unless the columns are not part of the cluster on storage.
+   RCluster *GetCluster(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns);
+
+   unsigned int GetLookahead() const { return fLookahead; }
+   std::size_t GetNClusters() const { return fPool.size(); }
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
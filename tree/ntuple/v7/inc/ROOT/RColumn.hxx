@@ -72,6 +72,10 @@ public:
       R__ASSERT(model.GetType() == ColumnT);
       auto column = new RColumn(model, index);
       column->fElement = std::unique_ptr<RColumnElementBase>(new RColumnElement<CppT, ColumnT>(nullptr));
+      if (model.GetEncoding() != EColumnEncoding::kPlain) {
+         column->fElement = std::unique_ptr<RColumnElementBase>(
+            new RColumnElementEncoded(ColumnT, RColumnElement<CppT, ColumnT>::kSize, model.GetEncoding()));
+      }
       return column;
    }
 
@@ -80,6 +84,9 @@ public:
    ~RColumn();
 
    void Connect(DescriptorId_t fieldId, RPageStorage *pageStorage);
+   /// Changes the on-storage encoding of the column elements; must be called before the column is connected to a
+   /// sink. When connected to a source, the column picks up the encoding from the ntuple descriptor.
+   void SetEncoding(EColumnEncoding encoding);
 
    void Append(const RColumnElementBase &element) {
       void *dst = fHeadPage.TryGrow(1);
@@ -177,6 +184,31 @@ public:
          (clusterIndex.GetIndex() - fCurrentPage.GetClusterRangeFirst()) * RColumnElement<CppT, ColumnT>::kSize);
    }
 
+   /// Maps the page that contains globalIndex and returns a pointer to the element together with the number of
+   /// elements that follow contiguously in the same page (including the element itself).  This allows for reading
+   /// a column page by page without per-element calls.
+   template <typename CppT, EColumnType ColumnT>
+   CppT *MapV(const NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      if (!fCurrentPage.Contains(globalIndex)) {
+         MapPage(globalIndex);
+      }
+      auto idxInPage = globalIndex - fCurrentPage.GetGlobalRangeFirst();
+      nItems = fCurrentPage.GetNElements() - idxInPage;
+      return reinterpret_cast<CppT*>(
+         static_cast<unsigned char *>(fCurrentPage.GetBuffer()) + idxInPage * RColumnElement<CppT, ColumnT>::kSize);
+   }
+
+   template <typename CppT, EColumnType ColumnT>
+   CppT *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      if (!fCurrentPage.Contains(clusterIndex)) {
+         MapPage(clusterIndex);
+      }
+      auto idxInPage = clusterIndex.GetIndex() - fCurrentPage.GetClusterRangeFirst();
+      nItems = fCurrentPage.GetNElements() - idxInPage;
+      return reinterpret_cast<CppT*>(
+         static_cast<unsigned char *>(fCurrentPage.GetBuffer()) + idxInPage * RColumnElement<CppT, ColumnT>::kSize);
+   }
+
    NTupleSize_t GetGlobalIndex(const RClusterIndex &clusterIndex) {
       if (!fCurrentPage.Contains(clusterIndex)) {
          MapPage(clusterIndex);
@@ -23,6 +23,7 @@
 
 #include <cstring> // for memcpy
 #include <cstdint>
+#include <memory>
 #include <type_traits>
 
 namespace ROOT {
@@ -68,7 +69,9 @@ public:
    RColumnElementBase& operator =(RColumnElementBase&& other) = default;
    virtual ~RColumnElementBase() = default;
 
-   static RColumnElementBase Generate(EColumnType type);
+   static std::unique_ptr<RColumnElementBase> Generate(EColumnType type);
+   /// Like Generate(EColumnType) but takes into account the encoding of the column model
+   static std::unique_ptr<RColumnElementBase> Generate(const RColumnModel &model);
 
    /// Write one or multiple column elements into destination
    void WriteTo(void *destination, std::size_t count) const {
@@ -239,6 +242,35 @@ public:
    void Unpack(void *dst, void *src, std::size_t count) const final;
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RColumnElementEncoded
+\ingroup NTuple
+\brief Packs and unpacks pages of a mappable column type using an encoding other than EColumnEncoding::kPlain
+
+The in-memory layout of the elements is the one of the mappable column type; only the on-storage layout changes.
+Encodings work page by page, e.g. the delta encoding starts over with every page.
+*/
+// clang-format on
+class RColumnElementEncoded : public RColumnElementBase {
+private:
+   EColumnType fType;
+   EColumnEncoding fEncoding;
+
+public:
+   RColumnElementEncoded(EColumnType type, std::size_t size, EColumnEncoding encoding);
+
+   /// Tells whether columns of the given type can be stored with the given encoding
+   static bool IsApplicable(EColumnType type, EColumnEncoding encoding);
+
+   bool IsMappable() const final { return false; }
+   std::size_t GetBitsOnStorage() const final;
+   EColumnEncoding GetEncoding() const { return fEncoding; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
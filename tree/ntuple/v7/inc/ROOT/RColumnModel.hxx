@@ -50,6 +50,29 @@ enum class EColumnType {
    kInt16,
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::EColumnEncoding
+\ingroup NTuple
+\brief Optional transformations of the column elements applied before the pages are compressed
+
+The encodings are meant to make the pages better compressible. Except for kBFloat16, they are lossless.
+*/
+// clang-format on
+enum class EColumnEncoding {
+   // the elements are stored as they are in memory
+   kPlain = 0,
+   // the differences to the previous element in the page are stored in zigzag representation, such that small
+   // positive and negative deltas result in small unsigned numbers; for kIndex, kInt32, and kInt64 columns
+   kDeltaZigzag,
+   // the bytes of the elements are regrouped such that the first bytes of all the elements in the page are stored
+   // first, then all the second bytes etc.; for columns of multi-byte elements
+   kByteSplit,
+   // lossy: floats are stored as the upper 16 bits (sign, exponent, 7 bits of mantissa), rounded to the nearest
+   // representable value; for kReal32 columns
+   kBFloat16,
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::RColumnModel
@@ -61,16 +84,21 @@ class RColumnModel {
 private:
    EColumnType fType;
    bool fIsSorted;
+   EColumnEncoding fEncoding;
 
 public:
-   RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false) {}
-   RColumnModel(EColumnType type, bool isSorted) : fType(type), fIsSorted(isSorted) {}
+   RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false), fEncoding(EColumnEncoding::kPlain) {}
+   RColumnModel(EColumnType type, bool isSorted) : fType(type), fIsSorted(isSorted), fEncoding(EColumnEncoding::kPlain)
+   {}
+   RColumnModel(EColumnType type, bool isSorted, EColumnEncoding encoding)
+      : fType(type), fIsSorted(isSorted), fEncoding(encoding) {}
 
    EColumnType GetType() const { return fType; }
    bool GetIsSorted() const { return fIsSorted; }
+   EColumnEncoding GetEncoding() const { return fEncoding; }
 
    bool operator ==(const RColumnModel &other) const {
-      return (fType == other.fType) && (fIsSorted == other.fIsSorted);
+      return (fType == other.fType) && (fIsSorted == other.fIsSorted) && (fEncoding == other.fEncoding);
    }
 };
 
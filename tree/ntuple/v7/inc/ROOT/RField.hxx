@@ -85,6 +85,8 @@ private:
    std::size_t fNRepetitions;
    /// A field on a trivial type that maps as-is to a single column
    bool fIsSimple;
+   /// The on-storage encoding requested for the columns of this field; applied to those columns that support it
+   EColumnEncoding fColumnEncoding = EColumnEncoding::kPlain;
    /// Describes where the field is located inside the ntuple.
    struct RLevelInfo {
    private:
@@ -248,6 +250,10 @@ public:
    std::size_t GetNRepetitions() const { return fNRepetitions; }
    const RFieldBase* GetParent() const { return fParent; }
    bool IsSimple() const { return fIsSimple; }
+   /// Sets the encoding of the field's columns for writing; columns whose type does not support the encoding are
+   /// stored with EColumnEncoding::kPlain.  Sub fields are not affected.
+   void SetColumnEncoding(EColumnEncoding encoding) { fColumnEncoding = encoding; }
+   EColumnEncoding GetColumnEncoding() const { return fColumnEncoding; }
 
    /// Indicates an evolution of the mapping scheme from C++ type to columns
    virtual RNTupleVersion GetFieldVersion() const { return RNTupleVersion(); }
@@ -498,6 +504,12 @@ public:
    ClusterSize_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<ClusterSize_t, EColumnType::kIndex>(clusterIndex);
    }
+   ClusterSize_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<ClusterSize_t, EColumnType::kIndex>(globalIndex, nItems);
+   }
+   ClusterSize_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<ClusterSize_t, EColumnType::kIndex>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -543,6 +555,12 @@ public:
    bool *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<bool, EColumnType::kBit>(clusterIndex);
    }
+   bool *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<bool, EColumnType::kBit>(globalIndex, nItems);
+   }
+   bool *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<bool, EColumnType::kBit>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -579,6 +597,12 @@ public:
    float *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<float, EColumnType::kReal32>(clusterIndex);
    }
+   float *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<float, EColumnType::kReal32>(globalIndex, nItems);
+   }
+   float *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<float, EColumnType::kReal32>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -616,6 +640,12 @@ public:
    double *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<double, EColumnType::kReal64>(clusterIndex);
    }
+   double *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<double, EColumnType::kReal64>(globalIndex, nItems);
+   }
+   double *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<double, EColumnType::kReal64>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -652,6 +682,12 @@ public:
    std::uint8_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<std::uint8_t, EColumnType::kByte>(clusterIndex);
    }
+   std::uint8_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint8_t, EColumnType::kByte>(globalIndex, nItems);
+   }
+   std::uint8_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint8_t, EColumnType::kByte>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -688,6 +724,12 @@ public:
    std::int32_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<std::int32_t, EColumnType::kInt32>(clusterIndex);
    }
+   std::int32_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::int32_t, EColumnType::kInt32>(globalIndex, nItems);
+   }
+   std::int32_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::int32_t, EColumnType::kInt32>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -724,6 +766,12 @@ public:
    std::uint32_t *Map(const RClusterIndex clusterIndex) {
       return fPrincipalColumn->Map<std::uint32_t, EColumnType::kInt32>(clusterIndex);
    }
+   std::uint32_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint32_t, EColumnType::kInt32>(globalIndex, nItems);
+   }
+   std::uint32_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint32_t, EColumnType::kInt32>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -760,6 +808,12 @@ public:
    std::uint64_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<std::uint64_t, EColumnType::kInt64>(clusterIndex);
    }
+   std::uint64_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint64_t, EColumnType::kInt64>(globalIndex, nItems);
+   }
+   std::uint64_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint64_t, EColumnType::kInt64>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -26,7 +26,10 @@
 
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <string>
+#include <unordered_map>
 #include <utility>
 
 namespace ROOT {
@@ -37,6 +40,7 @@ class RNTupleModel;
 
 namespace Detail {
 class RPageSink;
+class RPageSinkBuf;
 class RPageSource;
 }
 
@@ -98,11 +102,27 @@ Individual fields can be read as well by instantiating a tree view.
 */
 // clang-format on
 class RNTupleReader : public Detail::RNTuple {
+   // Clones the page source of a reader given to its constructor
+   friend class RNTupleDS;
+
 private:
    std::unique_ptr<Detail::RPageSource> fSource;
    Detail::RNTupleMetrics fMetrics;
 
+   /// Deserialization counters of a top-level field of the model, including its sub fields
+   struct RFieldCounters {
+      explicit RFieldCounters(const std::string &name);
+      Detail::RNTupleMetrics fMetrics;
+      Detail::RNTuplePlainCounter *fNRead = nullptr;
+      Detail::RNTuplePlainCounter *fTimeWallRead = nullptr;
+      Detail::RNTupleTickCounter<Detail::RNTuplePlainCounter> *fTimeCpuRead = nullptr;
+   };
+   /// Indexed by the top-level fields of the model; the field metrics are observed by fMetrics
+   std::unordered_map<const Detail::RFieldBase *, std::unique_ptr<RFieldCounters>> fFieldCounters;
+
    void ConnectModel();
+   /// Like LoadEntry() but accounts the time spent in reading each of the values to the field counters
+   void LoadEntryInstrumented(NTupleSize_t index, REntry *entry);
 
 public:
    // Browse through the entries
@@ -147,6 +167,10 @@ public:
    void LoadEntry(NTupleSize_t index) { LoadEntry(index, fModel->GetDefaultEntry()); }
    /// Fills a user provided entry after checking that the entry has been instantiated from the ntuple model
    void LoadEntry(NTupleSize_t index, REntry* entry) {
+      if (R__unlikely(fMetrics.IsEnabled())) {
+         LoadEntryInstrumented(index, entry);
+         return;
+      }
       for (auto& value : *entry) {
          value.GetField()->Read(index, &value);
       }
@@ -171,6 +195,7 @@ public:
    RIterator end() { return RIterator(fNEntries); }
 
    void EnableMetrics() { fMetrics.Enable(); }
+   Detail::RNTupleMetrics &GetMetrics() { return fMetrics; }
 };
 
 // clang-format off
@@ -218,6 +243,96 @@ public:
    void CommitCluster();
 };
 
+class RNTupleParallelWriter;
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleFillContext
+\ingroup NTuple
+\brief A per-thread fill handle of an RNTupleParallelWriter
+
+The fill context owns a clone of the writer's model, including its own default entry, and a buffered page sink.
+Fill() serializes entries into the column page buffers of the context without any synchronization.  Once a cluster
+is complete, the buffered pages are appended as a whole to the writer's sink, which is the only step that takes
+the writer's lock.  A fill context must only be used by a single thread at a time and it must be destructed before
+the writer that created it.
+*/
+// clang-format on
+class RNTupleFillContext : public Detail::RNTuple {
+   friend class RNTupleParallelWriter;
+
+private:
+   static constexpr NTupleSize_t kDefaultClusterSizeEntries = 64000;
+   RNTupleParallelWriter &fWriter;
+   std::unique_ptr<Detail::RPageSinkBuf> fSink;
+   NTupleSize_t fClusterSizeEntries;
+   NTupleSize_t fLastCommitted;
+
+   RNTupleFillContext(RNTupleParallelWriter &writer, std::unique_ptr<RNTupleModel> model);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext&) = delete;
+   RNTupleFillContext& operator=(const RNTupleFillContext&) = delete;
+   ~RNTupleFillContext();
+
+   /// Fill the default entry of the context's model, which is distinct from the default entry of the writer's model
+   void Fill() { Fill(fModel->GetDefaultEntry()); }
+   /// The entry must have been created from the context's model
+   void Fill(REntry *entry) {
+      for (auto& value : *entry) {
+         value.GetField()->Append(value);
+      }
+      fNEntries++;
+      if ((fNEntries % fClusterSizeEntries) == 0)
+         CommitCluster();
+   }
+   /// Append the entries filled since the last commit as a new cluster to the writer's sink
+   void CommitCluster();
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief An RNTuple that is filled concurrently from multiple threads
+
+Every thread obtains its own RNTupleFillContext by CreateFillContext().  Clusters are built independently by the
+fill contexts and appended to the shared page sink under a lock, similar to what the TBufferMerger does for TTree.
+Consequently, the entries of different threads do not interleave within a cluster but the order of the clusters
+is not deterministic.  The writer commits the data set when it is destructed, which must happen after all of its
+fill contexts have been destructed.
+*/
+// clang-format on
+class RNTupleParallelWriter : public Detail::RNTuple {
+   friend class RNTupleFillContext;
+
+private:
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// Protects the sink, the number of entries, and the number of fill contexts
+   std::mutex fLockSink;
+   /// The number of fill contexts that are still alive
+   unsigned int fNFillContexts = 0;
+
+   /// Called by the fill contexts to append a cluster
+   void CommitBufferedCluster(Detail::RPageSinkBuf &bufferedSink, NTupleSize_t nEntries);
+   void ReleaseFillContext();
+
+public:
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName,
+                                                          std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter&) = delete;
+   RNTupleParallelWriter& operator=(const RNTupleParallelWriter&) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Thread-safe; the fill context is to be used by a single thread and has its own clone of the model
+   std::unique_ptr<RNTupleFillContext> CreateFillContext();
+   /// The number of entries in the clusters that have been committed so far
+   NTupleSize_t GetNEntries();
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::RCollectionNTuple
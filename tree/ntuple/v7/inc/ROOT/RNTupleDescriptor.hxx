@@ -355,6 +355,8 @@ public:
    DescriptorId_t FindFieldId(std::string_view fieldName) const;
    DescriptorId_t FindColumnId(DescriptorId_t fieldId, std::uint32_t columnIndex) const;
    DescriptorId_t FindClusterId(DescriptorId_t columnId, NTupleSize_t index) const;
+   /// Returns the cluster that contains the entries directly following the given cluster or kInvalidDescriptorId
+   DescriptorId_t FindNextClusterId(DescriptorId_t clusterId) const;
 
    /// Re-create the C++ model from the stored meta-data
    std::unique_ptr<RNTupleModel> GenerateModel() const;
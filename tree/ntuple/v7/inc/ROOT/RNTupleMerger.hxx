@@ -0,0 +1,66 @@
+/// \file ROOT/RNTupleMerger.hxx
+/// \ingroup NTuple ROOT7
+/// \author The ROOT Team
+/// \date 2026-10-16
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleMerger
+#define ROOT7_RNTupleMerger
+
+#include <ROOT/RNTupleUtil.hxx>
+
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+class RNTupleDescriptor;
+
+namespace Detail {
+class RPageSink;
+class RPageSource;
+}
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates ntuples by copying their sealed pages
+
+The merger appends the clusters of several ntuples to a new ntuple.  Pages are copied as they are stored, i.e.
+packed and compressed, and only the meta-data (clusters, column ranges, page locators) is rewritten.  That requires
+all the input ntuples to have the same schema, including the column encodings, and to be compressed with the
+compression settings of the output.  Otherwise, the merger throws and the data needs to be copied entry by entry
+with an RNTupleReader and an RNTupleWriter.
+*/
+// clang-format on
+class RNTupleMerger {
+private:
+   /// Returns for every column id of the destination the corresponding column id of the source.  Columns are
+   /// matched by the field names along the path from the root field and by the column index.  Throws if the schemas
+   /// differ.
+   static std::vector<DescriptorId_t> MapColumns(const RNTupleDescriptor &destination,
+                                                 const RNTupleDescriptor &source);
+   /// Returns the cluster ids of the ntuple sorted by the first entry of the clusters.  Throws if the clusters do not
+   /// cover the entries of the ntuple without gaps or overlaps.
+   static std::vector<DescriptorId_t> GetClustersInEntryOrder(const RNTupleDescriptor &desc);
+
+public:
+   /// Appends the clusters of the sources, in the given order, to the destination and commits the dataset.  The
+   /// sources must be attached.  The destination must be a fresh sink; its schema is taken from the first source.
+   void Merge(const std::vector<Detail::RPageSource *> &sources, Detail::RPageSink &destination);
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
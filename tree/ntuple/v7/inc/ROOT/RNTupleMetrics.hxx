@@ -263,7 +263,18 @@ public:
 
    void ObserveMetrics(RNTupleMetrics &observee);
 
+   std::string GetName() const { return fName; }
+   /// Searches the counters of this object and of the observed metrics by their qualified name, e.g.
+   /// "RNTupleReader.RPageSourceRaw.nPages".  Returns nullptr if no such counter exists.
+   const RNTuplePerfCounter *GetCounter(const std::string &qualifiedName) const;
+
    void Print(std::ostream &output, const std::string &prefix = "") const;
+   /// Machine-readable output with one line per counter: qualified name, unit, description, and value.  The header
+   /// line is only printed for the outermost metrics object, i.e. if the prefix is empty.
+   void PrintCSV(std::ostream &output, const std::string &prefix = "") const;
+   /// Machine-readable output of the tree of metrics as a single JSON object; every object has a name, a list of
+   /// counters and a list of observed metrics
+   void PrintJSON(std::ostream &output) const;
    void Enable();
    bool IsEnabled() const { return fIsEnabled; }
 };
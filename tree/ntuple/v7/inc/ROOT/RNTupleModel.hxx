@@ -83,6 +83,12 @@ public:
       return fDefaultEntry->Get<T>(fieldName);
    }
 
+   /// Sets the on-storage encoding of the columns of the given top-level field and of all its sub fields, e.g. in
+   /// order to store the offset column of a collection delta encoded.  Only columns whose type supports the encoding
+   /// are affected.  Needs to be called before the model is used to create an ntuple.  Throws if there is no top-level
+   /// field of the given name.
+   void SetColumnEncoding(std::string_view fieldName, EColumnEncoding encoding);
+
    /// Ingests a model for a sub collection and attaches it to the current model
    std::shared_ptr<RCollectionNTuple> MakeCollection(
       std::string_view fieldName,
@@ -18,6 +18,8 @@
 
 #include <Compression.h>
 
+#include <cstddef>
+
 namespace ROOT {
 namespace Experimental {
 
@@ -31,7 +33,18 @@ All page sink classes need to support the common options.
 */
 // clang-format on
 class RNTupleWriteOptions {
+public:
+  /// Controls whether page compression is offloaded to the implicit multi-threading task arena, provided that
+  /// implicit multi-threading is enabled (ROOT::EnableImplicitMT())
+  enum EImplicitMT {
+    kOff,
+    kDefault,
+  };
+
+private:
   int fCompression;
+  EImplicitMT fUseImplicitMT = EImplicitMT::kDefault;
+
 public:
   RNTupleWriteOptions() : fCompression(RCompressionSetting::EDefaults::kUseAnalysis) {}
   int GetCompression() const { return fCompression; }
@@ -39,6 +52,8 @@ public:
   void SetCompression(RCompressionSetting::EAlgorithm algorithm, int compressionLevel) {
     fCompression = CompressionSettings(algorithm, compressionLevel);
   }
+  EImplicitMT GetUseImplicitMT() const { return fUseImplicitMT; }
+  void SetUseImplicitMT(EImplicitMT val) { fUseImplicitMT = val; }
 };
 
 
@@ -52,6 +67,32 @@ All page source classes need to support the common options.
 */
 // clang-format on
 class RNTupleReadOptions {
+public:
+  /// Controls whether the page source reads and decompresses clusters ahead of time in background threads
+  enum EClusterCache {
+    kOff,
+    kOn,
+    kDefault = kOn,
+  };
+
+private:
+  EClusterCache fClusterCache = EClusterCache::kDefault;
+  /// The number of clusters following the current one that are prefetched by the cluster pool
+  unsigned int fClusterLookahead = 2;
+  /// The memory that the page pool may use to keep unreferenced pages for later reuse
+  std::size_t fPagePoolBudget = 64 * 1024 * 1024;
+  /// If the storage supports it, uncompressed pages are used directly from a memory mapping of the file
+  bool fUseMemoryMap = false;
+
+public:
+  EClusterCache GetClusterCache() const { return fClusterCache; }
+  void SetClusterCache(EClusterCache val) { fClusterCache = val; }
+  unsigned int GetClusterLookahead() const { return fClusterLookahead; }
+  void SetClusterLookahead(unsigned int val) { fClusterLookahead = val; }
+  std::size_t GetPagePoolBudget() const { return fPagePoolBudget; }
+  void SetPagePoolBudget(std::size_t val) { fPagePoolBudget = val; }
+  bool GetUseMemoryMap() const { return fUseMemoryMap; }
+  void SetUseMemoryMap(bool val) { fUseMemoryMap = val; }
 };
 
 } // namespace Experimental
@@ -117,7 +117,8 @@ nested collections have global index numbers that are derived from their parent
 The RNTupleView object is an iterable. That means, all field values in the tree can be sequentially read from begin()
 to end().
 
-For simple types, template specializations let the reading become a pure mapping into a page buffer.
+For simple types, template specializations let the reading become a pure mapping into a page buffer.  These views
+also provide bulk access by MapV(), which hands out the remaining values of a page as a contiguous array.
 */
 // clang-format on
 template <typename T>
@@ -187,6 +188,10 @@ public:
 
    float operator()(NTupleSize_t globalIndex) { return *fField.Map(globalIndex); }
    float operator()(const RClusterIndex &clusterIndex) { return *fField.Map(clusterIndex); }
+   const float *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) { return fField.MapV(globalIndex, nItems); }
+   const float *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fField.MapV(clusterIndex, nItems);
+   }
 };
 
 
@@ -212,6 +217,10 @@ public:
 
    double operator()(NTupleSize_t globalIndex) { return *fField.Map(globalIndex); }
    double operator()(const RClusterIndex &clusterIndex) { return *fField.Map(clusterIndex); }
+   const double *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) { return fField.MapV(globalIndex, nItems); }
+   const double *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fField.MapV(clusterIndex, nItems);
+   }
 };
 
 
@@ -237,6 +246,10 @@ public:
 
    std::int32_t operator()(NTupleSize_t globalIndex) { return *fField.Map(globalIndex); }
    std::int32_t operator()(const RClusterIndex &clusterIndex) { return *fField.Map(clusterIndex); }
+   const std::int32_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) { return fField.MapV(globalIndex, nItems); }
+   const std::int32_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fField.MapV(clusterIndex, nItems);
+   }
 };
 
 template <>
@@ -261,6 +274,10 @@ public:
 
    ClusterSize_t operator()(NTupleSize_t globalIndex) { return *fField.Map(globalIndex); }
    ClusterSize_t operator()(const RClusterIndex &clusterIndex) { return *fField.Map(clusterIndex); }
+   const ClusterSize_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) { return fField.MapV(globalIndex, nItems); }
+   const ClusterSize_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fField.MapV(clusterIndex, nItems);
+   }
 };
 
 
@@ -21,7 +21,12 @@
 #include <ROOT/RNTupleUtil.hxx>
 
 #include <cstddef>
-#include <vector>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 
 namespace ROOT {
 namespace Experimental {
@@ -39,26 +44,54 @@ pages is thread-safe. The page pool does not allocate the memory -- allocation a
 page storage, which might do it in a way optimized to the backing store (e.g., mmap()).
 Multiple page caches can coexist.
 
-TODO(jblomer): it should be possible to register pages and to find them by column and index; this would
-facilitate pre-filling a cache, e.g. by read-ahead.
+Pages are indexed by column, cluster, and element range, so that lookups by global and by cluster-local index are
+logarithmic in the number of pages of the column.  Pages are reference counted.  Pages whose reference counter
+dropped to zero are kept in the pool as long as the memory taken by all the pages in the pool stays within the memory
+budget.  If the budget is exceeded, unreferenced pages are evicted in least-recently-used order.  With a memory budget
+of zero, pages are released as soon as they are not referenced anymore.
 */
 // clang-format on
 class RPagePool {
 private:
-   /// TODO(jblomer): should be an efficient index structure that allows
-   ///   - random insert
-   ///   - random delete
-   ///   - searching by page
-   ///   - searching by tree index
-   std::vector<RPage> fPages;
-   std::vector<std::uint32_t> fReferences;
-   std::vector<RPageDeleter> fDeleters;
+   /// A registered page together with its deleter and its bookkeeping information
+   struct REntry {
+      RPage fPage;
+      RPageDeleter fDeleter;
+      std::uint32_t fReferences = 0;
+      /// Position in the LRU list of unreferenced pages; only valid if fReferences is zero
+      std::list<void *>::iterator fLruPosition;
+   };
+   /// The page lookup tables of a single column, mapping the first element of a page to its buffer
+   struct RColumnIndex {
+      std::map<NTupleSize_t, void *> fByGlobalIndex;
+      std::map<std::pair<DescriptorId_t, ClusterSize_t::ValueType>, void *> fByClusterIndex;
+   };
+
+   /// The page buffer identifies the page
+   std::unordered_map<void *, REntry> fEntries;
+   std::unordered_map<ColumnId_t, RColumnIndex> fColumnIndexes;
+   /// Unreferenced pages, the least recently used first
+   std::list<void *> fLruList;
+   /// Upper limit of the memory held by the pages in the pool; referenced pages are never evicted and can exceed it
+   std::size_t fMemoryBudget = 0;
+   /// The sum of the page capacities of all pages in the pool
+   std::size_t fMemoryUsage = 0;
+   /// Guards all the members above, also for the read-only accessors
+   mutable std::mutex fLock;
+
+   /// Removes the page from the pool and frees its memory
+   void Erase(std::unordered_map<void *, REntry>::iterator itrEntry);
+   /// Evicts unreferenced pages until the memory usage is back within the budget
+   void Evict();
+   /// Increases the reference counter of a page found by GetPage()
+   RPage Acquire(void *buffer);
 
 public:
    RPagePool() = default;
+   explicit RPagePool(std::size_t memoryBudget) : fMemoryBudget(memoryBudget) {}
    RPagePool(const RPagePool&) = delete;
    RPagePool& operator =(const RPagePool&) = delete;
-   ~RPagePool() = default;
+   ~RPagePool();
 
    /// Adds a new page to the pool together with the function to free its space. Upon registration,
    /// the page pool takes ownership of the page's memory. The new page has its reference counter set to 1.
@@ -71,6 +104,18 @@ public:
    /// this page. If the reference counter drops to zero, the page pool might decide to call the deleter given in
    /// during registration.
    void ReturnPage(const RPage &page);
+
+   std::size_t GetMemoryBudget() const { return fMemoryBudget; }
+   std::size_t GetMemoryUsage() const
+   {
+      std::lock_guard<std::mutex> guard(fLock);
+      return fMemoryUsage;
+   }
+   std::size_t GetNPages() const
+   {
+      std::lock_guard<std::mutex> guard(fLock);
+      return fEntries.size();
+   }
 };
 
 } // namespace Detail
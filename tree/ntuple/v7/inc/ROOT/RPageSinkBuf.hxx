@@ -0,0 +1,85 @@
+/// \file ROOT/RPageSinkBuf.hxx
+/// \ingroup NTuple ROOT7
+/// \author The ROOT Team
+/// \date 2026-10-16
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RPageSinkBuf
+#define ROOT7_RPageSinkBuf
+
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RPage.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstddef>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSinkBuf
+\ingroup NTuple
+\brief Page sink that keeps the committed pages of the currently open cluster in memory
+
+Used by the fill contexts of the parallel writer: every thread fills its own model into its own buffered sink.
+Committed pages are copied into buffers owned by the sink, so that the page storage of the fields can be reused
+right away.  Once a cluster is complete, the buffered pages are handed over to the actual (shared) sink by
+CommitBufferedPages().  The buffered sink does not write anything itself; its descriptor is only used to issue
+the column ids, which match the ones of the shared sink because both sinks are created from the same model structure.
+*/
+// clang-format on
+class RPageSinkBuf : public RPageSink {
+private:
+   static constexpr std::size_t kDefaultElementsPerPage = 10000;
+
+   /// A deep copy of a committed page, together with the column it belongs to
+   struct RBufferedPage {
+      ColumnHandle_t fColumnHandle;
+      RPage fPage;
+   };
+
+   RNTupleMetrics fMetrics;
+   /// The pages of the currently open cluster in the order of their commit
+   std::vector<RBufferedPage> fBufferedPages;
+
+protected:
+   void DoCreate(const RNTupleModel &model) final;
+   RClusterDescriptor::RLocator DoCommitPage(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator DoCommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
+   RClusterDescriptor::RLocator DoCommitCluster(NTupleSize_t nEntries) final;
+   void DoCommitDataset() final;
+
+public:
+   RPageSinkBuf(std::string_view ntupleName, const RNTupleWriteOptions &options);
+   virtual ~RPageSinkBuf();
+
+   /// Commits the buffered pages to the target sink, in the order in which they have been committed to this sink,
+   /// and releases the page buffers.  The caller is responsible for serializing access to the target sink and for
+   /// committing the cluster on the target sink afterwards.
+   void CommitBufferedPages(RPageSink &target);
+   std::size_t GetNBufferedPages() const { return fBufferedPages.size(); }
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements = 0) final;
+   void ReleasePage(RPage &page) final;
+
+   RNTupleMetrics &GetMetrics() final { return fMetrics; }
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
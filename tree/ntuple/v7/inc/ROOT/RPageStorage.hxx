@@ -16,6 +16,7 @@
 #ifndef ROOT7_RPageStorage
 #define ROOT7_RPageStorage
 
+#include <ROOT/RCluster.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
@@ -25,6 +26,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 
 namespace ROOT {
@@ -74,6 +76,14 @@ public:
    /// The column handle identifies a column with the current open page storage
    using ColumnHandle_t = RColumnHandle;
 
+   /// A sealed page contains the bytes of a page as written to storage, i.e. packed and possibly compressed.  Sealed
+   /// pages can be copied from a page source to a page sink without unsealing them, e.g. when merging ntuples.
+   struct RSealedPage {
+      const void *fBuffer = nullptr;
+      std::uint32_t fSize = 0;
+      std::uint32_t fNElements = 0;
+   };
+
    /// Register a new column.  When reading, the column must exist in the ntuple on disk corresponding to the meta-data.
    /// When writing, every column can only be attached once.
    virtual ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) = 0;
@@ -86,6 +96,8 @@ public:
 
    /// Page storage implementations usually have their own metrics
    virtual RNTupleMetrics &GetMetrics() = 0;
+
+   const std::string &GetNTupleName() const { return fNTupleName; }
 };
 
 // clang-format off
@@ -117,6 +129,7 @@ protected:
 
    virtual void DoCreate(const RNTupleModel &model) = 0;
    virtual RClusterDescriptor::RLocator DoCommitPage(ColumnHandle_t columnHandle, const RPage &page) = 0;
+   virtual RClusterDescriptor::RLocator DoCommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage) = 0;
    virtual RClusterDescriptor::RLocator DoCommitCluster(NTupleSize_t nEntries) = 0;
    virtual void DoCommitDataset() = 0;
 
@@ -127,6 +140,9 @@ public:
    static std::unique_ptr<RPageSink> Create(std::string_view ntupleName, std::string_view location,
                                             const RNTupleWriteOptions &options = RNTupleWriteOptions());
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
+   const RNTupleWriteOptions &GetWriteOptions() const { return fOptions; }
+   /// The descriptor of the data written so far; the schema part is complete after Create()
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
 
@@ -136,6 +152,9 @@ public:
    void Create(RNTupleModel &model);
    /// Write a page to the storage. The column must have been added before.
    void CommitPage(ColumnHandle_t columnHandle, const RPage &page);
+   /// Write a page that has been sealed by another sink with the same column model and compression settings.  The
+   /// bytes are stored as they are.
+   void CommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage);
    /// Finalize the current cluster and create a new one for the following data.
    void CommitCluster(NTupleSize_t nEntries);
    /// Finalize the current cluster and the entrire data set.
@@ -160,6 +179,8 @@ class RPageSource : public RPageStorage {
 protected:
    const RNTupleReadOptions fOptions;
    RNTupleDescriptor fDescriptor;
+   /// The columns that have been added by AddColumn(); these are the columns that are loaded by LoadCluster()
+   RCluster::ColumnSet_t fActiveColumns;
 
    virtual RNTupleDescriptor DoAttach() = 0;
 
@@ -186,6 +207,24 @@ public:
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) = 0;
    /// Another version of PopulatePage that allows to specify cluster-relative indexes
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex) = 0;
+
+   /// Populates all the pages of the given cluster id and columns; it is possible that some columns do not
+   /// contain any pages.  The page source may load more columns than the minimal necessary set from `columns`.
+   /// To indicate which columns have been loaded, LoadCluster() must mark them with SetColumnAvailable().
+   /// That includes the ones from the `columns` that don't have pages; otherwise subsequent requests
+   /// for the cluster would assume an incomplete cluster and trigger loading again.
+   /// LoadCluster() is called from the I/O thread of the cluster pool and must not modify the page source state
+   /// that is used by the thread owning the page source.
+   virtual std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns) = 0;
+   /// Decompresses and unpacks the pages of a loaded cluster ahead of time, such that PopulatePage() can hand out
+   /// the unzipped pages without further processing.  Called from the unzip thread of the cluster pool; the same
+   /// thread-safety rules as for LoadCluster() apply.
+   virtual void UnzipCluster(RCluster *cluster) = 0;
+
+   /// Reads the bytes of the given page as they are stored, i.e. without decompressing and unpacking them.  The
+   /// buffer must be large enough to hold the number of bytes on storage given by the page's locator.
+   virtual RSealedPage LoadSealedPage(DescriptorId_t columnId, DescriptorId_t clusterId, NTupleSize_t pageNo,
+                                      void *buffer) = 0;
 };
 
 } // namespace Detail
@@ -23,7 +23,10 @@
 #include <array>
 #include <cstdint>
 #include <cstdio>
+#include <deque>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace ROOT {
 
@@ -32,8 +35,13 @@ class RRawFile;
 }
 
 namespace Experimental {
+
+class TTaskGroup;
+
 namespace Detail {
 
+class RClusterPool;
+class RColumnElementBase;
 class RPageAllocatorHeap;
 class RPagePool;
 
@@ -49,6 +57,21 @@ private:
    static constexpr std::size_t kDefaultElementsPerPage = 10000;
    /// Cannot process pages larger than 1MB
    static constexpr std::size_t kMaxPageSize = 1024 * 1024;
+   /// Uncompressed pages start at file offsets that are a multiple of the alignment, such that readers can use
+   /// them in place from a memory mapping of the file
+   static constexpr std::size_t kUncompressedPageAlignment = 8;
+
+   /// A packed page that is compressed by a task of the implicit multi-threading pool and written on cluster commit
+   struct RPendingPage {
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      /// The index of the page in the page range of the currently open cluster
+      std::size_t fPageIndex = 0;
+      std::unique_ptr<unsigned char []> fPackedBuffer;
+      std::size_t fPackedSize = 0;
+      /// Remains empty if compression does not reduce the size of the page
+      std::unique_ptr<unsigned char []> fZipBuffer;
+      std::size_t fZipSize = 0;
+   };
 
    RNTupleMetrics fMetrics;
    std::unique_ptr<RPageAllocatorHeap> fPageAllocator;
@@ -56,12 +79,22 @@ private:
    FILE *fFile = nullptr;
    size_t fFilePos = 0;
    size_t fClusterStart = 0;
+   /// The pages of the currently open cluster that are compressed in parallel; a deque keeps references to the
+   /// elements valid while new pages are added
+   std::deque<RPendingPage> fPendingPages;
+   /// Set if pages are compressed in parallel; must be destructed before the pending pages
+   std::unique_ptr<TTaskGroup> fTaskGroup;
 
    void Write(const void *buffer, std::size_t nbytes);
+   /// Writes zero bytes until the file position is a multiple of kUncompressedPageAlignment
+   void WritePadding();
+   /// Compresses the packed page into its zip buffer; called concurrently by the tasks of the task group
+   static void CompressPage(RPendingPage &page, int compression);
 
 protected:
    void DoCreate(const RNTupleModel &model) final;
    RClusterDescriptor::RLocator DoCommitPage(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator DoCommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
    RClusterDescriptor::RLocator DoCommitCluster(NTupleSize_t nEntries) final;
    void DoCommitDataset() final;
 
@@ -107,22 +140,72 @@ private:
    std::shared_ptr<RPagePool> fPagePool;
    std::unique_ptr<std::array<unsigned char, kMaxPageSize>> fUnzipBuffer;
    std::unique_ptr<ROOT::Internal::RRawFile> fFile;
+   /// A second handle to the file that is used exclusively by the I/O thread of the cluster pool
+   std::unique_ptr<ROOT::Internal::RRawFile> fClusterFile;
 
    RNTupleMetrics fMetrics;
-   RNTuplePlainCounter *fCtrNRead = nullptr;
-   RNTuplePlainCounter *fCtrSzRead = nullptr;
-   RNTuplePlainCounter *fCtrSzUnzip = nullptr;
+   /// Updated by the thread owning the page source and by the I/O and the unzip thread of the cluster pool
+   RNTupleAtomicCounter *fCtrNRead = nullptr;
+   RNTupleAtomicCounter *fCtrSzRead = nullptr;
+   RNTupleAtomicCounter *fCtrSzUnzip = nullptr;
    RNTuplePlainCounter *fCtrNPages = nullptr;
    RNTuplePlainCounter *fCtrTimeWallRead = nullptr;
    RNTuplePlainCounter *fCtrTimeWallUnzip = nullptr;
    RNTupleTickCounter<RNTuplePlainCounter> *fCtrTimeCpuRead = nullptr;
    RNTupleTickCounter<RNTuplePlainCounter> *fCtrTimeCpuUnzip = nullptr;
+   /// Updated by the I/O and the unzip thread of the cluster pool
+   RNTupleAtomicCounter *fCtrNClusterLoaded = nullptr;
+   RNTupleAtomicCounter *fCtrSzReadAhead = nullptr;
+   RNTupleAtomicCounter *fCtrNPageUnzipAhead = nullptr;
+   RNTuplePlainCounter *fCtrNPageMapped = nullptr;
+
+   /// The counters of an individual column, which tell which columns dominate the read cost.  Updated by the thread
+   /// owning the page source and by the threads of the cluster pool.  Read time is only accounted for pages that are
+   /// read individually; the vectored reads of the cluster pool cannot be attributed to a single column.
+   struct RColumnCounters {
+      explicit RColumnCounters(const std::string &name);
+      RNTupleMetrics fMetrics;
+      RNTupleAtomicCounter *fNPages = nullptr;
+      RNTupleAtomicCounter *fSzRead = nullptr;
+      RNTupleAtomicCounter *fSzUnzip = nullptr;
+      RNTupleAtomicCounter *fTimeWallRead = nullptr;
+      RNTupleTickCounter<RNTupleAtomicCounter> *fTimeCpuRead = nullptr;
+      RNTupleAtomicCounter *fTimeWallUnzip = nullptr;
+      RNTupleTickCounter<RNTupleAtomicCounter> *fTimeCpuUnzip = nullptr;
+      RNTupleAtomicCounter *fTimeWallUnpack = nullptr;
+      RNTupleTickCounter<RNTupleAtomicCounter> *fTimeCpuUnpack = nullptr;
+   };
+   /// Indexed by column id; created when attaching to the ntuple and observed by fMetrics
+   std::vector<std::unique_ptr<RColumnCounters>> fColumnCounters;
+
+   /// A read-only memory mapping of the entire file
+   struct RMappedFile;
+   /// Set if memory mapping is requested by the read options and supported by the file.  Uncompressed pages of
+   /// mappable columns are then used in place.  The deleters of such pages share the ownership of the mapping, so
+   /// that the pages in the page pool stay valid even if the pool outlives the page source.
+   std::shared_ptr<RMappedFile> fMappedFile;
+
+   /// Loads and unzips the clusters following the current one in the background; must be destructed before the
+   /// other members used by LoadCluster() and UnzipCluster()
+   std::unique_ptr<RClusterPool> fClusterPool;
 
    RPageSourceRaw(std::string_view ntupleName, const RNTupleReadOptions &options);
    void Read(void *buffer, std::size_t nbytes, std::uint64_t offset);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle,
                                  const RClusterDescriptor &clusterDescriptor,
                                  ClusterSize_t::ValueType clusterIndex);
+   /// Decompresses and unpacks an on-disk page into newly allocated memory of the in-memory page size.  The unzip
+   /// buffer needs to have a size of at least kMaxPageSize.  Accounts the unzipped volume both in the column counters
+   /// and in the page source counters.
+   void *UnsealPage(const RColumnElementBase &element, const ROnDiskPage &onDiskPage,
+                    ClusterSize_t::ValueType nElements, unsigned char *unzipBuffer, RColumnCounters &counters);
+   /// Sets up fColumnCounters for all the columns of the descriptor; the metrics are named after the qualified
+   /// field name and the column index, e.g. "jets.pt#0"
+   void CreateColumnCounters(const RNTupleDescriptor &descriptor);
+   /// Returns the address of the page in the file mapping if the page can be used in place, i.e. if it is
+   /// uncompressed, its column type maps to its in-memory type, and it is properly aligned.  Otherwise returns nullptr.
+   void *GetMappedAddress(const RColumnElementBase &element,
+                          const RClusterDescriptor::RPageRange::RPageInfo &pageInfo) const;
 
 protected:
    RNTupleDescriptor DoAttach() final;
@@ -136,6 +219,11 @@ public:
    RPage PopulatePage(ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex) final;
    void ReleasePage(RPage &page) final;
 
+   std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns) final;
+   void UnzipCluster(RCluster *cluster) final;
+   RSealedPage LoadSealedPage(DescriptorId_t columnId, DescriptorId_t clusterId, NTupleSize_t pageNo,
+                              void *buffer) final;
+
    RNTupleMetrics &GetMetrics() final { return fMetrics; }
 };
 
@@ -78,6 +78,7 @@ private:
 protected:
    void DoCreate(const RNTupleModel &model) final;
    RClusterDescriptor::RLocator DoCommitPage(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator DoCommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
    RClusterDescriptor::RLocator DoCommitCluster(NTupleSize_t nEntries) final;
    void DoCommitDataset() final;
 
@@ -138,6 +139,11 @@ public:
    RPage PopulatePage(ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex) final;
    void ReleasePage(RPage &page) final;
 
+   std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns) final;
+   void UnzipCluster(RCluster * /* cluster */) final { }
+   RSealedPage LoadSealedPage(DescriptorId_t columnId, DescriptorId_t clusterId, NTupleSize_t pageNo,
+                              void *buffer) final;
+
    RNTupleMetrics &GetMetrics() final { return fMetrics; }
 };
 
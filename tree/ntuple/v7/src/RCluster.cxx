@@ -0,0 +1,122 @@
+/// \file RCluster.cxx
+/// \ingroup NTuple ROOT7
+/// \author The ROOT Team
+/// \date 2026-10-16
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RCluster.hxx>
+
+#include <TError.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+
+ROOT::Experimental::Detail::ROnDiskPageMap::~ROnDiskPageMap()
+{
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+ROOT::Experimental::Detail::ROnDiskPageMapHeap::~ROnDiskPageMapHeap()
+{
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+ROOT::Experimental::Detail::RCluster::~RCluster()
+{
+   for (auto &entry : fUnzippedPages) {
+      entry.second.fDeleter(entry.second.fPage);
+   }
+}
+
+
+void ROOT::Experimental::Detail::RCluster::Adopt(std::unique_ptr<ROnDiskPageMap> pageMap)
+{
+   auto &pages = pageMap->fOnDiskPages;
+   fOnDiskPages.insert(std::make_move_iterator(pages.begin()), std::make_move_iterator(pages.end()));
+   pageMap->fOnDiskPages.clear();
+   fPageMaps.emplace_back(std::move(pageMap));
+}
+
+
+void ROOT::Experimental::Detail::RCluster::Adopt(RCluster &&other)
+{
+   R__ASSERT(fClusterId == other.fClusterId);
+
+   auto &pages = other.fOnDiskPages;
+   fOnDiskPages.insert(std::make_move_iterator(pages.begin()), std::make_move_iterator(pages.end()));
+   other.fOnDiskPages.clear();
+
+   auto &columns = other.fAvailColumns;
+   fAvailColumns.insert(std::make_move_iterator(columns.begin()), std::make_move_iterator(columns.end()));
+   other.fAvailColumns.clear();
+
+   // Unzipped pages that are already present in this cluster are left with the other cluster, which releases them
+   for (auto itr = other.fUnzippedPages.begin(); itr != other.fUnzippedPages.end(); ) {
+      if (fUnzippedPages.count(itr->first) == 0) {
+         fUnzippedPages.emplace(itr->first, itr->second);
+         itr = other.fUnzippedPages.erase(itr);
+      } else {
+         ++itr;
+      }
+   }
+
+   std::move(other.fPageMaps.begin(), other.fPageMaps.end(), std::back_inserter(fPageMaps));
+   other.fPageMaps.clear();
+}
+
+
+void ROOT::Experimental::Detail::RCluster::SetColumnAvailable(DescriptorId_t columnId)
+{
+   fAvailColumns.insert(columnId);
+}
+
+
+const ROOT::Experimental::Detail::ROnDiskPage *
+ROOT::Experimental::Detail::RCluster::GetOnDiskPage(const ROnDiskPage::Key &key) const
+{
+   const auto itr = fOnDiskPages.find(key);
+   if (itr != fOnDiskPages.end())
+      return &(itr->second);
+   return nullptr;
+}
+
+
+void ROOT::Experimental::Detail::RCluster::AddUnzippedPage(
+   const ROnDiskPage::Key &key, const RPage &page, const RPageDeleter &deleter)
+{
+   R__ASSERT(fUnzippedPages.count(key) == 0);
+   RUnzippedPage unzippedPage;
+   unzippedPage.fPage = page;
+   unzippedPage.fDeleter = deleter;
+   fUnzippedPages.emplace(key, unzippedPage);
+}
+
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RCluster::TakeUnzippedPage(const ROnDiskPage::Key &key, RPageDeleter &deleter)
+{
+   auto itr = fUnzippedPages.find(key);
+   if (itr == fUnzippedPages.end())
+      return RPage();
+   auto page = itr->second.fPage;
+   deleter = itr->second.fDeleter;
+   fUnzippedPages.erase(itr);
+   return page;
+}
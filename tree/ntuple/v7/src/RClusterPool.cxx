@@ -0,0 +1,239 @@
+/// \file RClusterPool.cxx
+/// \ingroup NTuple ROOT7
+/// \author The ROOT Team
+/// \date 2026-10-16
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RClusterPool.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <TError.h>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <utility>
+
+ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int lookahead)
+   : fPageSource(pageSource)
+   , fLookahead(lookahead)
+   , fThreadIo(&RClusterPool::ExecReadClusters, this)
+   , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
+{
+}
+
+ROOT::Experimental::Detail::RClusterPool::~RClusterPool()
+{
+   {
+      // An item with an invalid cluster id is the stop signal for the I/O thread, which passes it on to the
+      // unzip thread after the outstanding work has been done
+      std::unique_lock<std::mutex> lock(fLockReadQueue);
+      fReadQueue.emplace_back(RReadItem());
+   }
+   fCvHasReadWork.notify_one();
+   fThreadIo.join();
+   fThreadUnzip.join();
+}
+
+void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
+{
+   while (true) {
+      std::deque<RReadItem> readItems;
+      {
+         std::unique_lock<std::mutex> lock(fLockReadQueue);
+         fCvHasReadWork.wait(lock, [&]{ return !fReadQueue.empty(); });
+         std::swap(readItems, fReadQueue);
+      }
+
+      while (!readItems.empty()) {
+         auto item = std::move(readItems.front());
+         readItems.pop_front();
+
+         RUnzipItem unzipItem;
+         if (item.fClusterId == kInvalidDescriptorId) {
+            // Forward the stop signal
+            {
+               std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+               fUnzipQueue.emplace_back(std::move(unzipItem));
+            }
+            fCvHasUnzipWork.notify_one();
+            return;
+         }
+
+         try {
+            unzipItem.fCluster = fPageSource.LoadCluster(item.fClusterId, item.fColumns);
+         } catch (...) {
+            item.fPromise.set_exception(std::current_exception());
+            continue;
+         }
+         unzipItem.fPromise = std::move(item.fPromise);
+         {
+            std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+            fUnzipQueue.emplace_back(std::move(unzipItem));
+         }
+         fCvHasUnzipWork.notify_one();
+      }
+   }
+}
+
+void ROOT::Experimental::Detail::RClusterPool::ExecUnzipClusters()
+{
+   while (true) {
+      std::deque<RUnzipItem> unzipItems;
+      {
+         std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+         fCvHasUnzipWork.wait(lock, [&]{ return !fUnzipQueue.empty(); });
+         std::swap(unzipItems, fUnzipQueue);
+      }
+
+      while (!unzipItems.empty()) {
+         auto item = std::move(unzipItems.front());
+         unzipItems.pop_front();
+         if (!item.fCluster)
+            return;
+
+         try {
+            fPageSource.UnzipCluster(item.fCluster.get());
+         } catch (...) {
+            item.fPromise.set_exception(std::current_exception());
+            continue;
+         }
+         item.fPromise.set_value(std::move(item.fCluster));
+      }
+   }
+}
+
+ROOT::Experimental::Detail::RCluster *
+ROOT::Experimental::Detail::RClusterPool::FindInPool(DescriptorId_t clusterId) const
+{
+   for (const auto &cluster : fPool) {
+      if (cluster->GetId() == clusterId)
+         return cluster.get();
+   }
+   return nullptr;
+}
+
+void ROOT::Experimental::Detail::RClusterPool::Receive(RInFlightCluster &inFlight)
+{
+   auto cluster = inFlight.fFuture.get();
+   if (inFlight.fIsExpired)
+      return;
+
+   auto poolCluster = FindInPool(inFlight.fClusterId);
+   if (poolCluster == nullptr) {
+      fPool.emplace_back(std::move(cluster));
+   } else {
+      poolCluster->Adopt(std::move(*cluster));
+   }
+}
+
+ROOT::Experimental::Detail::RCluster *
+ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
+                                                     const RCluster::ColumnSet_t &columns)
+{
+   const auto &desc = fPageSource.GetDescriptor();
+
+   // The requested cluster and its successors form the window of clusters that should be kept in memory
+   std::vector<DescriptorId_t> window{clusterId};
+   for (unsigned int i = 0; i < fLookahead; ++i) {
+      auto next = desc.FindNextClusterId(window.back());
+      if (next == kInvalidDescriptorId)
+         break;
+      window.emplace_back(next);
+   }
+   auto fnInWindow = [&window](DescriptorId_t id) {
+      return std::find(window.begin(), window.end(), id) != window.end();
+   };
+
+   // Evict clusters that left the window; in-flight clusters that left the window are discarded on arrival
+   fPool.erase(std::remove_if(fPool.begin(), fPool.end(),
+                              [&](const std::unique_ptr<RCluster> &c) { return !fnInWindow(c->GetId()); }),
+               fPool.end());
+   for (auto &inFlight : fInFlightClusters) {
+      inFlight.fIsExpired = !fnInWindow(inFlight.fClusterId);
+   }
+
+   // Collect the clusters that arrived in the meantime without blocking
+   for (auto itr = fInFlightClusters.begin(); itr != fInFlightClusters.end(); ) {
+      if (itr->fFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+         ++itr;
+         continue;
+      }
+      auto inFlight = std::move(*itr);
+      itr = fInFlightClusters.erase(itr);
+      if (inFlight.fIsExpired || (inFlight.fClusterId != clusterId)) {
+         // Errors are only relevant for the requested cluster; for others, the page source falls back to reading
+         // the pages synchronously
+         try {
+            Receive(inFlight);
+         } catch (...) {
+         }
+      } else {
+         Receive(inFlight);
+      }
+   }
+
+   // Schedule loading of the columns that are neither in the pool nor in-flight
+   bool hasNewWork = false;
+   {
+      std::unique_lock<std::mutex> lock(fLockReadQueue);
+      for (auto id : window) {
+         RCluster::ColumnSet_t missingColumns = columns;
+         auto poolCluster = FindInPool(id);
+         bool isKnown = (poolCluster != nullptr);
+         if (poolCluster) {
+            for (auto columnId : poolCluster->GetAvailColumns())
+               missingColumns.erase(columnId);
+         }
+         for (const auto &inFlight : fInFlightClusters) {
+            if (inFlight.fClusterId != id)
+               continue;
+            isKnown = true;
+            for (auto columnId : inFlight.fColumns)
+               missingColumns.erase(columnId);
+         }
+         if (missingColumns.empty() && isKnown)
+            continue;
+
+         RReadItem readItem;
+         readItem.fClusterId = id;
+         readItem.fColumns = missingColumns;
+
+         RInFlightCluster inFlight;
+         inFlight.fFuture = readItem.fPromise.get_future();
+         inFlight.fClusterId = id;
+         inFlight.fColumns = std::move(missingColumns);
+
+         fReadQueue.emplace_back(std::move(readItem));
+         fInFlightClusters.emplace_back(std::move(inFlight));
+         hasNewWork = true;
+      }
+   }
+   if (hasNewWork)
+      fCvHasReadWork.notify_one();
+
+   // Wait for the requested cluster
+   for (auto itr = fInFlightClusters.begin(); itr != fInFlightClusters.end(); ) {
+      if (itr->fClusterId != clusterId) {
+         ++itr;
+         continue;
+      }
+      auto inFlight = std::move(*itr);
+      itr = fInFlightClusters.erase(itr);
+      Receive(inFlight);
+   }
+
+   auto result = FindInPool(clusterId);
+   R__ASSERT(result != nullptr);
+   return result;
+}
@@ -15,6 +15,7 @@
 
 #include <ROOT/RColumn.hxx>
 #include <ROOT/RColumnModel.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RPageStorage.hxx>
 
 #include <TError.h>
@@ -49,12 +50,24 @@ void ROOT::Experimental::Detail::RColumn::Connect(DescriptorId_t fieldId, RPageS
       fHandleSource = fPageSource->AddColumn(fieldId, *this);
       fNElements = fPageSource->GetNElements(fHandleSource);
       fColumnIdSource = fPageSource->GetColumnId(fHandleSource);
+      SetEncoding(fPageSource->GetDescriptor().GetColumnDescriptor(fColumnIdSource).GetModel().GetEncoding());
       break;
    default:
       R__ASSERT(false);
    }
 }
 
+void ROOT::Experimental::Detail::RColumn::SetEncoding(EColumnEncoding encoding)
+{
+   if (encoding == fModel.GetEncoding())
+      return;
+   R__ASSERT(fPageSink == nullptr);
+   auto size = fElement->GetSize();
+   fModel = RColumnModel(fModel.GetType(), fModel.GetIsSorted(), encoding);
+   fElement = RColumnElementBase::Generate(fModel);
+   R__ASSERT(fElement->GetSize() == size);
+}
+
 void ROOT::Experimental::Detail::RColumn::Flush()
 {
    if (fHeadPage.GetSize() == 0) return;
@@ -20,31 +20,76 @@
 #include <algorithm>
 #include <bitset>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
 
-ROOT::Experimental::Detail::RColumnElementBase
+namespace {
+
+/// Stores the differences of consecutive elements in zigzag representation: 0, -1, 1, -2, 2, ... map to
+/// 0, 1, 2, 3, 4, ...  The arithmetic is unsigned such that wrap-arounds cancel out when decoding.
+template <typename UIntT>
+void EncodeDeltaZigzag(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   using IntT = typename std::make_signed<UIntT>::type;
+   UIntT prev = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      UIntT value;
+      std::memcpy(&value, src + i * sizeof(UIntT), sizeof(UIntT));
+      UIntT delta = value - prev;
+      UIntT zigzag = (delta << 1) ^ static_cast<UIntT>(static_cast<IntT>(delta) >> (sizeof(UIntT) * 8 - 1));
+      std::memcpy(dst + i * sizeof(UIntT), &zigzag, sizeof(UIntT));
+      prev = value;
+   }
+}
+
+template <typename UIntT>
+void DecodeDeltaZigzag(unsigned char *dst, const unsigned char *src, std::size_t count)
+{
+   UIntT prev = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      UIntT zigzag;
+      std::memcpy(&zigzag, src + i * sizeof(UIntT), sizeof(UIntT));
+      UIntT delta = (zigzag >> 1) ^ (~(zigzag & 1) + 1);
+      prev += delta;
+      std::memcpy(dst + i * sizeof(UIntT), &prev, sizeof(UIntT));
+   }
+}
+
+} // anonymous namespace
+
+std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    switch (type) {
    case EColumnType::kReal32:
-      return RColumnElement<float, EColumnType::kReal32>(nullptr);
+      return std::make_unique<RColumnElement<float, EColumnType::kReal32>>(nullptr);
    case EColumnType::kReal64:
-      return RColumnElement<double, EColumnType::kReal64>(nullptr);
+      return std::make_unique<RColumnElement<double, EColumnType::kReal64>>(nullptr);
    case EColumnType::kByte:
-      return RColumnElement<std::uint8_t, EColumnType::kByte>(nullptr);
+      return std::make_unique<RColumnElement<std::uint8_t, EColumnType::kByte>>(nullptr);
    case EColumnType::kInt32:
-      return RColumnElement<std::int32_t, EColumnType::kInt32>(nullptr);
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kInt32>>(nullptr);
    case EColumnType::kInt64:
-      return RColumnElement<std::int64_t, EColumnType::kInt64>(nullptr);
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kInt64>>(nullptr);
    case EColumnType::kBit:
-      return RColumnElement<bool, EColumnType::kBit>(nullptr);
+      return std::make_unique<RColumnElement<bool, EColumnType::kBit>>(nullptr);
    case EColumnType::kIndex:
-      return RColumnElement<ClusterSize_t, EColumnType::kIndex>(nullptr);
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
-      return RColumnElement<RColumnSwitch, EColumnType::kSwitch>(nullptr);
+      return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
    default:
       R__ASSERT(false);
    }
    // never here
-   return RColumnElementBase();
+   return nullptr;
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
+ROOT::Experimental::Detail::RColumnElementBase::Generate(const RColumnModel &model) {
+   auto element = Generate(model.GetType());
+   if (model.GetEncoding() == EColumnEncoding::kPlain)
+      return element;
+   return std::make_unique<RColumnElementEncoded>(model.GetType(), element->GetSize(), model.GetEncoding());
 }
 
 void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit>::Pack(
@@ -80,3 +125,110 @@ void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColum
       }
    }
 }
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::Detail::RColumnElementEncoded::RColumnElementEncoded(
+   EColumnType type, std::size_t size, EColumnEncoding encoding)
+   : RColumnElementBase(nullptr, size), fType(type), fEncoding(encoding)
+{
+   R__ASSERT(IsApplicable(type, encoding));
+   R__ASSERT(encoding != EColumnEncoding::kPlain);
+}
+
+bool ROOT::Experimental::Detail::RColumnElementEncoded::IsApplicable(EColumnType type, EColumnEncoding encoding)
+{
+   switch (encoding) {
+   case EColumnEncoding::kPlain:
+      return true;
+   case EColumnEncoding::kDeltaZigzag:
+      return (type == EColumnType::kIndex) || (type == EColumnType::kInt32) || (type == EColumnType::kInt64);
+   case EColumnEncoding::kByteSplit:
+      return (type == EColumnType::kIndex) || (type == EColumnType::kInt32) || (type == EColumnType::kInt64) ||
+             (type == EColumnType::kReal32) || (type == EColumnType::kReal64);
+   case EColumnEncoding::kBFloat16:
+      return type == EColumnType::kReal32;
+   default:
+      return false;
+   }
+}
+
+std::size_t ROOT::Experimental::Detail::RColumnElementEncoded::GetBitsOnStorage() const
+{
+   if (fEncoding == EColumnEncoding::kBFloat16)
+      return 16;
+   return fSize * 8;
+}
+
+void ROOT::Experimental::Detail::RColumnElementEncoded::Pack(void *dst, void *src, std::size_t count) const
+{
+   auto dstBytes = reinterpret_cast<unsigned char *>(dst);
+   auto srcBytes = reinterpret_cast<const unsigned char *>(src);
+   switch (fEncoding) {
+   case EColumnEncoding::kDeltaZigzag:
+      if (fSize == sizeof(std::uint32_t)) {
+         EncodeDeltaZigzag<std::uint32_t>(dstBytes, srcBytes, count);
+      } else {
+         R__ASSERT(fSize == sizeof(std::uint64_t));
+         EncodeDeltaZigzag<std::uint64_t>(dstBytes, srcBytes, count);
+      }
+      break;
+   case EColumnEncoding::kByteSplit:
+      for (std::size_t i = 0; i < count; ++i) {
+         for (std::size_t b = 0; b < fSize; ++b)
+            dstBytes[b * count + i] = srcBytes[i * fSize + b];
+      }
+      break;
+   case EColumnEncoding::kBFloat16:
+      for (std::size_t i = 0; i < count; ++i) {
+         std::uint32_t bits;
+         std::memcpy(&bits, srcBytes + i * sizeof(float), sizeof(float));
+         if ((bits & 0x7fffffff) > 0x7f800000) {
+            // NaN: keep it a (quiet) NaN after dropping the lower bits of the mantissa
+            bits |= 0x00400000;
+         } else {
+            // Round to nearest, ties to even
+            bits += 0x7fff + ((bits >> 16) & 1);
+         }
+         std::uint16_t truncated = bits >> 16;
+         std::memcpy(dstBytes + i * sizeof(truncated), &truncated, sizeof(truncated));
+      }
+      break;
+   default:
+      R__ASSERT(false);
+   }
+}
+
+void ROOT::Experimental::Detail::RColumnElementEncoded::Unpack(void *dst, void *src, std::size_t count) const
+{
+   auto dstBytes = reinterpret_cast<unsigned char *>(dst);
+   auto srcBytes = reinterpret_cast<const unsigned char *>(src);
+   switch (fEncoding) {
+   case EColumnEncoding::kDeltaZigzag:
+      if (fSize == sizeof(std::uint32_t)) {
+         DecodeDeltaZigzag<std::uint32_t>(dstBytes, srcBytes, count);
+      } else {
+         R__ASSERT(fSize == sizeof(std::uint64_t));
+         DecodeDeltaZigzag<std::uint64_t>(dstBytes, srcBytes, count);
+      }
+      break;
+   case EColumnEncoding::kByteSplit:
+      for (std::size_t i = 0; i < count; ++i) {
+         for (std::size_t b = 0; b < fSize; ++b)
+            dstBytes[i * fSize + b] = srcBytes[b * count + i];
+      }
+      break;
+   case EColumnEncoding::kBFloat16:
+      for (std::size_t i = 0; i < count; ++i) {
+         std::uint16_t truncated;
+         std::memcpy(&truncated, srcBytes + i * sizeof(truncated), sizeof(truncated));
+         std::uint32_t bits = static_cast<std::uint32_t>(truncated) << 16;
+         std::memcpy(dstBytes + i * sizeof(float), &bits, sizeof(float));
+      }
+      break;
+   default:
+      R__ASSERT(false);
+   }
+}
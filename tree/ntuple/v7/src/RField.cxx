@@ -77,8 +77,13 @@ void ROOT::Experimental::Detail::RFieldFuse::Connect(DescriptorId_t fieldId, RPa
 {
    if (field.fColumns.empty())
       field.DoGenerateColumns();
-   for (auto& column : field.fColumns)
+   for (auto& column : field.fColumns) {
+      if ((pageStorage.GetType() == EPageStorageType::kSink) &&
+          RColumnElementEncoded::IsApplicable(column->GetModel().GetType(), field.fColumnEncoding)) {
+         column->SetEncoding(field.fColumnEncoding);
+      }
       column->Connect(fieldId, &pageStorage);
+   }
 }
 
 
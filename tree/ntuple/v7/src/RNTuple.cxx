@@ -17,6 +17,7 @@
 
 #include "ROOT/RFieldVisitor.hxx"
 #include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RPageSinkBuf.hxx"
 #include "ROOT/RPageStorage.hxx"
 
 #include <algorithm>
@@ -27,6 +28,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include <TError.h>
 #include <TFile.h>
 #include <ROOT/RPageStorageRoot.hxx>
 
@@ -52,6 +54,36 @@ void ROOT::Experimental::RNTupleReader::ConnectModel() {
       R__ASSERT(fieldId != kInvalidDescriptorId);
       fieldPtr2Id[&field] = fieldId;
       Detail::RFieldFuse::Connect(fieldId, *fSource, field);
+      if (field.GetParent() != fModel->GetRootField())
+         continue;
+      auto counters = std::make_unique<RFieldCounters>(field.GetName());
+      fMetrics.ObserveMetrics(counters->fMetrics);
+      fFieldCounters[&field] = std::move(counters);
+   }
+}
+
+ROOT::Experimental::RNTupleReader::RFieldCounters::RFieldCounters(const std::string &name)
+   : fMetrics(name)
+{
+   fNRead = fMetrics.MakeCounter<decltype(fNRead)>("nRead", "", "number of deserialized values");
+   fTimeWallRead = fMetrics.MakeCounter<decltype(fTimeWallRead)>(
+      "timeWallRead", "ns", "wall clock time spent deserializing values");
+   fTimeCpuRead = fMetrics.MakeCounter<decltype(fTimeCpuRead)>(
+      "timeCpuRead", "ns", "CPU time spent deserializing values");
+}
+
+void ROOT::Experimental::RNTupleReader::LoadEntryInstrumented(NTupleSize_t index, REntry *entry)
+{
+   for (auto &value : *entry) {
+      auto itrCounters = fFieldCounters.find(value.GetField());
+      if (itrCounters == fFieldCounters.end()) {
+         value.GetField()->Read(index, &value);
+         continue;
+      }
+      auto &counters = *itrCounters->second;
+      Detail::RNTuplePlainTimer timer(*counters.fTimeWallRead, *counters.fTimeCpuRead);
+      value.GetField()->Read(index, &value);
+      counters.fNRead->Inc();
    }
 }
 
@@ -197,6 +229,108 @@ void ROOT::Experimental::RNTupleWriter::CommitCluster()
 //------------------------------------------------------------------------------
 
 
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(RNTupleParallelWriter &writer,
+                                                           std::unique_ptr<RNTupleModel> model)
+   : ROOT::Experimental::Detail::RNTuple(std::move(model))
+   , fWriter(writer)
+   , fSink(std::make_unique<Detail::RPageSinkBuf>(writer.fSink->GetNTupleName(), RNTupleWriteOptions()))
+   , fClusterSizeEntries(kDefaultClusterSizeEntries)
+   , fLastCommitted(0)
+{
+   fSink->Create(*fModel.get());
+}
+
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   CommitCluster();
+   // needs to be destructed before the page sink
+   fModel = nullptr;
+   fWriter.ReleaseFillContext();
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted) return;
+   for (auto& field : *fModel->GetRootField()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   fSink->CommitCluster(fNEntries);
+   fWriter.CommitBufferedCluster(*fSink, fNEntries - fLastCommitted);
+   fLastCommitted = fNEntries;
+}
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(
+   std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
+   std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
+   : ROOT::Experimental::Detail::RNTuple(std::move(model))
+   , fSink(std::move(sink))
+{
+   // The writer's own model is never filled; it only provides the schema of the data set and the template for the
+   // models of the fill contexts
+   fSink->Create(*fModel.get());
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   R__ASSERT(fNFillContexts == 0);
+   fSink->CommitDataset();
+   // needs to be destructed before the page sink
+   fModel = nullptr;
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> ROOT::Experimental::RNTupleParallelWriter::Recreate(
+   std::unique_ptr<RNTupleModel> model,
+   std::string_view ntupleName,
+   std::string_view storage,
+   const RNTupleWriteOptions &options)
+{
+   return std::make_unique<RNTupleParallelWriter>(std::move(model),
+                                                  Detail::RPageSink::Create(ntupleName, storage, options));
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleFillContext>
+ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   std::lock_guard<std::mutex> guard(fLockSink);
+   // The cloned model has the same field structure, so that the buffered sink of the context issues the same
+   // column ids as the shared sink
+   std::unique_ptr<RNTupleModel> model(fModel->Clone());
+   std::unique_ptr<RNTupleFillContext> context(new RNTupleFillContext(*this, std::move(model)));
+   fNFillContexts++;
+   return context;
+}
+
+ROOT::Experimental::NTupleSize_t ROOT::Experimental::RNTupleParallelWriter::GetNEntries()
+{
+   std::lock_guard<std::mutex> guard(fLockSink);
+   return fNEntries;
+}
+
+void ROOT::Experimental::RNTupleParallelWriter::CommitBufferedCluster(Detail::RPageSinkBuf &bufferedSink,
+                                                                      NTupleSize_t nEntries)
+{
+   std::lock_guard<std::mutex> guard(fLockSink);
+   bufferedSink.CommitBufferedPages(*fSink);
+   fNEntries += nEntries;
+   fSink->CommitCluster(fNEntries);
+}
+
+void ROOT::Experimental::RNTupleParallelWriter::ReleaseFillContext()
+{
+   std::lock_guard<std::mutex> guard(fLockSink);
+   R__ASSERT(fNFillContexts > 0);
+   fNFillContexts--;
+}
+
+
+//------------------------------------------------------------------------------
+
+
 ROOT::Experimental::RCollectionNTuple::RCollectionNTuple(std::unique_ptr<REntry> defaultEntry)
    : fOffset(0), fDefaultEntry(std::move(defaultEntry))
 {
@@ -295,6 +295,7 @@ std::uint32_t SerializeColumnModel(const ROOT::Experimental::RColumnModel &val,
 
    pos += SerializeInt32(static_cast<int>(val.GetType()), *where);
    pos += SerializeInt32(static_cast<int>(val.GetIsSorted()), *where);
+   pos += SerializeInt32(static_cast<int>(val.GetEncoding()), *where);
 
    auto size = pos - base;
    SerializeUInt32(size, ptrSize);
@@ -309,9 +310,14 @@ std::uint32_t DeserializeColumnModel(const void *buffer, ROOT::Experimental::RCo
 
    std::int32_t type;
    std::int32_t isSorted;
+   std::int32_t encoding = static_cast<std::int32_t>(ROOT::Experimental::EColumnEncoding::kPlain);
    bytes += DeserializeInt32(bytes, &type);
    bytes += DeserializeInt32(bytes, &isSorted);
-   *columnModel = ROOT::Experimental::RColumnModel(static_cast<ROOT::Experimental::EColumnType>(type), isSorted);
+   // Column models written before the introduction of encodings lack the encoding
+   if (bytes < reinterpret_cast<const unsigned char *>(buffer) + frameSize)
+      bytes += DeserializeInt32(bytes, &encoding);
+   *columnModel = ROOT::Experimental::RColumnModel(static_cast<ROOT::Experimental::EColumnType>(type), isSorted,
+                                                   static_cast<ROOT::Experimental::EColumnEncoding>(encoding));
 
    return frameSize;
 }
@@ -694,6 +700,20 @@ ROOT::Experimental::RNTupleDescriptor::FindClusterId(DescriptorId_t columnId, NT
 }
 
 
+ROOT::Experimental::DescriptorId_t
+ROOT::Experimental::RNTupleDescriptor::FindNextClusterId(DescriptorId_t clusterId) const
+{
+   const auto &clusterDesc = GetClusterDescriptor(clusterId);
+   auto firstEntryInNextCluster = clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries();
+   // TODO(jblomer): binary search?
+   for (const auto &cd : fClusterDescriptors) {
+      if ((cd.second.GetId() != clusterId) && (cd.second.GetFirstEntryIndex() == firstEntryInNextCluster))
+         return cd.second.GetId();
+   }
+   return kInvalidDescriptorId;
+}
+
+
 std::unique_ptr<ROOT::Experimental::RNTupleModel> ROOT::Experimental::RNTupleDescriptor::GenerateModel() const
 {
    auto model = std::make_unique<RNTupleModel>();
@@ -50,6 +50,7 @@ struct ColumnInfo {
    std::uint64_t fBytesOnStorage = 0;
    std::uint32_t fElementSize = 0;
    ROOT::Experimental::EColumnType fType;
+   ROOT::Experimental::EColumnEncoding fEncoding;
    std::string fFieldName;
 
    bool operator <(const ColumnInfo &other) const {
@@ -92,6 +93,22 @@ static std::string GetColumnTypeName(ROOT::Experimental::EColumnType type)
    }
 }
 
+static std::string GetColumnEncodingName(ROOT::Experimental::EColumnEncoding encoding)
+{
+   switch (encoding) {
+   case ROOT::Experimental::EColumnEncoding::kPlain:
+      return "Plain";
+   case ROOT::Experimental::EColumnEncoding::kDeltaZigzag:
+      return "DeltaZigzag";
+   case ROOT::Experimental::EColumnEncoding::kByteSplit:
+      return "ByteSplit";
+   case ROOT::Experimental::EColumnEncoding::kBFloat16:
+      return "BFloat16";
+   default:
+      return "UNKNOWN";
+   }
+}
+
 } // anonymous namespace
 
 void ROOT::Experimental::RNTupleDescriptor::PrintInfo(std::ostream &output) const
@@ -113,13 +130,14 @@ void ROOT::Experimental::RNTupleDescriptor::PrintInfo(std::ostream &output) cons
    int compression = -1;
    for (const auto &column : fColumnDescriptors) {
       auto element = Detail::RColumnElementBase::Generate(column.second.GetModel().GetType());
-      auto elementSize = element.GetSize();
+      auto elementSize = element->GetSize();
 
       ColumnInfo info;
       info.fFieldId = column.second.GetFieldId();
       info.fLocalOrder = column.second.GetIndex();
       info.fElementSize = elementSize;
       info.fType = column.second.GetModel().GetType();
+      info.fEncoding = column.second.GetModel().GetEncoding();
 
       for (const auto &cluster : fClusterDescriptors) {
          auto columnRange = cluster.second.GetColumnRange(column.first);
@@ -188,7 +206,10 @@ void ROOT::Experimental::RNTupleDescriptor::PrintInfo(std::ostream &output) cons
       auto avgPageSize = (col.fNPages == 0) ? 0 : (col.fBytesOnStorage / col.fNPages);
       auto avgElementsPerPage = (col.fNPages == 0) ? 0 : (col.fNElements / col.fNPages);
       output << "  " << col.fFieldName << " [#" << col.fLocalOrder << "]" << "  --  "
-             << GetColumnTypeName(col.fType) << std::endl;
+             << GetColumnTypeName(col.fType);
+      if (col.fEncoding != EColumnEncoding::kPlain)
+         output << " (" << GetColumnEncodingName(col.fEncoding) << ")";
+      output << std::endl;
       output << "    # Elements:          " << col.fNElements << std::endl;
       output << "    # Pages:             " << col.fNPages << std::endl;
       output << "    Avg elements / page: " << avgElementsPerPage << std::endl;
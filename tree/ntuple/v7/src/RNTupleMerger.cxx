@@ -0,0 +1,153 @@
+/// \file RNTupleMerger.cxx
+/// \ingroup NTuple ROOT7
+/// \author The ROOT Team
+/// \date 2026-10-16
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RField.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <TError.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+std::vector<ROOT::Experimental::DescriptorId_t>
+ROOT::Experimental::RNTupleMerger::MapColumns(const RNTupleDescriptor &destination, const RNTupleDescriptor &source)
+{
+   if ((destination.GetNFields() != source.GetNFields()) || (destination.GetNColumns() != source.GetNColumns()))
+      throw std::runtime_error("RNTupleMerger: schema of ntuple " + source.GetName() + " does not match");
+
+   // The sink issues field ids in depth-first order, so that parent fields are mapped before their children
+   std::unordered_map<DescriptorId_t, DescriptorId_t> fieldMap;
+   for (DescriptorId_t fieldId = 0; fieldId < destination.GetNFields(); ++fieldId) {
+      const auto &fieldDesc = destination.GetFieldDescriptor(fieldId);
+      if (fieldDesc.GetParentId() == kInvalidDescriptorId) {
+         fieldMap[fieldId] = source.FindFieldId("", kInvalidDescriptorId);
+         continue;
+      }
+      auto sourceFieldId = source.FindFieldId(fieldDesc.GetFieldName(), fieldMap.at(fieldDesc.GetParentId()));
+      if ((sourceFieldId == kInvalidDescriptorId) ||
+          (source.GetFieldDescriptor(sourceFieldId).GetTypeName() != fieldDesc.GetTypeName()))
+      {
+         throw std::runtime_error("RNTupleMerger: field " + fieldDesc.GetFieldName() + " of ntuple " +
+                                  source.GetName() + " does not match");
+      }
+      fieldMap[fieldId] = sourceFieldId;
+   }
+
+   std::vector<DescriptorId_t> columnMap;
+   for (DescriptorId_t columnId = 0; columnId < destination.GetNColumns(); ++columnId) {
+      const auto &columnDesc = destination.GetColumnDescriptor(columnId);
+      auto sourceColumnId = source.FindColumnId(fieldMap.at(columnDesc.GetFieldId()), columnDesc.GetIndex());
+      if ((sourceColumnId == kInvalidDescriptorId) ||
+          !(source.GetColumnDescriptor(sourceColumnId).GetModel() == columnDesc.GetModel()))
+      {
+         throw std::runtime_error("RNTupleMerger: column model of ntuple " + source.GetName() + " does not match");
+      }
+      columnMap.emplace_back(sourceColumnId);
+   }
+   return columnMap;
+}
+
+
+std::vector<ROOT::Experimental::DescriptorId_t>
+ROOT::Experimental::RNTupleMerger::GetClustersInEntryOrder(const RNTupleDescriptor &desc)
+{
+   std::vector<DescriptorId_t> clusterIds;
+   for (DescriptorId_t clusterId = 0; clusterId < desc.GetNClusters(); ++clusterId)
+      clusterIds.emplace_back(clusterId);
+   std::sort(clusterIds.begin(), clusterIds.end(), [&desc](DescriptorId_t a, DescriptorId_t b) {
+      return desc.GetClusterDescriptor(a).GetFirstEntryIndex() < desc.GetClusterDescriptor(b).GetFirstEntryIndex();
+   });
+
+   NTupleSize_t nEntries = 0;
+   for (auto clusterId : clusterIds) {
+      const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+      if (clusterDesc.GetFirstEntryIndex() != nEntries)
+         throw std::runtime_error("RNTupleMerger: clusters of ntuple " + desc.GetName() + " are not contiguous");
+      nEntries += clusterDesc.GetNEntries();
+   }
+   return clusterIds;
+}
+
+
+void ROOT::Experimental::RNTupleMerger::Merge(const std::vector<Detail::RPageSource *> &sources,
+                                              Detail::RPageSink &destination)
+{
+   R__ASSERT(!sources.empty());
+   const auto &firstDesc = sources[0]->GetDescriptor();
+
+   // Check all the inputs against the first one before the output is created.  The column maps relate the column
+   // ids of the first source to the ones of the other sources.
+   const auto compression = destination.GetWriteOptions().GetCompression();
+   std::vector<std::vector<DescriptorId_t>> columnMaps;
+   std::vector<std::vector<DescriptorId_t>> clusterOrders;
+   for (auto source : sources) {
+      const auto &desc = source->GetDescriptor();
+      columnMaps.emplace_back(MapColumns(firstDesc, desc));
+      clusterOrders.emplace_back(GetClustersInEntryOrder(desc));
+      for (DescriptorId_t clusterId = 0; clusterId < desc.GetNClusters(); ++clusterId) {
+         const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+         for (auto columnId : columnMaps.back()) {
+            if (clusterDesc.GetColumnRange(columnId).fCompressionSettings != compression) {
+               throw std::runtime_error("RNTupleMerger: compression settings of ntuple " + desc.GetName() +
+                                        " do not match the output");
+            }
+         }
+      }
+   }
+
+   // The generated model does not know about the column encodings, which are taken over from the first source
+   auto model = firstDesc.GenerateModel();
+   std::unordered_map<const Detail::RFieldBase *, DescriptorId_t> fieldPtr2Id;
+   fieldPtr2Id[model->GetRootField()] = firstDesc.FindFieldId("", kInvalidDescriptorId);
+   for (auto &field : *model->GetRootField()) {
+      auto fieldId = firstDesc.FindFieldId(field.GetName(), fieldPtr2Id[field.GetParent()]);
+      R__ASSERT(fieldId != kInvalidDescriptorId);
+      fieldPtr2Id[&field] = fieldId;
+      auto columnId = firstDesc.FindColumnId(fieldId, 0);
+      if (columnId != kInvalidDescriptorId)
+         field.SetColumnEncoding(firstDesc.GetColumnDescriptor(columnId).GetModel().GetEncoding());
+   }
+   destination.Create(*model);
+   // The output is generated from the first source, so that this mapping cannot fail
+   auto destination2First = MapColumns(destination.GetDescriptor(), firstDesc);
+
+   std::vector<unsigned char> buffer;
+   NTupleSize_t nEntries = 0;
+   for (std::size_t i = 0; i < sources.size(); ++i) {
+      const auto &desc = sources[i]->GetDescriptor();
+      for (auto clusterId : clusterOrders[i]) {
+         const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+         for (DescriptorId_t columnId = 0; columnId < destination2First.size(); ++columnId) {
+            auto sourceColumnId = columnMaps[i][destination2First[columnId]];
+            const auto &pageInfos = clusterDesc.GetPageRange(sourceColumnId).fPageInfos;
+            for (NTupleSize_t pageNo = 0; pageNo < pageInfos.size(); ++pageNo) {
+               std::size_t bytesOnStorage = pageInfos[pageNo].fLocator.fBytesOnStorage;
+               buffer.resize(std::max(buffer.size(), bytesOnStorage));
+               auto sealedPage = sources[i]->LoadSealedPage(sourceColumnId, clusterId, pageNo, buffer.data());
+               destination.CommitSealedPage(columnId, sealedPage);
+            }
+         }
+         nEntries += clusterDesc.GetNEntries();
+         destination.CommitCluster(nEntries);
+      }
+   }
+   destination.CommitDataset();
+}
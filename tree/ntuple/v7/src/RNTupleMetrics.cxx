@@ -15,8 +15,48 @@
 
 #include <ROOT/RNTupleMetrics.hxx>
 
+#include <cstdio>
 #include <ostream>
 
+namespace {
+
+std::string EscapeJSON(const std::string &str)
+{
+   std::string result;
+   for (auto c : str) {
+      switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\t': result += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char code[7];
+            snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned int>(c));
+            result += code;
+         } else {
+            result += c;
+         }
+      }
+   }
+   return result;
+}
+
+/// Quotes all the fields, so that names and descriptions can contain commas
+std::string QuoteCSV(const std::string &str)
+{
+   std::string result = "\"";
+   for (auto c : str) {
+      if (c == '"')
+         result += '"';
+      result += c;
+   }
+   return result + "\"";
+}
+
+} // anonymous namespace
+
+
 ROOT::Experimental::Detail::RNTuplePerfCounter::~RNTuplePerfCounter()
 {
 }
@@ -50,6 +90,65 @@ void ROOT::Experimental::Detail::RNTupleMetrics::Print(std::ostream &output, con
    }
 }
 
+const ROOT::Experimental::Detail::RNTuplePerfCounter *
+ROOT::Experimental::Detail::RNTupleMetrics::GetCounter(const std::string &qualifiedName) const
+{
+   auto prefix = fName + kNamespaceSeperator;
+   if (qualifiedName.compare(0, prefix.length(), prefix) != 0)
+      return nullptr;
+   auto innerName = qualifiedName.substr(prefix.length());
+   for (const auto &c : fCounters) {
+      if (c->GetName() == innerName)
+         return c.get();
+   }
+   for (const auto m : fObservedMetrics) {
+      auto counter = m->GetCounter(innerName);
+      if (counter != nullptr)
+         return counter;
+   }
+   return nullptr;
+}
+
+void ROOT::Experimental::Detail::RNTupleMetrics::PrintCSV(std::ostream &output, const std::string &prefix) const
+{
+   if (prefix.empty())
+      output << "name,unit,description,value" << std::endl;
+   if (!fIsEnabled)
+      return;
+
+   for (const auto &c : fCounters) {
+      output << QuoteCSV(prefix + fName + kNamespaceSeperator + c->GetName()) << ','
+             << QuoteCSV(c->GetUnit()) << ',' << QuoteCSV(c->GetDescription()) << ','
+             << c->ValueToString() << std::endl;
+   }
+   for (const auto m : fObservedMetrics) {
+      m->PrintCSV(output, prefix + fName + kNamespaceSeperator);
+   }
+}
+
+void ROOT::Experimental::Detail::RNTupleMetrics::PrintJSON(std::ostream &output) const
+{
+   output << "{\"name\":\"" << EscapeJSON(fName) << "\",\"enabled\":" << (fIsEnabled ? "true" : "false");
+   output << ",\"counters\":[";
+   if (fIsEnabled) {
+      for (std::size_t i = 0; i < fCounters.size(); ++i) {
+         const auto &c = fCounters[i];
+         if (i > 0)
+            output << ',';
+         output << "{\"name\":\"" << EscapeJSON(c->GetName()) << "\",\"unit\":\"" << EscapeJSON(c->GetUnit())
+                << "\",\"description\":\"" << EscapeJSON(c->GetDescription())
+                << "\",\"value\":" << c->ValueToString() << '}';
+      }
+   }
+   output << "],\"metrics\":[";
+   for (std::size_t i = 0; i < fObservedMetrics.size(); ++i) {
+      if (i > 0)
+         output << ',';
+      fObservedMetrics[i]->PrintJSON(output);
+   }
+   output << "]}";
+}
+
 void ROOT::Experimental::Detail::RNTupleMetrics::Enable()
 {
    for (auto &c: fCounters)
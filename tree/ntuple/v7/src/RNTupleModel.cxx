@@ -21,6 +21,8 @@
 
 #include <cstdlib>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 
@@ -33,6 +35,13 @@ ROOT::Experimental::RNTupleModel* ROOT::Experimental::RNTupleModel::Clone()
 {
    auto cloneModel = new RNTupleModel();
    auto cloneRootField = static_cast<RFieldRoot*>(fRootField->Clone(""));
+   // Column encodings are a setting of the model rather than of the field types; the cloned tree of fields has the
+   // same structure, so that both trees can be walked in lockstep
+   auto itrClone = cloneRootField->begin();
+   for (const auto &f : *fRootField) {
+      itrClone->SetColumnEncoding(f.GetColumnEncoding());
+      ++itrClone;
+   }
    cloneModel->fRootField = std::unique_ptr<RFieldRoot>(cloneRootField);
    cloneModel->fDefaultEntry = std::unique_ptr<REntry>(cloneRootField->GenerateEntry());
    return cloneModel;
@@ -46,6 +55,20 @@ void ROOT::Experimental::RNTupleModel::AddField(std::unique_ptr<Detail::RFieldBa
 }
 
 
+void ROOT::Experimental::RNTupleModel::SetColumnEncoding(std::string_view fieldName, EColumnEncoding encoding)
+{
+   for (auto &f : *fRootField) {
+      if ((f.GetParent() != GetRootField()) || (f.GetName() != std::string(fieldName)))
+         continue;
+      f.SetColumnEncoding(encoding);
+      for (auto &subField : f)
+         subField.SetColumnEncoding(encoding);
+      return;
+   }
+   throw std::runtime_error("RNTupleModel: no top-level field named " + std::string(fieldName));
+}
+
+
 std::shared_ptr<ROOT::Experimental::RCollectionNTuple> ROOT::Experimental::RNTupleModel::MakeCollection(
    std::string_view fieldName, std::unique_ptr<RNTupleModel> collectionModel)
 {
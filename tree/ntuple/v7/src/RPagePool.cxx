@@ -20,59 +20,116 @@
 
 #include <cstdlib>
 
+ROOT::Experimental::Detail::RPagePool::~RPagePool()
+{
+   for (auto &entry : fEntries)
+      entry.second.fDeleter(entry.second.fPage);
+}
+
+void ROOT::Experimental::Detail::RPagePool::Erase(std::unordered_map<void *, REntry>::iterator itrEntry)
+{
+   auto &page = itrEntry->second.fPage;
+   auto buffer = page.GetBuffer();
+   auto &columnIndex = fColumnIndexes[page.GetColumnId()];
+   // Another page with the same range might have overwritten the index entry
+   auto itrGlobal = columnIndex.fByGlobalIndex.find(page.GetGlobalRangeFirst());
+   if ((itrGlobal != columnIndex.fByGlobalIndex.end()) && (itrGlobal->second == buffer))
+      columnIndex.fByGlobalIndex.erase(itrGlobal);
+   auto itrCluster = columnIndex.fByClusterIndex.find(
+      std::make_pair(page.GetClusterInfo().GetId(), page.GetClusterRangeFirst()));
+   if ((itrCluster != columnIndex.fByClusterIndex.end()) && (itrCluster->second == buffer))
+      columnIndex.fByClusterIndex.erase(itrCluster);
+
+   fMemoryUsage -= page.GetCapacity();
+   itrEntry->second.fDeleter(page);
+   fEntries.erase(itrEntry);
+}
+
+void ROOT::Experimental::Detail::RPagePool::Evict()
+{
+   while ((fMemoryUsage > fMemoryBudget) && !fLruList.empty()) {
+      auto itrEntry = fEntries.find(fLruList.front());
+      R__ASSERT(itrEntry != fEntries.end());
+      fLruList.pop_front();
+      Erase(itrEntry);
+   }
+}
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::Acquire(void *buffer)
+{
+   auto &entry = fEntries.at(buffer);
+   if (entry.fReferences == 0)
+      fLruList.erase(entry.fLruPosition);
+   entry.fReferences++;
+   return entry.fPage;
+}
+
 void ROOT::Experimental::Detail::RPagePool::RegisterPage(const RPage &page, const RPageDeleter &deleter)
 {
-   fPages.emplace_back(page);
-   fReferences.emplace_back(1);
-   fDeleters.emplace_back(deleter);
+   std::lock_guard<std::mutex> guard(fLock);
+   auto buffer = page.GetBuffer();
+   R__ASSERT(fEntries.count(buffer) == 0);
+   REntry entry;
+   entry.fPage = page;
+   entry.fDeleter = deleter;
+   entry.fReferences = 1;
+   fEntries.emplace(buffer, entry);
+
+   auto &columnIndex = fColumnIndexes[page.GetColumnId()];
+   columnIndex.fByGlobalIndex[page.GetGlobalRangeFirst()] = buffer;
+   columnIndex.fByClusterIndex[std::make_pair(page.GetClusterInfo().GetId(), page.GetClusterRangeFirst())] = buffer;
+
+   fMemoryUsage += page.GetCapacity();
+   Evict();
 }
 
 void ROOT::Experimental::Detail::RPagePool::ReturnPage(const RPage& page)
 {
    if (page.IsNull()) return;
 
-   unsigned int N = fPages.size();
-   for (unsigned i = 0; i < N; ++i) {
-      if (fPages[i] != page) continue;
-
-      if (--fReferences[i] == 0) {
-         fDeleters[i](fPages[i]);
-         fPages[i] = fPages[N-1];
-         fReferences[i] = fReferences[N-1];
-         fDeleters[i] = fDeleters[N-1];
-         fPages.resize(N-1);
-         fReferences.resize(N-1);
-         fDeleters.resize(N-1);
-      }
+   std::lock_guard<std::mutex> guard(fLock);
+   auto itrEntry = fEntries.find(page.GetBuffer());
+   R__ASSERT(itrEntry != fEntries.end());
+   auto &entry = itrEntry->second;
+   R__ASSERT(entry.fReferences > 0);
+   if (--entry.fReferences > 0)
       return;
-   }
-   R__ASSERT(false);
+
+   entry.fLruPosition = fLruList.insert(fLruList.end(), page.GetBuffer());
+   Evict();
 }
 
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage(
    ColumnId_t columnId, NTupleSize_t globalIndex)
 {
-   unsigned int N = fPages.size();
-   for (unsigned int i = 0; i < N; ++i) {
-      if (fReferences[i] == 0) continue;
-      if (fPages[i].GetColumnId() != columnId) continue;
-      if (!fPages[i].Contains(globalIndex)) continue;
-      fReferences[i]++;
-      return fPages[i];
-   }
-   return RPage();
+   std::lock_guard<std::mutex> guard(fLock);
+   auto itrColumn = fColumnIndexes.find(columnId);
+   if (itrColumn == fColumnIndexes.end())
+      return RPage();
+   const auto &index = itrColumn->second.fByGlobalIndex;
+   // Find the page with the largest first element that is less or equal to the requested one
+   auto itr = index.upper_bound(globalIndex);
+   if (itr == index.begin())
+      return RPage();
+   --itr;
+   if (!fEntries.at(itr->second).fPage.Contains(globalIndex))
+      return RPage();
+   return Acquire(itr->second);
 }
 
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage(
    ColumnId_t columnId, const RClusterIndex &clusterIndex)
 {
-   unsigned int N = fPages.size();
-   for (unsigned int i = 0; i < N; ++i) {
-      if (fReferences[i] == 0) continue;
-      if (fPages[i].GetColumnId() != columnId) continue;
-      if (!fPages[i].Contains(clusterIndex)) continue;
-      fReferences[i]++;
-      return fPages[i];
-   }
-   return RPage();
+   std::lock_guard<std::mutex> guard(fLock);
+   auto itrColumn = fColumnIndexes.find(columnId);
+   if (itrColumn == fColumnIndexes.end())
+      return RPage();
+   const auto &index = itrColumn->second.fByClusterIndex;
+   auto itr = index.upper_bound(std::make_pair(clusterIndex.GetClusterId(), clusterIndex.GetIndex()));
+   if (itr == index.begin())
+      return RPage();
+   --itr;
+   if (!fEntries.at(itr->second).fPage.Contains(clusterIndex))
+      return RPage();
+   return Acquire(itr->second);
 }
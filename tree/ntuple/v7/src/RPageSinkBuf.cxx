@@ -0,0 +1,95 @@
+/// \file RPageSinkBuf.cxx
+/// \ingroup NTuple ROOT7
+/// \author The ROOT Team
+/// \date 2026-10-16
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RPageSinkBuf.hxx>
+#include <ROOT/RColumn.hxx>
+#include <ROOT/RColumnElement.hxx>
+#include <ROOT/RPageAllocator.hxx>
+
+#include <TError.h>
+
+#include <cstring>
+
+ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::string_view ntupleName,
+                                                       const RNTupleWriteOptions &options)
+   : RPageSink(ntupleName, options)
+   , fMetrics("RPageSinkBuf")
+{
+}
+
+ROOT::Experimental::Detail::RPageSinkBuf::~RPageSinkBuf()
+{
+   for (const auto &bufferedPage : fBufferedPages)
+      RPageAllocatorHeap::DeletePage(bufferedPage.fPage);
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::DoCreate(const RNTupleModel & /* model */)
+{
+}
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::DoCommitPage(ColumnHandle_t columnHandle, const RPage &page)
+{
+   RBufferedPage bufferedPage;
+   bufferedPage.fColumnHandle = columnHandle;
+   bufferedPage.fPage = RPageAllocatorHeap::NewPage(columnHandle.fId, page.GetElementSize(), page.GetNElements());
+   memcpy(bufferedPage.fPage.TryGrow(page.GetNElements()), page.GetBuffer(), page.GetSize());
+   fBufferedPages.emplace_back(bufferedPage);
+   // The locator is meaningless; the actual locator is issued by the target sink
+   return RClusterDescriptor::RLocator();
+}
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::DoCommitSealedPage(DescriptorId_t /* columnId */,
+                                                             const RSealedPage & /* sealedPage */)
+{
+   // Fill contexts only commit unsealed pages, which are sealed by the target sink
+   R__ASSERT(false);
+   return RClusterDescriptor::RLocator();
+}
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::DoCommitCluster(ROOT::Experimental::NTupleSize_t /* nEntries */)
+{
+   return RClusterDescriptor::RLocator();
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::DoCommitDataset()
+{
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::CommitBufferedPages(RPageSink &target)
+{
+   for (const auto &bufferedPage : fBufferedPages)
+      target.CommitPage(bufferedPage.fColumnHandle, bufferedPage.fPage);
+   // Release the buffers only once all pages made it to the target; on I/O errors, the destructor cleans up
+   for (const auto &bufferedPage : fBufferedPages)
+      RPageAllocatorHeap::DeletePage(bufferedPage.fPage);
+   fBufferedPages.clear();
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSinkBuf::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
+{
+   if (nElements == 0)
+      nElements = kDefaultElementsPerPage;
+   auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   return RPageAllocatorHeap::NewPage(columnHandle.fId, elementSize, nElements);
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::ReleasePage(RPage &page)
+{
+   RPageAllocatorHeap::DeletePage(page);
+}
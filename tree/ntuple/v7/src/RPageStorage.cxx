@@ -74,6 +74,7 @@ ROOT::Experimental::Detail::RPageSource::AddColumn(DescriptorId_t fieldId, const
    R__ASSERT(fieldId != kInvalidDescriptorId);
    auto columnId = fDescriptor.FindColumnId(fieldId, column.GetIndex());
    R__ASSERT(columnId != kInvalidDescriptorId);
+   fActiveColumns.emplace(columnId);
    return ColumnHandle_t(columnId, &column);
 }
 
@@ -172,6 +173,18 @@ void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHand
 }
 
 
+void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage)
+{
+   auto locator = DoCommitSealedPage(columnId, sealedPage);
+
+   fOpenColumnRanges[columnId].fNElements += sealedPage.fNElements;
+   RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+   pageInfo.fNElements = sealedPage.fNElements;
+   pageInfo.fLocator = locator;
+   fOpenPageRanges[columnId].fPageInfos.emplace_back(pageInfo);
+}
+
+
 void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NTupleSize_t nEntries)
 {
    auto locator = DoCommitCluster(nEntries);
@@ -14,21 +14,32 @@
  *************************************************************************/
 
 #include <ROOT/RPageStorageRaw.hxx>
+#include <ROOT/RClusterPool.hxx>
 #include <ROOT/RColumn.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RLogger.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RPage.hxx>
 #include <ROOT/RPageAllocator.hxx>
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RRawFile.hxx>
+#include <ROOT/TTaskGroup.hxx>
 
 #include <Compression.h>
+#include <RConfigure.h>
 #include <RZip.h>
 #include <TError.h>
 
+#ifdef R__USE_IMT
+#include <TROOT.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
+#include <vector>
 
 ROOT::Experimental::Detail::RPageSinkRaw::RPageSinkRaw(std::string_view ntupleName, std::string_view path,
    const RNTupleWriteOptions &options)
@@ -41,6 +52,13 @@ ROOT::Experimental::Detail::RPageSinkRaw::RPageSinkRaw(std::string_view ntupleNa
       "Do not store real data with this version of RNTuple!";
    fFile = fopen(std::string(path).c_str(), "wb");
    R__ASSERT(fFile);
+#ifdef R__USE_IMT
+   if ((options.GetUseImplicitMT() == RNTupleWriteOptions::kDefault) && ROOT::IsImplicitMTEnabled() &&
+       (options.GetCompression() % 100 != 0))
+   {
+      fTaskGroup = std::make_unique<TTaskGroup>();
+   }
+#endif
 }
 
 ROOT::Experimental::Detail::RPageSinkRaw::~RPageSinkRaw()
@@ -57,6 +75,14 @@ void ROOT::Experimental::Detail::RPageSinkRaw::Write(const void *buffer, std::si
    fFilePos += written;
 }
 
+void ROOT::Experimental::Detail::RPageSinkRaw::WritePadding()
+{
+   static const unsigned char zeros[kUncompressedPageAlignment] = {0};
+   auto nbytes = (kUncompressedPageAlignment - fFilePos % kUncompressedPageAlignment) % kUncompressedPageAlignment;
+   if (nbytes > 0)
+      Write(zeros, nbytes);
+}
+
 void ROOT::Experimental::Detail::RPageSinkRaw::DoCreate(const RNTupleModel & /* model */)
 {
    const auto &descriptor = fDescriptorBuilder.GetDescriptor();
@@ -84,6 +110,29 @@ ROOT::Experimental::Detail::RPageSinkRaw::DoCommitPage(ColumnHandle_t columnHand
       isAdoptedBuffer = false;
    }
 
+   if (fTaskGroup) {
+      R__ASSERT(packedBytes <= kMaxPageSize);
+      RPendingPage pendingPage;
+      pendingPage.fColumnId = columnHandle.fId;
+      pendingPage.fPageIndex = fOpenPageRanges[columnHandle.fId].fPageInfos.size();
+      pendingPage.fPackedSize = packedBytes;
+      if (isAdoptedBuffer) {
+         // The page buffer is reused by the column after the commit
+         pendingPage.fPackedBuffer = std::unique_ptr<unsigned char []>(new unsigned char[packedBytes]);
+         memcpy(pendingPage.fPackedBuffer.get(), buffer, packedBytes);
+      } else {
+         pendingPage.fPackedBuffer = std::unique_ptr<unsigned char []>(buffer);
+      }
+      fPendingPages.emplace_back(std::move(pendingPage));
+
+      auto &page = fPendingPages.back();
+      auto compression = fOptions.GetCompression();
+      fTaskGroup->Run([&page, compression]() { CompressPage(page, compression); });
+      // The locator is set by DoCommitCluster() when the compressed page is written
+      return RClusterDescriptor::RLocator();
+   }
+
+   bool isCompressed = false;
    if (fOptions.GetCompression() % 100 != 0) {
       R__ASSERT(packedBytes <= kMaxPageSize);
       auto level = fOptions.GetCompression() % 100;
@@ -99,9 +148,12 @@ ROOT::Experimental::Detail::RPageSinkRaw::DoCommitPage(ColumnHandle_t columnHand
          buffer = reinterpret_cast<unsigned char *>(fZipBuffer->data());
          packedBytes = zipBytes;
          isAdoptedBuffer = true;
+         isCompressed = true;
       }
    }
 
+   if (!isCompressed)
+      WritePadding();
    RClusterDescriptor::RLocator result;
    result.fPosition = fFilePos;
    result.fBytesOnStorage = packedBytes;
@@ -113,9 +165,65 @@ ROOT::Experimental::Detail::RPageSinkRaw::DoCommitPage(ColumnHandle_t columnHand
    return result;
 }
 
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkRaw::DoCommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage)
+{
+   // Uncompressed pages keep their alignment in the new file
+   const auto &columnDesc = fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(columnId);
+   auto element = RColumnElementBase::Generate(columnDesc.GetModel());
+   auto packedBytes = (sealedPage.fNElements * element->GetBitsOnStorage() + 7) / 8;
+   if (sealedPage.fSize == packedBytes)
+      WritePadding();
+
+   RClusterDescriptor::RLocator result;
+   result.fPosition = fFilePos;
+   result.fBytesOnStorage = sealedPage.fSize;
+   Write(sealedPage.fBuffer, sealedPage.fSize);
+   return result;
+}
+
+void ROOT::Experimental::Detail::RPageSinkRaw::CompressPage(RPendingPage &page, int compression)
+{
+   auto level = compression % 100;
+   auto algorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(compression / 100);
+   page.fZipBuffer = std::unique_ptr<unsigned char []>(new unsigned char[page.fPackedSize]);
+   int szZipBuffer = page.fPackedSize;
+   int szSource = page.fPackedSize;
+   char *source = reinterpret_cast<char *>(page.fPackedBuffer.get());
+   char *target = reinterpret_cast<char *>(page.fZipBuffer.get());
+   int zipBytes = 0;
+   R__zipMultipleAlgorithm(level, &szSource, source, &szZipBuffer, target, &zipBytes, algorithm);
+   if ((zipBytes > 0) && (zipBytes < szSource)) {
+      page.fZipSize = zipBytes;
+      page.fPackedBuffer.reset();
+   } else {
+      page.fZipBuffer.reset();
+   }
+}
+
 ROOT::Experimental::RClusterDescriptor::RLocator
 ROOT::Experimental::Detail::RPageSinkRaw::DoCommitCluster(ROOT::Experimental::NTupleSize_t /* nEntries */)
 {
+   if (fTaskGroup) {
+      // Write the pages in the order in which they have been committed
+      fTaskGroup->Wait();
+      for (auto &page : fPendingPages) {
+         RClusterDescriptor::RLocator locator;
+         if (page.fZipBuffer) {
+            locator.fPosition = fFilePos;
+            locator.fBytesOnStorage = page.fZipSize;
+            Write(page.fZipBuffer.get(), page.fZipSize);
+         } else {
+            WritePadding();
+            locator.fPosition = fFilePos;
+            locator.fBytesOnStorage = page.fPackedSize;
+            Write(page.fPackedBuffer.get(), page.fPackedSize);
+         }
+         fOpenPageRanges[page.fColumnId].fPageInfos[page.fPageIndex].fLocator = locator;
+      }
+      fPendingPages.clear();
+   }
+
    RClusterDescriptor::RLocator result;
    result.fPosition = fClusterStart;
    result.fBytesOnStorage = fFilePos - fClusterStart;
@@ -125,6 +233,7 @@ ROOT::Experimental::Detail::RPageSinkRaw::DoCommitCluster(ROOT::Experimental::NT
 
 void ROOT::Experimental::Detail::RPageSinkRaw::DoCommitDataset()
 {
+   R__ASSERT(fPendingPages.empty());
    const auto &descriptor = fDescriptorBuilder.GetDescriptor();
    auto szFooter = descriptor.SerializeFooter(nullptr);
    auto buffer = new unsigned char[szFooter];
@@ -169,11 +278,49 @@ void ROOT::Experimental::Detail::RPageAllocatorFile::DeletePage(const RPage& pag
 ////////////////////////////////////////////////////////////////////////////////
 
 
+struct ROOT::Experimental::Detail::RPageSourceRaw::RMappedFile {
+   /// The mapping needs its own file handle because it can outlive the page source
+   std::unique_ptr<ROOT::Internal::RRawFile> fFile;
+   unsigned char *fAddress = nullptr;
+   std::uint64_t fSize = 0;
+
+   RMappedFile(std::unique_ptr<ROOT::Internal::RRawFile> file, std::uint64_t size)
+      : fFile(std::move(file)), fSize(size)
+   {
+      std::uint64_t mapdOffset;
+      fAddress = reinterpret_cast<unsigned char *>(fFile->Map(fSize, 0, mapdOffset));
+      R__ASSERT(mapdOffset == 0);
+   }
+   RMappedFile(const RMappedFile &other) = delete;
+   RMappedFile &operator =(const RMappedFile &other) = delete;
+   ~RMappedFile() { fFile->Unmap(fAddress, fSize); }
+};
+
+
+ROOT::Experimental::Detail::RPageSourceRaw::RColumnCounters::RColumnCounters(const std::string &name)
+   : fMetrics(name)
+{
+   fNPages = fMetrics.MakeCounter<decltype(fNPages)>("nPages", "", "number of populated pages");
+   fSzRead = fMetrics.MakeCounter<decltype(fSzRead)>("szRead", "B", "volume read from file");
+   fSzUnzip = fMetrics.MakeCounter<decltype(fSzUnzip)>("szUnzip", "B", "volume after unzipping");
+   fTimeWallRead = fMetrics.MakeCounter<decltype(fTimeWallRead)>(
+      "timeWallRead", "ns", "wall clock time spent reading individual pages");
+   fTimeCpuRead = fMetrics.MakeCounter<decltype(fTimeCpuRead)>(
+      "timeCpuRead", "ns", "CPU time spent reading individual pages");
+   fTimeWallUnzip = fMetrics.MakeCounter<decltype(fTimeWallUnzip)>(
+      "timeWallUnzip", "ns", "wall clock time spent decompressing");
+   fTimeCpuUnzip = fMetrics.MakeCounter<decltype(fTimeCpuUnzip)>("timeCpuUnzip", "ns", "CPU time spent decompressing");
+   fTimeWallUnpack = fMetrics.MakeCounter<decltype(fTimeWallUnpack)>(
+      "timeWallUnpack", "ns", "wall clock time spent unpacking");
+   fTimeCpuUnpack = fMetrics.MakeCounter<decltype(fTimeCpuUnpack)>("timeCpuUnpack", "ns", "CPU time spent unpacking");
+}
+
+
 ROOT::Experimental::Detail::RPageSourceRaw::RPageSourceRaw(std::string_view ntupleName,
    const RNTupleReadOptions &options)
    : RPageSource(ntupleName, options)
    , fPageAllocator(std::make_unique<RPageAllocatorFile>())
-   , fPagePool(std::make_shared<RPagePool>())
+   , fPagePool(std::make_shared<RPagePool>(options.GetPagePoolBudget()))
    , fUnzipBuffer(std::make_unique<std::array<unsigned char, kMaxPageSize>>())
    , fMetrics("RPageSourceRaw")
 {
@@ -188,6 +335,14 @@ ROOT::Experimental::Detail::RPageSourceRaw::RPageSourceRaw(std::string_view ntup
       "timeWallUnzip", "ns", "wall clock time spent decompressing");
    fCtrTimeCpuUnzip = fMetrics.MakeCounter<decltype(fCtrTimeCpuUnzip)>(
       "timeCpuUnzip", "ns", "CPU time spent decompressing");
+   fCtrNClusterLoaded = fMetrics.MakeCounter<decltype(fCtrNClusterLoaded)>(
+      "nClusterLoaded", "", "number of partial clusters preloaded from storage");
+   fCtrSzReadAhead = fMetrics.MakeCounter<decltype(fCtrSzReadAhead)>(
+      "szReadAhead", "B", "volume read from file by the cluster pool");
+   fCtrNPageUnzipAhead = fMetrics.MakeCounter<decltype(fCtrNPageUnzipAhead)>(
+      "nPageUnzipAhead", "", "number of pages decompressed by the cluster pool");
+   fCtrNPageMapped = fMetrics.MakeCounter<decltype(fCtrNPageMapped)>(
+      "nPageMapped", "", "number of pages used in place from the file mapping");
 }
 
 ROOT::Experimental::Detail::RPageSourceRaw::RPageSourceRaw(std::string_view ntupleName, std::string_view path,
@@ -205,6 +360,26 @@ ROOT::Experimental::Detail::RPageSourceRaw::~RPageSourceRaw()
 }
 
 
+void ROOT::Experimental::Detail::RPageSourceRaw::CreateColumnCounters(const RNTupleDescriptor &descriptor)
+{
+   // Column ids are issued sequentially by the page sink
+   for (DescriptorId_t columnId = 0; columnId < descriptor.GetNColumns(); ++columnId) {
+      const auto &columnDesc = descriptor.GetColumnDescriptor(columnId);
+      std::string fieldName;
+      for (auto fieldId = columnDesc.GetFieldId(); fieldId != kInvalidDescriptorId; ) {
+         const auto &fieldDesc = descriptor.GetFieldDescriptor(fieldId);
+         if (fieldDesc.GetParentId() == kInvalidDescriptorId)
+            break;
+         fieldName = fieldName.empty() ? fieldDesc.GetFieldName() : (fieldDesc.GetFieldName() + "." + fieldName);
+         fieldId = fieldDesc.GetParentId();
+      }
+      auto counters = std::make_unique<RColumnCounters>(fieldName + "#" + std::to_string(columnDesc.GetIndex()));
+      fMetrics.ObserveMetrics(counters->fMetrics);
+      fColumnCounters.emplace_back(std::move(counters));
+   }
+}
+
+
 void ROOT::Experimental::Detail::RPageSourceRaw::Read(void *buffer, std::size_t nbytes, std::uint64_t offset)
 {
    RNTuplePlainTimer timer(*fCtrTimeWallRead, *fCtrTimeCpuRead);
@@ -240,42 +415,242 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceRaw
    delete[] header;
    delete[] footer;
 
+   CreateColumnCounters(descBuilder.GetDescriptor());
+
+   if (fOptions.GetUseMemoryMap() && (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap))
+      fMappedFile = std::make_shared<RMappedFile>(fFile->Clone(), fileSize);
+
+   if (fOptions.GetClusterCache() != RNTupleReadOptions::kOff) {
+      fClusterFile = fFile->Clone();
+      fClusterPool = std::make_unique<RClusterPool>(*this, fOptions.GetClusterLookahead());
+   }
+
    return descBuilder.MoveDescriptor();
 }
 
 
+void *ROOT::Experimental::Detail::RPageSourceRaw::UnsealPage(const RColumnElementBase &element,
+   const ROnDiskPage &onDiskPage, ClusterSize_t::ValueType nElements, unsigned char *unzipBuffer,
+   RColumnCounters &counters)
+{
+   auto bytesOnStorage = (element.GetBitsOnStorage() * nElements + 7) / 8;
+   auto bytesInMemory = element.GetSize() * nElements;
+   const void *packedBuffer = onDiskPage.GetAddress();
+
+   if (onDiskPage.GetSize() != bytesOnStorage) {
+      RNTupleAtomicTimer timer(*counters.fTimeWallUnzip, *counters.fTimeCpuUnzip);
+      R__ASSERT(bytesOnStorage <= kMaxPageSize);
+      int szUnzipBuffer = kMaxPageSize;
+      int szSource = onDiskPage.GetSize();
+      auto source = const_cast<unsigned char *>(reinterpret_cast<const unsigned char *>(onDiskPage.GetAddress()));
+      int unzipBytes = 0;
+      R__unzip(&szSource, source, &szUnzipBuffer, unzipBuffer, &unzipBytes);
+      R__ASSERT(unzipBytes == static_cast<int>(bytesOnStorage));
+      packedBuffer = unzipBuffer;
+      counters.fSzUnzip->Add(unzipBytes);
+      fCtrSzUnzip->Add(unzipBytes);
+   }
+
+   void *pageBuffer = malloc(std::max(bytesInMemory, static_cast<decltype(bytesInMemory)>(1)));
+   R__ASSERT(pageBuffer);
+   if (element.IsMappable()) {
+      memcpy(pageBuffer, packedBuffer, bytesInMemory);
+   } else {
+      RNTupleAtomicTimer timer(*counters.fTimeWallUnpack, *counters.fTimeCpuUnpack);
+      element.Unpack(pageBuffer, const_cast<void *>(packedBuffer), nElements);
+   }
+   return pageBuffer;
+}
+
+
+void *ROOT::Experimental::Detail::RPageSourceRaw::GetMappedAddress(const RColumnElementBase &element,
+   const RClusterDescriptor::RPageRange::RPageInfo &pageInfo) const
+{
+   if (!fMappedFile || !element.IsMappable())
+      return nullptr;
+   if (pageInfo.fLocator.fBytesOnStorage != element.GetSize() * pageInfo.fNElements)
+      return nullptr;
+   R__ASSERT(pageInfo.fLocator.fPosition + pageInfo.fLocator.fBytesOnStorage <= fMappedFile->fSize);
+   auto address = fMappedFile->fAddress + pageInfo.fLocator.fPosition;
+   if (reinterpret_cast<std::uintptr_t>(address) % element.GetSize() != 0)
+      return nullptr;
+   return address;
+}
+
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster> ROOT::Experimental::Detail::RPageSourceRaw::LoadCluster(
+   DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns)
+{
+   const auto &clusterDesc = fDescriptor.GetClusterDescriptor(clusterId);
+
+   // Collect the on-disk pages of all requested columns and read them in a single vectored read
+   std::vector<ROnDiskPage::Key> onDiskKeys;
+   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   std::size_t szPayload = 0;
+   for (auto columnId : columns) {
+      auto element = RColumnElementBase::Generate(fDescriptor.GetColumnDescriptor(columnId).GetModel());
+      const auto &pageRange = clusterDesc.GetPageRange(columnId);
+      NTupleSize_t pageNo = 0;
+      for (const auto &pageInfo : pageRange.fPageInfos) {
+         // Pages that can be used in place from the file mapping do not need to be loaded
+         if (GetMappedAddress(*element, pageInfo) != nullptr) {
+            ++pageNo;
+            continue;
+         }
+         ROOT::Internal::RRawFile::RIOVec req;
+         req.fOffset = pageInfo.fLocator.fPosition;
+         req.fSize = pageInfo.fLocator.fBytesOnStorage;
+         readRequests.emplace_back(req);
+         onDiskKeys.emplace_back(ROnDiskPage::Key(columnId, pageNo));
+         szPayload += req.fSize;
+         fColumnCounters[columnId]->fSzRead->Add(req.fSize);
+         ++pageNo;
+      }
+   }
+
+   auto buffer = std::unique_ptr<unsigned char []>(new unsigned char[szPayload]);
+   std::size_t bufPos = 0;
+   for (auto &req : readRequests) {
+      req.fBuffer = buffer.get() + bufPos;
+      bufPos += req.fSize;
+   }
+   if (!readRequests.empty()) {
+      fClusterFile->ReadV(readRequests.data(), readRequests.size());
+      fCtrSzRead->Add(szPayload);
+      fCtrNRead->Inc();
+   }
+   fCtrSzReadAhead->Add(szPayload);
+
+   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::move(buffer));
+   for (std::size_t i = 0; i < readRequests.size(); ++i) {
+      R__ASSERT(readRequests[i].fOutBytes == readRequests[i].fSize);
+      pageMap->Register(onDiskKeys[i], ROnDiskPage(readRequests[i].fBuffer, readRequests[i].fSize));
+   }
+
+   auto cluster = std::make_unique<RCluster>(clusterId);
+   cluster->Adopt(std::move(pageMap));
+   for (auto columnId : columns)
+      cluster->SetColumnAvailable(columnId);
+   fCtrNClusterLoaded->Inc();
+   return cluster;
+}
+
+
+void ROOT::Experimental::Detail::RPageSourceRaw::UnzipCluster(RCluster *cluster)
+{
+   const auto clusterId = cluster->GetId();
+   const auto &clusterDesc = fDescriptor.GetClusterDescriptor(clusterId);
+   // The unzip thread must not share the unzip buffer with the thread owning the page source
+   auto unzipBuffer = std::make_unique<std::array<unsigned char, kMaxPageSize>>();
+
+   for (auto columnId : cluster->GetAvailColumns()) {
+      auto element = RColumnElementBase::Generate(fDescriptor.GetColumnDescriptor(columnId).GetModel());
+      auto indexOffset = clusterDesc.GetColumnRange(columnId).fFirstElementIndex;
+      const auto &pageRange = clusterDesc.GetPageRange(columnId);
+
+      NTupleSize_t pageNo = 0;
+      NTupleSize_t firstInPage = 0;
+      for (const auto &pageInfo : pageRange.fPageInfos) {
+         ROnDiskPage::Key key(columnId, pageNo);
+         auto onDiskPage = cluster->GetOnDiskPage(key);
+         if (onDiskPage != nullptr) {
+            auto pageBuffer = UnsealPage(*element, *onDiskPage, pageInfo.fNElements, unzipBuffer->data(),
+                                         *fColumnCounters[columnId]);
+            auto newPage = RPageAllocatorFile::NewPage(columnId, pageBuffer, element->GetSize(), pageInfo.fNElements);
+            newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+            cluster->AddUnzippedPage(key, newPage,
+               RPageDeleter([](const RPage &page, void * /*userData*/)
+               {
+                  RPageAllocatorFile::DeletePage(page);
+               }, nullptr));
+            fCtrNPageUnzipAhead->Inc();
+         }
+         firstInPage += pageInfo.fNElements;
+         ++pageNo;
+      }
+   }
+}
+
+
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceRaw::PopulatePageFromCluster(
    ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor, ClusterSize_t::ValueType clusterIndex)
 {
    fCtrNPages->Inc();
    auto columnId = columnHandle.fId;
    auto clusterId = clusterDescriptor.GetId();
+   auto &columnCounters = *fColumnCounters[columnId];
+   columnCounters.fNPages->Inc();
    const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
 
    // TODO(jblomer): binary search
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    decltype(clusterIndex) firstInPage = 0;
+   NTupleSize_t pageNo = 0;
    for (const auto &pi : pageRange.fPageInfos) {
       if (firstInPage + pi.fNElements > clusterIndex) {
          pageInfo = pi;
          break;
       }
       firstInPage += pi.fNElements;
+      ++pageNo;
    }
    R__ASSERT(firstInPage <= clusterIndex);
    R__ASSERT((firstInPage + pageInfo.fNElements) > clusterIndex);
 
    auto element = columnHandle.fColumn->GetElement();
    auto elementSize = element->GetSize();
+   auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
+
+   auto mappedAddress = GetMappedAddress(*element, pageInfo);
+   if (mappedAddress != nullptr) {
+      auto newPage = fPageAllocator->NewPage(columnId, mappedAddress, elementSize, pageInfo.fNElements);
+      newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+      // The page memory belongs to the mapping, which is released when the last mapped page is gone
+      auto mappedFile = fMappedFile;
+      fPagePool->RegisterPage(newPage,
+         RPageDeleter([mappedFile](const RPage & /*page*/, void * /*userData*/) {}, nullptr));
+      fCtrNPageMapped->Inc();
+      return newPage;
+   }
+
+   if (fClusterPool) {
+      auto cluster = fClusterPool->GetCluster(clusterId, fActiveColumns);
+      ROnDiskPage::Key key(columnId, pageNo);
+      RPageDeleter deleter([](const RPage &page, void * /*userData*/)
+      {
+         RPageAllocatorFile::DeletePage(page);
+      }, nullptr);
+      auto newPage = cluster->TakeUnzippedPage(key, deleter);
+      if (newPage.IsNull()) {
+         auto onDiskPage = cluster->GetOnDiskPage(key);
+         if (onDiskPage != nullptr) {
+            RNTuplePlainTimer timer(*fCtrTimeWallUnzip, *fCtrTimeCpuUnzip);
+            auto pageBuffer = UnsealPage(*element, *onDiskPage, pageInfo.fNElements, fUnzipBuffer->data(),
+                                         columnCounters);
+            newPage = fPageAllocator->NewPage(columnId, pageBuffer, elementSize, pageInfo.fNElements);
+            newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+         }
+      }
+      if (!newPage.IsNull()) {
+         fPagePool->RegisterPage(newPage, deleter);
+         return newPage;
+      }
+      // Otherwise the column was added after the cluster has been scheduled; fall back to a synchronous read
+   }
 
    auto pageSize = pageInfo.fLocator.fBytesOnStorage;
    void *pageBuffer = malloc(std::max(pageSize, static_cast<std::uint32_t>(elementSize * pageInfo.fNElements)));
    R__ASSERT(pageBuffer);
-   Read(pageBuffer, pageSize, pageInfo.fLocator.fPosition);
+   {
+      RNTupleAtomicTimer timer(*columnCounters.fTimeWallRead, *columnCounters.fTimeCpuRead);
+      Read(pageBuffer, pageSize, pageInfo.fLocator.fPosition);
+   }
+   columnCounters.fSzRead->Add(pageSize);
 
    auto bytesOnStorage = (element->GetBitsOnStorage() * pageInfo.fNElements + 7) / 8;
    if (pageSize != bytesOnStorage) {
       RNTuplePlainTimer timer(*fCtrTimeWallUnzip, *fCtrTimeCpuUnzip);
+      RNTupleAtomicTimer columnTimer(*columnCounters.fTimeWallUnzip, *columnCounters.fTimeCpuUnzip);
 
       R__ASSERT(bytesOnStorage <= kMaxPageSize);
       // We do have the unzip information in the column range, but here we simply use the value from
@@ -289,9 +664,11 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceRaw::Po
       memcpy(pageBuffer, fUnzipBuffer->data(), unzipBytes);
       pageSize = unzipBytes;
       fCtrSzUnzip->Add(unzipBytes);
+      columnCounters.fSzUnzip->Add(unzipBytes);
    }
 
    if (!element->IsMappable()) {
+      RNTupleAtomicTimer timer(*columnCounters.fTimeWallUnpack, *columnCounters.fTimeCpuUnpack);
       pageSize = elementSize * pageInfo.fNElements;
       auto unpackedBuffer = reinterpret_cast<unsigned char *>(malloc(pageSize));
       R__ASSERT(unpackedBuffer != nullptr);
@@ -300,7 +677,6 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceRaw::Po
       pageBuffer = unpackedBuffer;
    }
 
-   auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
    auto newPage = fPageAllocator->NewPage(columnId, pageBuffer, elementSize, pageInfo.fNElements);
    newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
    fPagePool->RegisterPage(newPage,
@@ -312,6 +688,21 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceRaw::Po
 }
 
 
+ROOT::Experimental::Detail::RPageStorage::RSealedPage
+ROOT::Experimental::Detail::RPageSourceRaw::LoadSealedPage(DescriptorId_t columnId, DescriptorId_t clusterId,
+                                                           NTupleSize_t pageNo, void *buffer)
+{
+   const auto &pageInfo = fDescriptor.GetClusterDescriptor(clusterId).GetPageRange(columnId).fPageInfos.at(pageNo);
+   Read(buffer, pageInfo.fLocator.fBytesOnStorage, pageInfo.fLocator.fPosition);
+
+   RSealedPage sealedPage;
+   sealedPage.fBuffer = buffer;
+   sealedPage.fSize = pageInfo.fLocator.fBytesOnStorage;
+   sealedPage.fNElements = pageInfo.fNElements;
+   return sealedPage;
+}
+
+
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceRaw::PopulatePage(
    ColumnHandle_t columnHandle, NTupleSize_t globalIndex)
 {
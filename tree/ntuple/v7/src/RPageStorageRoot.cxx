@@ -25,6 +25,7 @@
 #include <TKey.h>
 
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <utility>
 
@@ -98,6 +99,24 @@ ROOT::Experimental::Detail::RPageSinkRoot::DoCommitPage(ColumnHandle_t columnHan
    return result;
 }
 
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkRoot::DoCommitSealedPage(DescriptorId_t /* columnId */,
+                                                              const RSealedPage &sealedPage)
+{
+   // Pages are stored packed but uncompressed in the blobs; compression is left to the TFile
+   ROOT::Experimental::Internal::RNTupleBlob pagePayload(
+      sealedPage.fSize, static_cast<unsigned char *>(const_cast<void *>(sealedPage.fBuffer)));
+   std::string keyName = std::string(kKeyPagePayload) +
+      std::to_string(fLastClusterId) + kKeySeparator +
+      std::to_string(fLastPageIdx);
+   fDirectory->WriteObject(&pagePayload, keyName.c_str());
+
+   RClusterDescriptor::RLocator result;
+   result.fPosition = fLastPageIdx++;
+   result.fBytesOnStorage = sealedPage.fSize;
+   return result;
+}
+
 ROOT::Experimental::RClusterDescriptor::RLocator
 ROOT::Experimental::Detail::RPageSinkRoot::DoCommitCluster(ROOT::Experimental::NTupleSize_t /* nEntries */)
 {
@@ -164,7 +183,7 @@ ROOT::Experimental::Detail::RPageSourceRoot::RPageSourceRoot(std::string_view nt
    : RPageSource(ntupleName, options)
    , fMetrics("RPageSourceRoot")
    , fPageAllocator(std::make_unique<RPageAllocatorKey>())
-   , fPagePool(std::make_shared<RPagePool>())
+   , fPagePool(std::make_shared<RPagePool>(options.GetPagePoolBudget()))
 {
    fFile = std::unique_ptr<TFile>(TFile::Open(std::string(path).c_str(), "READ"));
 }
@@ -292,3 +311,32 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
 {
    return std::make_unique<RPageSourceRoot>(fNTupleName, fFile->GetName(), fOptions);
 }
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster> ROOT::Experimental::Detail::RPageSourceRoot::LoadCluster(
+   DescriptorId_t clusterId, const RCluster::ColumnSet_t & /* columns */)
+{
+   // TFile is not thread-safe, so there is no cluster pool for the ROOT page source and no background loading
+   return std::make_unique<RCluster>(clusterId);
+}
+
+ROOT::Experimental::Detail::RPageStorage::RSealedPage
+ROOT::Experimental::Detail::RPageSourceRoot::LoadSealedPage(DescriptorId_t columnId, DescriptorId_t clusterId,
+                                                            NTupleSize_t pageNo, void *buffer)
+{
+   const auto &pageInfo = fDescriptor.GetClusterDescriptor(clusterId).GetPageRange(columnId).fPageInfos.at(pageNo);
+   std::string keyName = std::string(kKeyPagePayload) +
+      std::to_string(clusterId) + kKeySeparator +
+      std::to_string(pageInfo.fLocator.fPosition);
+   auto pageKey = fDirectory->GetKey(keyName.c_str());
+   auto pagePayload = pageKey->ReadObject<ROOT::Experimental::Internal::RNTupleBlob>();
+   R__ASSERT(static_cast<std::uint32_t>(pagePayload->fSize) == pageInfo.fLocator.fBytesOnStorage);
+   memcpy(buffer, pagePayload->fContent, pagePayload->fSize);
+   free(pagePayload->fContent);
+   delete pagePayload;
+
+   RSealedPage sealedPage;
+   sealedPage.fBuffer = buffer;
+   sealedPage.fSize = pageInfo.fLocator.fBytesOnStorage;
+   sealedPage.fNElements = pageInfo.fNElements;
+   return sealedPage;
+}
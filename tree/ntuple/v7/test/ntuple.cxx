@@ -16,6 +16,7 @@
 
 #include "CustomStruct.hxx"
 
+#include <algorithm>
 #include <array>
 #include <exception>
 #include <memory>
@@ -663,6 +664,64 @@ TEST(RNTuple, RDF)
    EXPECT_EQ(42.0, *rdf.Min("pt"));
 }
 
+TEST(RNTuple, RDFSnapshot)
+{
+   FileRaii fileGuard("test_ntuple_rdf_snapshot.root");
+
+   ROOT::RDataFrame df(1000);
+   auto defines = df.Define("x", [](ULong64_t e) { return float(e); }, {"rdfentry_"})
+                     .Define("v", [](ULong64_t e) { return std::vector<float>(e % 3, 1.0); }, {"rdfentry_"})
+                     .Define("tag", []() { return std::string("xyz"); });
+   auto snapshot = ROOT::Experimental::SnapshotNTuple<float, std::vector<float>, std::string>(
+      defines.Filter([](float x) { return x >= 100; }, {"x"}), "f", fileGuard.GetPath(), {"x", "v", "tag"});
+
+   EXPECT_EQ(900u, *snapshot.Count());
+   EXPECT_FLOAT_EQ(100., *snapshot.Min<float>("x"));
+   EXPECT_FLOAT_EQ(999., *snapshot.Max<float>("x"));
+   EXPECT_EQ(900u, *snapshot.Filter([](const std::string &tag) { return tag == "xyz"; }, {"tag"}).Count());
+   EXPECT_DOUBLE_EQ(900., *snapshot.Define("n", [](const std::vector<float> &v) { return double(v.size()); },
+                                           {"v"}).Sum<double>("n"));
+}
+
+TEST(RNTuple, RDFSnapshotMT)
+{
+   FileRaii fileGuard("test_ntuple_rdf_snapshot_mt.root");
+
+   // more entries than fit in a cluster, spread over several slots that fill their own clusters
+   const ULong64_t nEntries = 200000;
+   ROOT::EnableImplicitMT(4);
+   ROOT::RDataFrame df(nEntries);
+   EXPECT_EQ(4u, df.GetNSlots());
+   auto defines = df.Define("x", [](ULong64_t e) { return float(e); }, {"rdfentry_"})
+                     .Define("v", [](ULong64_t e) { return std::vector<float>(e % 3, float(e)); }, {"rdfentry_"})
+                     .Define("tag", [](ULong64_t e) { return std::to_string(e); }, {"rdfentry_"});
+   auto snapshot = ROOT::Experimental::SnapshotNTuple<float, std::vector<float>, std::string>(
+      defines, "f", fileGuard.GetPath(), {"x", "v", "tag"});
+   EXPECT_EQ(nEntries, *snapshot.Count());
+   ROOT::DisableImplicitMT();
+
+   // the order of the entries is only kept within clusters: every entry must be there once, with its own values
+   auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath());
+   EXPECT_EQ(nEntries, ntuple->GetNEntries());
+   EXPECT_LT(1u, ntuple->GetDescriptor().GetNClusters());
+   auto viewX = ntuple->GetView<float>("x");
+   auto viewV = ntuple->GetView<std::vector<float>>("v");
+   auto viewTag = ntuple->GetView<std::string>("tag");
+   std::vector<bool> seen(nEntries, false);
+   for (auto i : ntuple->GetViewRange()) {
+      const auto e = static_cast<ULong64_t>(viewX(i));
+      ASSERT_LT(e, nEntries);
+      EXPECT_FALSE(seen[e]) << "entry " << e << " written twice";
+      seen[e] = true;
+      const auto &v = viewV(i);
+      EXPECT_EQ(e % 3, v.size());
+      for (auto val : v)
+         EXPECT_EQ(float(e), val);
+      EXPECT_EQ(std::to_string(e), viewTag(i));
+   }
+   EXPECT_EQ(nEntries, static_cast<ULong64_t>(std::count(seen.begin(), seen.end(), true)));
+}
+
 
 TEST(RNTuple, Descriptor)
 {
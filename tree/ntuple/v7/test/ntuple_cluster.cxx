@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RPage.hxx>
+#include <ROOT/RPageAllocator.hxx>
+
+#include <cstring>
+#include <memory>
+#include <utility>
+
+using RCluster = ROOT::Experimental::Detail::RCluster;
+using ROnDiskPage = ROOT::Experimental::Detail::ROnDiskPage;
+using ROnDiskPageMapHeap = ROOT::Experimental::Detail::ROnDiskPageMapHeap;
+using RPage = ROOT::Experimental::Detail::RPage;
+using RPageDeleter = ROOT::Experimental::Detail::RPageDeleter;
+
+TEST(Cluster, Allocate)
+{
+   auto cluster = new RCluster(0);
+   delete cluster;
+
+   std::unique_ptr<unsigned char []> memory(new unsigned char[4]);
+   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::move(memory));
+   cluster = new RCluster(0);
+   cluster->Adopt(std::move(pageMap));
+   delete cluster;
+}
+
+
+TEST(Cluster, Basics)
+{
+   std::unique_ptr<unsigned char []> memory(new unsigned char[3]);
+   memcpy(memory.get(), "abc", 3);
+   auto address = memory.get();
+   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::move(memory));
+   pageMap->Register(ROnDiskPage::Key(5, 0), ROnDiskPage(address, 2));
+   pageMap->Register(ROnDiskPage::Key(5, 1), ROnDiskPage(address + 2, 1));
+
+   RCluster cluster(0);
+   cluster.Adopt(std::move(pageMap));
+   cluster.SetColumnAvailable(5);
+   EXPECT_TRUE(cluster.ContainsColumn(5));
+   EXPECT_FALSE(cluster.ContainsColumn(4));
+   EXPECT_EQ(2U, cluster.GetNOnDiskPages());
+
+   EXPECT_EQ(nullptr, cluster.GetOnDiskPage(ROnDiskPage::Key(5, 2)));
+   EXPECT_EQ(nullptr, cluster.GetOnDiskPage(ROnDiskPage::Key(4, 0)));
+   auto onDiskPage = cluster.GetOnDiskPage(ROnDiskPage::Key(5, 1));
+   ASSERT_NE(nullptr, onDiskPage);
+   EXPECT_EQ(1U, onDiskPage->GetSize());
+   EXPECT_EQ('c', *static_cast<const unsigned char *>(onDiskPage->GetAddress()));
+
+   // Adopt a partial cluster with another column
+   std::unique_ptr<unsigned char []> other(new unsigned char[1]);
+   other[0] = 'x';
+   address = other.get();
+   pageMap = std::make_unique<ROnDiskPageMapHeap>(std::move(other));
+   pageMap->Register(ROnDiskPage::Key(7, 0), ROnDiskPage(address, 1));
+   RCluster partial(0);
+   partial.Adopt(std::move(pageMap));
+   partial.SetColumnAvailable(7);
+   cluster.Adopt(std::move(partial));
+   EXPECT_TRUE(cluster.ContainsColumn(5));
+   EXPECT_TRUE(cluster.ContainsColumn(7));
+   EXPECT_EQ(3U, cluster.GetNOnDiskPages());
+   onDiskPage = cluster.GetOnDiskPage(ROnDiskPage::Key(7, 0));
+   ASSERT_NE(nullptr, onDiskPage);
+   EXPECT_EQ('x', *static_cast<const unsigned char *>(onDiskPage->GetAddress()));
+}
+
+
+TEST(Cluster, UnzippedPages)
+{
+   unsigned int nCallDeleter = 0;
+   RPageDeleter deleter([](const RPage & /*page*/, void *userData) {
+      (*static_cast<unsigned int *>(userData))++;
+   }, &nCallDeleter);
+
+   unsigned char buffer[8];
+   {
+      RCluster cluster(0);
+      RPage page(1, buffer, 8, 1);
+      cluster.AddUnzippedPage(ROnDiskPage::Key(1, 0), page, deleter);
+      cluster.AddUnzippedPage(ROnDiskPage::Key(1, 1), page, deleter);
+      EXPECT_EQ(2U, cluster.GetNUnzippedPages());
+
+      RPageDeleter takenDeleter;
+      auto takenPage = cluster.TakeUnzippedPage(ROnDiskPage::Key(1, 2), takenDeleter);
+      EXPECT_TRUE(takenPage.IsNull());
+      takenPage = cluster.TakeUnzippedPage(ROnDiskPage::Key(1, 0), takenDeleter);
+      EXPECT_FALSE(takenPage.IsNull());
+      EXPECT_EQ(1U, cluster.GetNUnzippedPages());
+      // The caller is responsible for the taken page
+      takenDeleter(takenPage);
+      EXPECT_EQ(1U, nCallDeleter);
+   }
+   // The remaining page is released by the cluster
+   EXPECT_EQ(2U, nCallDeleter);
+}
@@ -3,6 +3,8 @@
 #include <ROOT/RNTupleMetrics.hxx>
 
 #include <chrono>
+#include <sstream>
+#include <string>
 #include <thread>
 
 using RNTuplePlainCounter = ROOT::Experimental::Detail::RNTuplePlainCounter;
@@ -56,3 +58,38 @@ TEST(Metrics, Timer)
    }
    EXPECT_GT(ctrWallTime.GetValue(), 0U);
 }
+
+TEST(Metrics, Export)
+{
+   RNTupleMetrics outer("outer");
+   RNTupleMetrics inner("inner");
+   outer.ObserveMetrics(inner);
+   auto ctrOuter = outer.MakeCounter<RNTuplePlainCounter *>("plain", "B", "outer counter");
+   auto ctrInner = inner.MakeCounter<RNTupleAtomicCounter *>("atomic", "", "inner, \"quoted\" counter");
+
+   EXPECT_EQ(ctrOuter, outer.GetCounter("outer.plain"));
+   EXPECT_EQ(ctrInner, outer.GetCounter("outer.inner.atomic"));
+   EXPECT_EQ(nullptr, outer.GetCounter("outer.atomic"));
+   EXPECT_EQ(nullptr, outer.GetCounter("inner.atomic"));
+
+   std::ostringstream csv;
+   outer.PrintCSV(csv);
+   EXPECT_EQ("name,unit,description,value\n", csv.str());
+
+   outer.Enable();
+   ctrOuter->Add(42);
+   ctrInner->Inc();
+   csv.str("");
+   outer.PrintCSV(csv);
+   EXPECT_EQ("name,unit,description,value\n"
+             "\"outer.plain\",\"B\",\"outer counter\",42\n"
+             "\"outer.inner.atomic\",\"\",\"inner, \"\"quoted\"\" counter\",1\n", csv.str());
+
+   std::ostringstream json;
+   outer.PrintJSON(json);
+   EXPECT_EQ("{\"name\":\"outer\",\"enabled\":true,\"counters\":["
+             "{\"name\":\"plain\",\"unit\":\"B\",\"description\":\"outer counter\",\"value\":42}],"
+             "\"metrics\":[{\"name\":\"inner\",\"enabled\":true,\"counters\":["
+             "{\"name\":\"atomic\",\"unit\":\"\",\"description\":\"inner, \\\"quoted\\\" counter\","
+             "\"value\":1}],\"metrics\":[]}]}", json.str());
+}
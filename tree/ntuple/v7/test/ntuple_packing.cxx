@@ -1,6 +1,16 @@
 #include "gtest/gtest.h"
 
 #include <ROOT/RColumnElement.hxx>
+#include <ROOT/RColumnModel.hxx>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using EColumnEncoding = ROOT::Experimental::EColumnEncoding;
+using EColumnType = ROOT::Experimental::EColumnType;
+using RColumnElementEncoded = ROOT::Experimental::Detail::RColumnElementEncoded;
 
 TEST(Packing, Bitfield)
 {
@@ -34,3 +44,80 @@ TEST(Packing, Bitfield)
       EXPECT_EQ(b9[i], e9[i]);
    }
 }
+
+
+TEST(Packing, DeltaZigzag)
+{
+   RColumnElementEncoded element(EColumnType::kIndex, sizeof(std::uint32_t), EColumnEncoding::kDeltaZigzag);
+   EXPECT_FALSE(element.IsMappable());
+   EXPECT_EQ(32U, element.GetBitsOnStorage());
+
+   std::vector<std::uint32_t> offsets{0, 3, 3, 10, 9, 0xffffffff, 0};
+   std::vector<std::uint32_t> packed(offsets.size());
+   element.Pack(packed.data(), offsets.data(), offsets.size());
+   EXPECT_EQ(0U, packed[0]);
+   EXPECT_EQ(6U, packed[1]);
+   EXPECT_EQ(0U, packed[2]);
+   EXPECT_EQ(14U, packed[3]);
+   EXPECT_EQ(1U, packed[4]);
+   std::vector<std::uint32_t> unpacked(offsets.size());
+   element.Unpack(unpacked.data(), packed.data(), offsets.size());
+   EXPECT_EQ(offsets, unpacked);
+
+   RColumnElementEncoded element64(EColumnType::kInt64, sizeof(std::int64_t), EColumnEncoding::kDeltaZigzag);
+   std::vector<std::int64_t> values{-5, std::numeric_limits<std::int64_t>::max(),
+                                    std::numeric_limits<std::int64_t>::min(), 0, 1};
+   std::vector<std::int64_t> packed64(values.size());
+   std::vector<std::int64_t> unpacked64(values.size());
+   element64.Pack(packed64.data(), values.data(), values.size());
+   element64.Unpack(unpacked64.data(), packed64.data(), values.size());
+   EXPECT_EQ(values, unpacked64);
+}
+
+TEST(Packing, ByteSplit)
+{
+   RColumnElementEncoded element(EColumnType::kReal32, sizeof(float), EColumnEncoding::kByteSplit);
+   EXPECT_EQ(32U, element.GetBitsOnStorage());
+
+   std::vector<float> values{1.0, -2.5, 3.25};
+   std::vector<unsigned char> packed(values.size() * sizeof(float));
+   element.Pack(packed.data(), values.data(), values.size());
+   auto bytes = reinterpret_cast<const unsigned char *>(values.data());
+   for (unsigned i = 0; i < values.size(); ++i) {
+      for (unsigned b = 0; b < sizeof(float); ++b)
+         EXPECT_EQ(bytes[i * sizeof(float) + b], packed[b * values.size() + i]);
+   }
+   std::vector<float> unpacked(values.size());
+   element.Unpack(unpacked.data(), packed.data(), values.size());
+   EXPECT_EQ(values, unpacked);
+}
+
+TEST(Packing, BFloat16)
+{
+   RColumnElementEncoded element(EColumnType::kReal32, sizeof(float), EColumnEncoding::kBFloat16);
+   EXPECT_EQ(16U, element.GetBitsOnStorage());
+
+   std::vector<float> values{0.0, 1.0, -2.0, 3.14159, 1.0e30, std::numeric_limits<float>::infinity(),
+                             std::numeric_limits<float>::quiet_NaN()};
+   std::vector<std::uint16_t> packed(values.size());
+   element.Pack(packed.data(), values.data(), values.size());
+   std::vector<float> unpacked(values.size());
+   element.Unpack(unpacked.data(), packed.data(), values.size());
+   EXPECT_EQ(0.0, unpacked[0]);
+   EXPECT_EQ(1.0, unpacked[1]);
+   EXPECT_EQ(-2.0, unpacked[2]);
+   EXPECT_NEAR(3.14159, unpacked[3], 3.14159 / 128.);
+   EXPECT_NEAR(1.0e30, unpacked[4], 1.0e30 / 128.);
+   EXPECT_TRUE(std::isinf(unpacked[5]));
+   EXPECT_TRUE(std::isnan(unpacked[6]));
+}
+
+TEST(Packing, EncodingApplicable)
+{
+   EXPECT_TRUE(RColumnElementEncoded::IsApplicable(EColumnType::kIndex, EColumnEncoding::kDeltaZigzag));
+   EXPECT_FALSE(RColumnElementEncoded::IsApplicable(EColumnType::kReal32, EColumnEncoding::kDeltaZigzag));
+   EXPECT_TRUE(RColumnElementEncoded::IsApplicable(EColumnType::kReal64, EColumnEncoding::kByteSplit));
+   EXPECT_FALSE(RColumnElementEncoded::IsApplicable(EColumnType::kByte, EColumnEncoding::kByteSplit));
+   EXPECT_FALSE(RColumnElementEncoded::IsApplicable(EColumnType::kReal64, EColumnEncoding::kBFloat16));
+   EXPECT_TRUE(RColumnElementEncoded::IsApplicable(EColumnType::kBit, EColumnEncoding::kPlain));
+}
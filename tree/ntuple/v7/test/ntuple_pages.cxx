@@ -3,6 +3,8 @@
 #include <ROOT/RPageAllocator.hxx>
 #include <ROOT/RPagePool.hxx>
 
+#include <vector>
+
 using RPage = ROOT::Experimental::Detail::RPage;
 using RPageAllocatorHeap = ROOT::Experimental::Detail::RPageAllocatorHeap;
 using RPageDeleter = ROOT::Experimental::Detail::RPageDeleter;
@@ -63,3 +65,57 @@ TEST(Pages, Pool)
    page = pool.GetPage(1, 55);
    EXPECT_TRUE(page.IsNull());
 }
+
+TEST(Pages, PoolEviction)
+{
+   RPagePool pool(20);
+   EXPECT_EQ(20U, pool.GetMemoryBudget());
+
+   unsigned char buffers[4][10];
+   std::vector<RPage> pages;
+   unsigned int nCallDeleter = 0;
+   RPageDeleter deleter([](const RPage & /*page*/, void *userData) {
+      (*reinterpret_cast<unsigned int *>(userData))++;
+   }, &nCallDeleter);
+   for (unsigned int i = 0; i < 4; ++i) {
+      RPage page(1, buffers[i], 10, 1);
+      EXPECT_NE(nullptr, page.TryGrow(10));
+      page.SetWindow(10 * i, RPage::RClusterInfo(0, 0));
+      pages.emplace_back(page);
+   }
+
+   // Referenced pages are never evicted, even if they exceed the budget
+   pool.RegisterPage(pages[0], deleter);
+   pool.RegisterPage(pages[1], deleter);
+   pool.RegisterPage(pages[2], deleter);
+   EXPECT_EQ(30U, pool.GetMemoryUsage());
+   EXPECT_EQ(0U, nCallDeleter);
+
+   pool.ReturnPage(pages[0]);
+   EXPECT_EQ(1U, nCallDeleter);
+   EXPECT_EQ(20U, pool.GetMemoryUsage());
+   EXPECT_TRUE(pool.GetPage(1, 5).IsNull());
+
+   // Unreferenced pages within the budget are kept for reuse
+   pool.ReturnPage(pages[1]);
+   EXPECT_EQ(1U, nCallDeleter);
+   auto page = pool.GetPage(1, ROOT::Experimental::RClusterIndex(0, 15));
+   EXPECT_EQ(pages[1], page);
+   pool.ReturnPage(page);
+   pool.ReturnPage(pages[2]);
+   EXPECT_EQ(2U, pool.GetNPages());
+   EXPECT_EQ(1U, nCallDeleter);
+
+   // The least recently used page is evicted first
+   pool.RegisterPage(pages[3], deleter);
+   EXPECT_EQ(2U, nCallDeleter);
+   EXPECT_TRUE(pool.GetPage(1, 15).IsNull());
+   page = pool.GetPage(1, 25);
+   EXPECT_EQ(pages[2], page);
+   EXPECT_EQ(20U, page.GetGlobalRangeFirst());
+   EXPECT_TRUE(pool.GetPage(2, 25).IsNull());
+   EXPECT_TRUE(pool.GetPage(1, 40).IsNull());
+   pool.ReturnPage(page);
+   pool.ReturnPage(pages[3]);
+   EXPECT_EQ(2U, nCallDeleter);
+}
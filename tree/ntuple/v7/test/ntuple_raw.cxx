@@ -2,18 +2,24 @@
 
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDS.hxx>
+#include <ROOT/RNTupleMerger.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RPageStorageRaw.hxx>
 
 #include <TRandom3.h>
+#include <TROOT.h>
 
 #include <cstdio>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
 using RNTupleModel = ROOT::Experimental::RNTupleModel;
+using RNTupleParallelWriter = ROOT::Experimental::RNTupleParallelWriter;
 using RNTupleReader = ROOT::Experimental::RNTupleReader;
 using RNTupleWriter = ROOT::Experimental::RNTupleWriter;
 using RPageSinkRaw = ROOT::Experimental::Detail::RPageSinkRaw;
@@ -112,3 +118,505 @@ TEST(RNTuple, Extended)
    EXPECT_GE(1, minLengh);
    EXPECT_LE(minLengh, 1000);
 }
+
+
+TEST(RNTuple, DataSourceRanges)
+{
+   FileRaii fileGuard("test_ntuple_rawfile_dsranges.ntuple");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrNHits = model->MakeField<std::int32_t>("nHits");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 100; ++i) {
+         *wrPt = static_cast<float>(i);
+         *wrNHits = i * 2;
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   ROOT::Experimental::RNTupleDS ds(
+      std::make_unique<RPageSourceRaw>("f", fileGuard.GetPath(), ROOT::Experimental::RNTupleReadOptions()));
+   ds.SetNSlots(2);
+   auto ptrsPt = ds.GetColumnReaders<float>("pt");
+   ds.Initialise();
+   auto ranges = ds.GetEntryRanges();
+   EXPECT_TRUE(ds.GetEntryRanges().empty());
+
+   // Four ranges of at least 25 entries each that are aligned to the clusters of 10 entries
+   ASSERT_EQ(4U, ranges.size());
+   ULong64_t nextStart = 0;
+   for (std::size_t i = 0; i < ranges.size(); ++i) {
+      EXPECT_EQ(nextStart, ranges[i].first);
+      EXPECT_EQ(0U, ranges[i].second % 10);
+      nextStart = ranges[i].second;
+
+      auto slot = i % 2;
+      for (auto entry = ranges[i].first; entry < ranges[i].second; ++entry) {
+         ds.SetEntry(slot, entry);
+         EXPECT_EQ(static_cast<float>(entry), **ptrsPt[slot]);
+      }
+   }
+   EXPECT_EQ(100U, nextStart);
+
+   // Requesting another column recreates the slot readers for the next event loop
+   auto ptrsNHits = ds.GetColumnReaders<std::int32_t>("nHits");
+   ds.Initialise();
+   ranges = ds.GetEntryRanges();
+   ds.SetEntry(1, 42);
+   EXPECT_EQ(42.0, **ptrsPt[1]);
+   EXPECT_EQ(84, **ptrsNHits[1]);
+
+   // The data source can also be created from a reader
+   auto rdf = ROOT::RDataFrame(std::make_unique<ROOT::Experimental::RNTupleDS>(
+      RNTupleReader::Open("f", fileGuard.GetPath())));
+   EXPECT_EQ(100U, *rdf.Count());
+   EXPECT_EQ(9900, *rdf.Sum<std::int32_t>("nHits"));
+}
+
+
+TEST(RNTuple, ClusterCache)
+{
+   FileRaii fileGuard("test_ntuple_rawfile_clustercache.ntuple");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrNHits = model->MakeField<std::int32_t>("nHits");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 100; ++i) {
+         *wrPt = static_cast<float>(i);
+         *wrNHits = i * 2;
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {ROOT::Experimental::RNTupleReadOptions::kOff,
+                             ROOT::Experimental::RNTupleReadOptions::kOn}) {
+      ROOT::Experimental::RNTupleReadOptions options;
+      options.SetClusterCache(clusterCache);
+      options.SetClusterLookahead(3);
+      RNTupleReader ntuple(std::make_unique<RPageSourceRaw>("f", fileGuard.GetPath(), options));
+      EXPECT_EQ(100U, ntuple.GetNEntries());
+
+      auto viewPt = ntuple.GetView<float>("pt");
+      for (auto i : ntuple.GetViewRange()) {
+         EXPECT_EQ(static_cast<float>(i), viewPt(i));
+      }
+      // A column that is added after the first clusters have been loaded, read backwards
+      auto viewNHits = ntuple.GetView<std::int32_t>("nHits");
+      for (int i = 99; i >= 0; --i) {
+         EXPECT_EQ(i * 2, viewNHits(i));
+         EXPECT_EQ(static_cast<float>(i), viewPt(i));
+      }
+   }
+}
+
+
+TEST(RNTuple, ParallelCompression)
+{
+   FileRaii fileGuard("test_ntuple_rawfile_parallel_compression.ntuple");
+
+   ROOT::EnableImplicitMT();
+   auto model = RNTupleModel::Create();
+   auto wrVector = model->MakeField<std::vector<double>>("vector");
+   auto wrFlag = model->MakeField<bool>("flag");
+
+   double chksumWrite = 0.0;
+   int nFlags = 0;
+   {
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetCompression(ROOT::CompressionSettings(ROOT::kZLIB, 1));
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < 10000; ++i) {
+         wrVector->resize(i % 100);
+         for (unsigned int n = 0; n < wrVector->size(); ++n) {
+            (*wrVector)[n] = i + n;
+            chksumWrite += i + n;
+         }
+         *wrFlag = (i % 3) == 0;
+         nFlags += *wrFlag;
+         ntuple->Fill();
+         if (i % 1000 == 999)
+            ntuple->CommitCluster();
+      }
+   }
+   ROOT::DisableImplicitMT();
+
+   auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath());
+   EXPECT_EQ(10000U, ntuple->GetNEntries());
+   auto rdVector = ntuple->GetModel()->GetDefaultEntry()->Get<std::vector<double>>("vector");
+   auto rdFlag = ntuple->GetModel()->GetDefaultEntry()->Get<bool>("flag");
+   double chksumRead = 0.0;
+   int nFlagsRead = 0;
+   for (auto entryId : *ntuple) {
+      ntuple->LoadEntry(entryId);
+      for (auto v : *rdVector)
+         chksumRead += v;
+      nFlagsRead += *rdFlag;
+   }
+   EXPECT_EQ(chksumWrite, chksumRead);
+   EXPECT_EQ(nFlags, nFlagsRead);
+}
+
+
+TEST(RNTuple, BulkRead)
+{
+   FileRaii fileGuard("test_ntuple_rawfile_bulkread.ntuple");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrNHits = model->MakeField<std::int32_t>("nHits");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 10000; ++i) {
+         *wrPt = static_cast<float>(i);
+         *wrNHits = i * 2;
+         ntuple->Fill();
+         if (i % 3000 == 2999)
+            ntuple->CommitCluster();
+      }
+   }
+
+   RNTupleReader ntuple(
+      std::make_unique<RPageSourceRaw>("f", fileGuard.GetPath(), ROOT::Experimental::RNTupleReadOptions()));
+   auto viewPt = ntuple.GetView<float>("pt");
+   auto viewNHits = ntuple.GetView<std::int32_t>("nHits");
+
+   unsigned int nBatches = 0;
+   double sumPt = 0.0;
+   for (ROOT::Experimental::NTupleSize_t i = 0; i < ntuple.GetNEntries(); ) {
+      ROOT::Experimental::NTupleSize_t nItems = 0;
+      auto pt = viewPt.MapV(i, nItems);
+      ASSERT_GT(nItems, 0U);
+      ASSERT_LE(i + nItems, ntuple.GetNEntries());
+      for (ROOT::Experimental::NTupleSize_t j = 0; j < nItems; ++j) {
+         EXPECT_EQ(static_cast<float>(i + j), pt[j]);
+         sumPt += pt[j];
+      }
+      i += nItems;
+      nBatches++;
+   }
+   // Every cluster has at least one page
+   EXPECT_LE(4U, nBatches);
+   EXPECT_DOUBLE_EQ(10000.0 * 9999.0 / 2.0, sumPt);
+
+   // Mapping from the middle of a page yields the remainder of the page
+   ROOT::Experimental::NTupleSize_t nItemsFirst = 0;
+   ROOT::Experimental::NTupleSize_t nItemsSecond = 0;
+   auto nHitsFirst = viewNHits.MapV(3000, nItemsFirst);
+   auto nHitsSecond = viewNHits.MapV(3001, nItemsSecond);
+   EXPECT_EQ(nItemsFirst - 1, nItemsSecond);
+   EXPECT_EQ(nHitsFirst + 1, nHitsSecond);
+   EXPECT_EQ(6002, *nHitsSecond);
+
+   ROOT::Experimental::NTupleSize_t nItemsCluster = 0;
+   auto nHitsCluster = viewNHits.MapV(ROOT::Experimental::RClusterIndex(1, 1), nItemsCluster);
+   EXPECT_EQ(nItemsSecond, nItemsCluster);
+   EXPECT_EQ(6002, *nHitsCluster);
+}
+
+
+TEST(RNTuple, ColumnEncoding)
+{
+   FileRaii fileGuard("test_ntuple_rawfile_column_encoding.ntuple");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrEnergy = model->MakeField<float>("energy");
+   auto wrJets = model->MakeField<std::vector<double>>("jets");
+   auto wrNHits = model->MakeField<std::int32_t>("nHits");
+   model->SetColumnEncoding("pt", ROOT::Experimental::EColumnEncoding::kByteSplit);
+   model->SetColumnEncoding("energy", ROOT::Experimental::EColumnEncoding::kBFloat16);
+   model->SetColumnEncoding("jets", ROOT::Experimental::EColumnEncoding::kDeltaZigzag);
+   model->SetColumnEncoding("nHits", ROOT::Experimental::EColumnEncoding::kDeltaZigzag);
+   EXPECT_THROW(model->SetColumnEncoding("jets.nHits", ROOT::Experimental::EColumnEncoding::kDeltaZigzag),
+                std::runtime_error);
+   {
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < 1000; ++i) {
+         *wrPt = 0.5 * i;
+         *wrEnergy = 2.0;
+         wrJets->resize(i % 5);
+         for (unsigned int j = 0; j < wrJets->size(); ++j)
+            (*wrJets)[j] = i + j;
+         *wrNHits = 500 - static_cast<int>(i);
+         ntuple->Fill();
+         if (i % 400 == 399)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   auto columnModel = [&desc](const std::string &fieldName) {
+      return desc.GetColumnDescriptor(desc.FindColumnId(desc.FindFieldId(fieldName), 0)).GetModel();
+   };
+   EXPECT_EQ(ROOT::Experimental::EColumnEncoding::kByteSplit, columnModel("pt").GetEncoding());
+   EXPECT_EQ(ROOT::Experimental::EColumnEncoding::kBFloat16, columnModel("energy").GetEncoding());
+   EXPECT_EQ(ROOT::Experimental::EColumnEncoding::kDeltaZigzag, columnModel("jets").GetEncoding());
+   EXPECT_EQ(ROOT::Experimental::EColumnEncoding::kDeltaZigzag, columnModel("nHits").GetEncoding());
+
+   auto rdPt = ntuple->GetModel()->GetDefaultEntry()->Get<float>("pt");
+   auto rdEnergy = ntuple->GetModel()->GetDefaultEntry()->Get<float>("energy");
+   auto rdJets = ntuple->GetModel()->GetDefaultEntry()->Get<std::vector<double>>("jets");
+   auto rdNHits = ntuple->GetModel()->GetDefaultEntry()->Get<std::int32_t>("nHits");
+   for (auto i : *ntuple) {
+      ntuple->LoadEntry(i);
+      EXPECT_EQ(0.5 * i, *rdPt);
+      EXPECT_EQ(2.0, *rdEnergy);
+      ASSERT_EQ(i % 5, rdJets->size());
+      for (unsigned int j = 0; j < rdJets->size(); ++j)
+         EXPECT_EQ(static_cast<double>(i + j), (*rdJets)[j]);
+      EXPECT_EQ(500 - static_cast<int>(i), *rdNHits);
+   }
+}
+
+
+TEST(RNTuple, MemoryMap)
+{
+   FileRaii fileGuard("test_ntuple_rawfile_memory_map.ntuple");
+   FileRaii fileGuardZip("test_ntuple_rawfile_memory_map_zip.ntuple");
+
+   // Values repeat a hundred times so that the compressed file has all of its pages compressed
+   for (const auto &file : {std::make_pair(fileGuard.GetPath(), 0), std::make_pair(fileGuardZip.GetPath(), 404)}) {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrE = model->MakeField<double>("E");
+      auto wrFlag = model->MakeField<bool>("flag");
+      auto wrTracks = model->MakeField<std::vector<std::int32_t>>("tracks");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetCompression(file.second);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", file.first, options);
+      for (unsigned int i = 0; i < 1000; ++i) {
+         *wrPt = static_cast<float>(i / 100);
+         *wrE = 2.0 * (i / 100);
+         *wrFlag = (i % 2) == 0;
+         wrTracks->assign(i % 3, i / 100);
+         ntuple->Fill();
+         if (i % 300 == 299)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto fnGetNPageMapped = [](RNTupleReader &ntuple) {
+      std::ostringstream metrics;
+      ntuple.PrintInfo(ROOT::Experimental::ENTupleInfo::kMetrics, metrics);
+      std::istringstream lines(metrics.str());
+      std::string line;
+      std::int64_t nPageMapped = -1;
+      while (std::getline(lines, line)) {
+         if (line.find("nPageMapped") == std::string::npos)
+            continue;
+         nPageMapped = std::stoll(line.substr(line.rfind('|') + 1));
+      }
+      return nPageMapped;
+   };
+
+   for (const auto &path : {fileGuard.GetPath(), fileGuardZip.GetPath()}) {
+      for (auto clusterCache : {ROOT::Experimental::RNTupleReadOptions::kOff,
+                                ROOT::Experimental::RNTupleReadOptions::kOn}) {
+         ROOT::Experimental::RNTupleReadOptions options;
+         options.SetClusterCache(clusterCache);
+         RNTupleReader reference(std::make_unique<RPageSourceRaw>("f", path, options));
+         options.SetUseMemoryMap(true);
+         RNTupleReader ntuple(std::make_unique<RPageSourceRaw>("f", path, options));
+         ntuple.EnableMetrics();
+
+         auto refPt = reference.GetView<float>("pt");
+         auto refE = reference.GetView<double>("E");
+         auto refFlag = reference.GetView<bool>("flag");
+         auto refTracks = reference.GetView<std::vector<std::int32_t>>("tracks");
+         auto viewPt = ntuple.GetView<float>("pt");
+         auto viewE = ntuple.GetView<double>("E");
+         auto viewFlag = ntuple.GetView<bool>("flag");
+         auto viewTracks = ntuple.GetView<std::vector<std::int32_t>>("tracks");
+         ASSERT_EQ(reference.GetNEntries(), ntuple.GetNEntries());
+         for (auto i : ntuple.GetViewRange()) {
+            EXPECT_EQ(static_cast<float>(i / 100), viewPt(i));
+            EXPECT_EQ(refPt(i), viewPt(i));
+            EXPECT_EQ(refE(i), viewE(i));
+            EXPECT_EQ(refFlag(i), viewFlag(i));
+            EXPECT_EQ(refTracks(i), viewTracks(i));
+         }
+
+         if (path == fileGuard.GetPath()) {
+            // All pages but the ones of the bit-packed bool column are used in place
+            EXPECT_GT(fnGetNPageMapped(ntuple), 0);
+         } else {
+            // Compressed pages fall back to the regular read and decompression
+            EXPECT_EQ(0, fnGetNPageMapped(ntuple));
+         }
+      }
+   }
+}
+
+
+TEST(RNTuple, ParallelWriter)
+{
+   FileRaii fileGuard("test_ntuple_rawfile_parallel_writer.ntuple");
+
+   constexpr unsigned int kNThreads = 4;
+   constexpr unsigned int kNEntriesPerThread = 5000;
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   model->MakeField<std::vector<std::int32_t>>("tracks");
+   {
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+      std::vector<std::thread> threads;
+      for (unsigned int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t]() {
+            auto context = writer->CreateFillContext();
+            auto pt = context->GetModel()->Get<float>("pt");
+            auto tracks = context->GetModel()->Get<std::vector<std::int32_t>>("tracks");
+            for (unsigned int i = 0; i < kNEntriesPerThread; ++i) {
+               auto value = t * kNEntriesPerThread + i;
+               *pt = static_cast<float>(value);
+               tracks->assign(value % 3, value);
+               context->Fill();
+               if (i % 1000 == 999)
+                  context->CommitCluster();
+            }
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+      EXPECT_EQ(kNThreads * kNEntriesPerThread, writer->GetNEntries());
+   }
+
+   auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath());
+   ASSERT_EQ(kNThreads * kNEntriesPerThread, ntuple->GetNEntries());
+   EXPECT_EQ(kNThreads * kNEntriesPerThread / 1000, ntuple->GetDescriptor().GetNClusters());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewTracks = ntuple->GetView<std::vector<std::int32_t>>("tracks");
+   std::vector<bool> seen(kNThreads * kNEntriesPerThread, false);
+   for (auto i : ntuple->GetViewRange()) {
+      auto value = static_cast<unsigned int>(viewPt(i));
+      ASSERT_LT(value, seen.size());
+      EXPECT_FALSE(seen[value]);
+      seen[value] = true;
+      ASSERT_EQ(value % 3, viewTracks(i).size());
+      for (auto t : viewTracks(i))
+         EXPECT_EQ(static_cast<std::int32_t>(value), t);
+   }
+}
+
+
+TEST(RNTuple, Merge)
+{
+   FileRaii fileGuard1("test_ntuple_rawfile_merge_in1.ntuple");
+   FileRaii fileGuard2("test_ntuple_rawfile_merge_in2.ntuple");
+   FileRaii fileGuard3("test_ntuple_rawfile_merge_in3.ntuple");
+   FileRaii fileGuardOut("test_ntuple_rawfile_merge_out.ntuple");
+
+   auto fnWrite = [](const std::string &path, unsigned int firstValue, int compression) {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrFlag = model->MakeField<bool>("flag");
+      auto wrTracks = model->MakeField<std::vector<std::int32_t>>("tracks");
+      model->SetColumnEncoding("pt", ROOT::Experimental::EColumnEncoding::kByteSplit);
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetCompression(compression);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", path, options);
+      for (unsigned int i = firstValue; i < firstValue + 1000; ++i) {
+         *wrPt = static_cast<float>(i);
+         *wrFlag = (i % 2) == 0;
+         wrTracks->assign(i % 3, i);
+         ntuple->Fill();
+         if (i % 500 == 499)
+            ntuple->CommitCluster();
+      }
+   };
+   fnWrite(fileGuard1.GetPath(), 0, 404);
+   fnWrite(fileGuard2.GetPath(), 1000, 404);
+   fnWrite(fileGuard3.GetPath(), 2000, 0);
+
+   ROOT::Experimental::RNTupleReadOptions readOptions;
+   RPageSourceRaw source1("f", fileGuard1.GetPath(), readOptions);
+   RPageSourceRaw source2("f", fileGuard2.GetPath(), readOptions);
+   RPageSourceRaw source3("f", fileGuard3.GetPath(), readOptions);
+   source1.Attach();
+   source2.Attach();
+   source3.Attach();
+
+   ROOT::Experimental::RNTupleMerger merger;
+   {
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetCompression(404);
+      RPageSinkRaw sink("f", fileGuardOut.GetPath(), options);
+      merger.Merge({&source1, &source2}, sink);
+   }
+   {
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetCompression(404);
+      RPageSinkRaw sink("f", fileGuardOut.GetPath() + ".mismatch", options);
+      EXPECT_THROW(merger.Merge({&source1, &source3}, sink), std::runtime_error);
+      // The inputs are rejected before the output is created
+      EXPECT_EQ(0U, sink.GetDescriptor().GetNFields());
+   }
+   std::remove((fileGuardOut.GetPath() + ".mismatch").c_str());
+
+   auto ntuple = RNTupleReader::Open("f", fileGuardOut.GetPath());
+   ASSERT_EQ(2000U, ntuple->GetNEntries());
+   EXPECT_EQ(4U, ntuple->GetDescriptor().GetNClusters());
+   const auto &desc = ntuple->GetDescriptor();
+   auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+   EXPECT_EQ(ROOT::Experimental::EColumnEncoding::kByteSplit,
+             desc.GetColumnDescriptor(ptColumnId).GetModel().GetEncoding());
+
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewFlag = ntuple->GetView<bool>("flag");
+   auto viewTracks = ntuple->GetView<std::vector<std::int32_t>>("tracks");
+   for (auto i : ntuple->GetViewRange()) {
+      EXPECT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_EQ((i % 2) == 0, viewFlag(i));
+      ASSERT_EQ(i % 3, viewTracks(i).size());
+      for (auto t : viewTracks(i))
+         EXPECT_EQ(static_cast<std::int32_t>(i), t);
+   }
+}
+
+TEST(RNTuple, ColumnMetrics)
+{
+   FileRaii fileGuard("test_ntuple_rawfile_columnmetrics.ntuple");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrTracks = model->MakeField<std::vector<float>>("tracks");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+      for (unsigned int i = 0; i < 100; ++i) {
+         *wrPt = static_cast<float>(i);
+         *wrTracks = {1.0, 2.0};
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath());
+   ntuple->EnableMetrics();
+   for (auto i : ntuple->GetViewRange())
+      ntuple->LoadEntry(i);
+
+   const auto &metrics = ntuple->GetMetrics();
+   auto ctrNPages = metrics.GetCounter("RNTupleReader.RPageSourceRaw.pt#0.nPages");
+   auto ctrSzRead = metrics.GetCounter("RNTupleReader.RPageSourceRaw.pt#0.szRead");
+   auto ctrSubNPages = metrics.GetCounter("RNTupleReader.RPageSourceRaw.tracks.float#0.nPages");
+   auto ctrNRead = metrics.GetCounter("RNTupleReader.tracks.nRead");
+   ASSERT_NE(nullptr, ctrNPages);
+   ASSERT_NE(nullptr, ctrSzRead);
+   ASSERT_NE(nullptr, ctrSubNPages);
+   ASSERT_NE(nullptr, ctrNRead);
+   EXPECT_EQ("10", ctrNPages->ValueToString());
+   EXPECT_EQ("10", ctrSubNPages->ValueToString());
+   EXPECT_NE("0", ctrSzRead->ValueToString());
+   EXPECT_EQ("100", ctrNRead->ValueToString());
+}
@@ -30,7 +30,8 @@ namespace ROOT {
 // to BITS(kIOFeatureCount).
 //
 enum class EIOFeatures {
-   kSupported = 0  // Union of all known, supported, and enabled-by-default features (currently none).
+   kGenerateOffsetMap = BIT(0),
+   kSupported = kGenerateOffsetMap  // Union of all known, supported, and enabled-by-default features.
 };
 
 
@@ -43,8 +44,8 @@ namespace Experimental {
 // the "ROOT-IO-wide" level and not restricted to TBasket -- even if all the currently-foreseen
 // usage of this mechanism somehow involves baskets currently.
 enum class EIOFeatures {
-   kGenerateOffsetMap = BIT(0),
-   kSupported = kGenerateOffsetMap  // Union of all features in this enum.
+   kGenerateOffsetMap = BIT(0),  // Now ROOT::EIOFeatures::kGenerateOffsetMap; kept for backward compatibility.
+   kSupported = 0  // Union of all features in this enum (currently none).
 };
 
 
@@ -72,9 +72,11 @@ class TBulkBranchRead {
 
 public:
    Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf);
+   Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf, TBuffer &offset_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
    Bool_t SupportsBulkRead() const;
+   Bool_t SupportsBulkReadWithOffsets() const;
 
 private:
    TBulkBranchRead(TBranch &parent)
@@ -176,6 +178,8 @@ private:
    Int_t    GetBasketAndFirst(TBasket*& basket, Long64_t& first, TBuffer* user_buffer);
    TBasket *GetBasketImpl(Int_t basket, TBuffer* user_buffer);
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
+   Int_t    GetBulkEntries(Long64_t, TBuffer&, TBuffer&);
+   Bool_t   GetBulkValueType(EDataType &type, Bool_t &isCollection) const;
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
@@ -280,6 +284,7 @@ public:
    virtual void      SetTree(TTree *tree) { fTree = tree;}
    virtual void      SetupAddresses();
            Bool_t    SupportsBulkRead() const;
+           Bool_t    SupportsBulkReadWithOffsets() const;
    virtual void      UpdateAddress() {;}
    virtual void      UpdateFile();
 
@@ -311,9 +316,11 @@ namespace Experimental {
 namespace Internal {
 
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
+inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf, TBuffer& offset_buf) { return fParent.GetBulkEntries(evt, user_buf, offset_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
 inline Bool_t TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
+inline Bool_t TBulkBranchRead::SupportsBulkReadWithOffsets() const { return fParent.SupportsBulkReadWithOffsets(); }
 
 }  // Internal
 }  // Experimental
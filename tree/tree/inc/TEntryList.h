@@ -63,6 +63,7 @@ class TEntryList: public TNamed
 
    virtual void        Add(const TEntryList *elist);
    virtual Int_t       Contains(Long64_t entry, TTree *tree = 0);
+   virtual Bool_t      ContainsRange(Long64_t entrymin, Long64_t entrymax);
    virtual void        DirectoryAutoAdd(TDirectory *);
    virtual Bool_t      Enter(Long64_t entry, TTree *tree = 0);
    virtual TEntryList *GetCurrentList() const { return fCurrent; };
@@ -67,6 +67,7 @@ class TEntryListBlock:public TObject
    Bool_t  Enter(Int_t entry);
    Bool_t  Remove(Int_t entry);
    Int_t   Contains(Int_t entry);
+   Bool_t  ContainsRange(Int_t entrymin, Int_t entrymax);
    void    OptimizeStorage();
    Int_t   Merge(TEntryListBlock *block);
    Int_t   Next();
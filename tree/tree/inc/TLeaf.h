@@ -49,6 +49,7 @@ class TBrowser;
 class TLeaf : public TNamed {
 
 private:
+   friend class TBranch;
 
    virtual Int_t GetOffsetHeaderSize() const {return 0;}
 
@@ -104,7 +104,7 @@ protected:
    Int_t          fDebug;                 ///<! Debug level
    Long64_t       fDebugMin;              ///<! First entry number to debug
    Long64_t       fDebugMax;              ///<! Last entry number to debug
-   TIOFeatures    fIOFeatures{0};         ///<  IO features to define for newly-written baskets and branches.
+   TIOFeatures    fIOFeatures{static_cast<UChar_t>(ROOT::EIOFeatures::kSupported)}; ///<  IO features to define for newly-written baskets and branches.
    Int_t          fMakeClass;             ///<! not zero when processing code generated by MakeClass
    Int_t          fFileNumber;            ///<! current file number (if file extensions)
    TObject       *fNotify;                ///<! Object to be notified when loading a Tree
@@ -132,6 +132,11 @@ protected:
    UInt_t         fNEntriesSinceSorting;  ///<! Number of entries processed since the last re-sorting of branches
    std::vector<std::pair<Long64_t,TBranch*>> fSortedBranches; ///<! Branches to be processed in parallel when IMT is on, sorted by average task time
    std::vector<TBranch*> fSeqBranches;    ///<! Branches to be processed sequentially when IMT is on
+   Bool_t         fIMTClusterRead{kFALSE};///<! true if, with IMT, branches are read in parallel once per cluster rather than per entry
+   Bool_t         fIMTClusterPrevPrefetch{kFALSE};///<! Cluster prefetch setting to restore when the cluster read is disabled
+   Long64_t       fIMTClusterStart{-1};   ///<! First entry of the cluster whose baskets were last loaded in parallel
+   Long64_t       fIMTClusterEnd{-1};     ///<! Entry following the cluster whose baskets were last loaded in parallel
+   Int_t          fIMTClusterNBranches{0};///<! Number of top-level branches when the cluster was loaded in parallel
    Float_t fTargetMemoryRatio{1.1f};      ///<! Ratio for memory usage in uncompressed buffers versus actual occupancy.  1.0
                                            /// indicates basket should be resized to exact memory usage, but causes significant
 /// memory churn.
@@ -405,6 +410,7 @@ public:
    virtual Int_t           BuildIndex(const char* majorname, const char* minorname = "0");
    TStreamerInfo          *BuildStreamerInfo(TClass* cl, void* pointer = 0, Bool_t canOptimize = kTRUE);
    virtual TFile          *ChangeFile(TFile* file);
+           ROOT::TIOFeatures ClearIOFeatures(const ROOT::TIOFeatures &);
    virtual TTree          *CloneTree(Long64_t nentries = -1, Option_t* option = "");
    virtual void            CopyAddresses(TTree*,Bool_t undo = kFALSE);
    virtual Long64_t        CopyEntries(TTree* tree, Long64_t nentries = -1, Option_t *option = "");
@@ -462,6 +468,7 @@ public:
    virtual const char     *GetFriendAlias(TTree*) const;
    TH1                    *GetHistogram() { return GetPlayer()->GetHistogram(); }
    virtual Bool_t          GetImplicitMT() { return fIMTEnabled; }
+           Bool_t          GetIMTClusterRead() const { return fIMTClusterRead; }
    virtual Int_t          *GetIndex() { return &fIndex.fArray[0]; }
    virtual Double_t       *GetIndexValues() { return &fIndexValues.fArray[0]; }
            ROOT::TIOFeatures GetIOFeatures() const;
@@ -600,6 +607,7 @@ public:
    virtual void            SetEventList(TEventList* list);
    virtual void            SetEntryList(TEntryList* list, Option_t *opt="");
    virtual void            SetImplicitMT(Bool_t enabled) { fIMTEnabled = enabled; }
+           void            SetIMTClusterRead(Bool_t enabled = kTRUE);
    virtual void            SetMakeClass(Int_t make);
    virtual void            SetMaxEntryLoop(Long64_t maxev = kMaxEntries) { fMaxEntryLoop = maxev; } // *MENU*
    static  void            SetMaxTreeSize(Long64_t maxsize = 100000000000LL);
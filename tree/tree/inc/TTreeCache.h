@@ -22,8 +22,10 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "TFileCacheRead.h"
+#include "TString.h"
 
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -70,6 +72,13 @@ protected:
 
    Bool_t       fLearnPrefilling{kFALSE}; ///<! true if we are in the process of executing LearnPrefill
 
+   // Sidecar file where the branches learned by a job are recorded, to be
+   // preloaded by the following jobs running the same code (see SetLearnedBranchesFile).
+   TString  fLearnedBranchesFile;                ///<! name of the file recording the learned branch sets
+   TString  fLearnedBranchesKey;                 ///<! key identifying the reading code in fLearnedBranchesFile
+   Bool_t   fLearnedBranchesLoadPending{kFALSE}; ///<! true if the learned branches still have to be preloaded
+   Bool_t   fLearnedBranchesSavePending{kFALSE}; ///<! true if the learned branches still have to be recorded
+
    // These members hold cached data for missed branches when miss optimization
    // is enabled.  Pointers are only initialized if the miss cache is enabled.
    Bool_t   fOptimizeMisses{kFALSE}; ///<! true if we should optimize cache misses.
@@ -107,6 +116,27 @@ protected:
 
    std::unique_ptr<MissCache> fMissCache; ///<! Cache contents for misses
 
+   // These members hold the baskets of the cluster(s) following the ones in
+   // the cache, read in a background thread while the current ones are
+   // processed. Only used if the cluster prefetch is enabled.
+   struct ClusterPrefetch {
+      Long64_t fEntryStart{-1};   ///<! First entry of the prefetched cluster(s)
+      Long64_t fEntryEnd{-1};     ///<! End+1 of the prefetched cluster(s)
+      std::vector<Long64_t> fPos; ///<! Sorted positions in file of the prefetched baskets
+      std::vector<Int_t> fLen;    ///<! Lengths of the prefetched baskets
+      std::vector<Long64_t> fIndex; ///<! Location in fData of the prefetched baskets
+      std::vector<char> fData;    ///<! Actual data of the prefetched baskets
+      std::future<Bool_t> fDone;  ///<! Completion of the background read, kTRUE in case of failure
+
+      const char *Find(Long64_t pos, Int_t len) const;
+   };
+
+   Bool_t   fClusterPrefetchEnabled{kFALSE}; ///<! true if the next cluster(s) are read in the background
+   Long64_t fClusterPrefetchMaxBytes{0};     ///<! memory cap of the cluster prefetch (0: same as the cache size)
+   Int_t    fNClusterPrefetched{0};          ///<! Number of blocks transferred from the cluster prefetch
+   std::unique_ptr<ClusterPrefetch> fClusterPrefetch; ///<! Cluster(s) being or already prefetched
+   std::unique_ptr<TFile> fClusterPrefetchFile;       ///<! Separate handle on fFile used by the background read
+
 private:
    TTreeCache(const TTreeCache &) = delete; ///< this class cannot be copied
    TTreeCache &operator=(const TTreeCache &) = delete;
@@ -127,6 +157,15 @@ private:
    TBranch *CalculateMissEntries(Long64_t, int, bool);    ///< Given an file read, try to determine the corresponding branch.
    Bool_t   ProcessMiss(Long64_t pos, int len); ///<! Given a file read not in the miss cache, handle (possibly) loading the data.
 
+   void     RecordLearnedBranches(); ///< Record the branches just learned in fLearnedBranchesFile, if requested.
+
+protected:
+   // Helpers of the cluster prefetch, also used by TTreeCacheUnzip.
+   Bool_t   TransferClusterPrefetch(); ///< Transfer the baskets to the cache buffer, using the prefetched ones if possible.
+   void     StartClusterPrefetch();    ///< Start reading in the background the cluster(s) following the cached ones.
+   void     WaitClusterPrefetch();     ///< Wait for the background read, if any; to be called before reading the file.
+   void     ResetClusterPrefetch();    ///< Discard the prefetched cluster(s) and close the separate file handle.
+
 public:
 
    TTreeCache();
@@ -134,11 +173,13 @@ public:
    virtual ~TTreeCache();
    virtual Int_t        AddBranch(TBranch *b, Bool_t subgbranches = kFALSE);
    virtual Int_t        AddBranch(const char *branch, Bool_t subbranches = kFALSE);
+   virtual void         Close(Option_t *option="");
    virtual Int_t        DropBranch(TBranch *b, Bool_t subbranches = kFALSE);
    virtual Int_t        DropBranch(const char *branch, Bool_t subbranches = kFALSE);
    virtual void         Disable() {fEnabled = kFALSE;}
    virtual void         Enable() {fEnabled = kTRUE;}
    Bool_t               GetOptimizeMisses() const { return fOptimizeMisses; }
+   Long64_t             GetClusterPrefetchMaxBytes() const { return fClusterPrefetchMaxBytes; }
    const TObjArray     *GetCachedBranches() const { return fBranches; }
    EPrefillType         GetConfiguredPrefillType() const;
    Double_t             GetEfficiency() const;
@@ -146,17 +187,22 @@ public:
    virtual Int_t        GetEntryMin() const {return fEntryMin;}
    virtual Int_t        GetEntryMax() const {return fEntryMax;}
    static Int_t         GetLearnEntries();
+   const char          *GetLearnedBranchesFile() const {return fLearnedBranchesFile;}
+   const char          *GetLearnedBranchesKey() const {return fLearnedBranchesKey;}
    virtual EPrefillType GetLearnPrefill() const {return fPrefillType;}
+   Int_t                GetNClusterPrefetched() const {return fNClusterPrefetched;}
    Double_t             GetMissEfficiency() const;
    Double_t             GetMissEfficiencyRel() const;
    TTree               *GetTree() const {return fTree;}
    Bool_t               IsAutoCreated() const {return fAutoCreated;}
+   Bool_t               IsClusterPrefetch() const {return fClusterPrefetchEnabled;}
    virtual Bool_t       IsEnabled() const {return fEnabled;}
    virtual Bool_t       IsLearning() const {return fIsLearning;}
 
    virtual Bool_t       FillBuffer();
    virtual Int_t        LearnBranch(TBranch *b, Bool_t subgbranches = kFALSE);
    virtual void         LearnPrefill();
+   Int_t                LoadLearnedBranches(const char *filename, const char *key = "");
 
    virtual void         Print(Option_t *option="") const;
    virtual Int_t        ReadBuffer(char *buf, Long64_t pos, Int_t len);
@@ -164,12 +210,15 @@ public:
    virtual Int_t        ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len);
    virtual void         ResetCache();
    void                 ResetMissCache(); // Reset the miss cache.
+   Int_t                SaveLearnedBranches(const char *filename, const char *key = "") const;
    void                 SetAutoCreated(Bool_t val) {fAutoCreated = val;}
    virtual Int_t        SetBufferSize(Int_t buffersize);
+   void                 SetClusterPrefetch(Bool_t enable = kTRUE, Long64_t maxBytes = 0);
    virtual void         SetEntryRange(Long64_t emin,   Long64_t emax);
    virtual void         SetFile(TFile *file, TFile::ECacheAction action=TFile::kDisconnect);
    virtual void         SetLearnPrefill(EPrefillType type = kNoPrefill);
    static void          SetLearnEntries(Int_t n = 10);
+   void                 SetLearnedBranchesFile(const char *filename, const char *key = "");
    void                 SetOptimizeMisses(Bool_t opt);
    void                 StartLearningPhase();
    virtual void         StopLearningPhase();
@@ -22,6 +22,7 @@
 #include "TClass.h"
 #include "TBufferFile.h"
 #include "TClonesArray.h"
+#include "TEntryList.h"
 #include "TFile.h"
 #include "TLeaf.h"
 #include "TLeafB.h"
@@ -42,6 +43,7 @@
 #include "TTree.h"
 #include "TTreeCache.h"
 #include "TTreeCacheUnzip.h"
+#include "TVirtualCollectionProxy.h"
 #include "TVirtualMutex.h"
 #include "TVirtualPad.h"
 #include "TVirtualPerfStats.h"
@@ -1369,7 +1371,16 @@ Int_t TBranch::GetBasketAndFirst(TBasket *&basket, Long64_t &first,
             TTree::TClusterIterator clusterIterator = fTree->GetClusterIterator(entry);
             clusterIterator.Next();
             Int_t nextClusterEntry = clusterIterator.GetNextEntry();
+            // With an entry list, only the baskets holding selected entries are decompressed.
+            TEntryList *elist = fTree->GetEntryList();
+            if (elist && elist->GetLists())
+               elist = nullptr;
             for (Int_t i = fReadBasket + 1; i < fMaxBaskets && fBasketEntry[i] < nextClusterEntry; i++) {
+               if (elist) {
+                  Long64_t emax = (i < fWriteBasket) ? fBasketEntry[i + 1] - 1 : fEntryNumber - 1;
+                  if (!elist->ContainsRange(fBasketEntry[i], emax))
+                     continue;
+               }
                GetBasket(i);
             }
          }
@@ -1478,6 +1489,181 @@ Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
    return N;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Determine the in-memory type of the values read by the bulk IO with
+/// offsets (see GetBulkEntries(Long64_t, TBuffer&, TBuffer&)).
+///
+/// `isCollection` is set when this branch holds a std::vector of a
+/// fundamental type; otherwise the values are those of its single leaf, which
+/// may be fixed-size or have a leaf count.  Returns false if the branch can
+/// not be read in this mode.
+
+Bool_t TBranch::GetBulkValueType(EDataType &type, Bool_t &isCollection) const
+{
+   isCollection = kFALSE;
+   if (fNleaves != 1) return kFALSE;
+   TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+   // Strings are stored with their own length prefix.
+   if (leaf->InheritsFrom(TLeafC::Class())) return kFALSE;
+
+   TClass *cl = nullptr;
+   type = kOther_t;
+   // GetExpectedType only queries the branch, it may just initialize its streamer info.
+   if (const_cast<TBranch *>(this)->GetExpectedType(cl, type)) return kFALSE;
+   if (cl) {
+      // Only unsplit collections of fundamental types qualify; the members
+      // of a split collection of objects have their own (leaf count) branch.
+      TVirtualCollectionProxy *proxy = cl->GetCollectionProxy();
+      if (!proxy || proxy->GetCollectionType() != ROOT::kSTLvector || proxy->GetValueClass() ||
+          proxy->HasPointers() || fBranches.GetEntriesFast())
+         return kFALSE;
+      type = proxy->GetType();
+      // std::vector<bool> is not stored as an array of bool.
+      if (type == kBool_t) return kFALSE;
+      isCollection = kTRUE;
+   }
+
+   switch (type) {
+      case kChar_t: case kUChar_t: case kBool_t:
+      case kShort_t: case kUShort_t:
+      case kInt_t: case kUInt_t: case kFloat_t:
+      case kLong64_t: case kULong64_t: case kDouble_t:
+         return kTRUE;
+      default:
+         return kFALSE;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if this branch can be read with
+/// GetBulkEntries(Long64_t, TBuffer&, TBuffer&): a single leaf of a
+/// fundamental type, either fixed-size or with a leaf count (`pt[n]/F`, or
+/// an array member of a split collection of objects), or a std::vector of a
+/// fundamental type.
+
+Bool_t TBranch::SupportsBulkReadWithOffsets() const
+{
+   EDataType type;
+   Bool_t isCollection;
+   return GetBulkValueType(type, isCollection);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read all the entries of the basket starting at `entry` into the given
+/// buffers, supporting variable-length entries.
+///
+/// Returns -1 in case of a failure.  On success, returns the number of
+/// entries N read.  The values of all these entries are then stored
+/// contiguously, in host byte order, in
+///
+/// static_cast<T*>(user_buf.GetCurrent())
+///
+/// where T is the fundamental type of the values.  The values of entry `i`
+/// (counted from `entry`) are those between the indices `offsets[i]` and
+/// `offsets[i+1]` of that array, where
+///
+/// Int_t *offsets = reinterpret_cast<Int_t*>(offset_buf.GetCurrent());
+///
+/// holds N+1 elements.  For fixed-size leaves, the offsets are simply
+/// multiples of the leaf length.
+///
+/// As for GetBulkEntries(Long64_t, TBuffer&), `entry` must be the first entry
+/// of a basket; the bulk read is done in place, in the decompressed basket
+/// buffer.
+
+Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf, TBuffer &offset_buf)
+{
+   EDataType type;
+   Bool_t isCollection;
+   if (R__unlikely(!GetBulkValueType(type, isCollection))) return -1;
+
+   // Remember which entry we are reading.
+   fReadEntry = entry;
+
+   Bool_t enabled = !TestBit(kDoNotProcess);
+   if (R__unlikely(!enabled)) return -1;
+   TBasket *basket = nullptr;
+   Long64_t first;
+   Int_t result = GetBasketAndFirst(basket, first, &user_buf);
+   if (R__unlikely(result <= 0)) return -1;
+   // Only support reading from full clusters.
+   if (R__unlikely(entry != first)) return -1;
+
+   basket->PrepareBasket(entry);
+   TBuffer* buf = basket->GetBufferRef();
+
+   // Test for very old ROOT files.
+   if (R__unlikely(!buf)) {
+      Error("GetBulkEntries", "Failed to get a new buffer.\n");
+      return -1;
+   }
+   // Test for displacements, which aren't supported in fast mode.
+   if (R__unlikely(basket->GetDisplacement())) {
+      Error("GetBulkEntries", "Basket has displacement.\n");
+      return -1;
+   }
+
+   const Int_t bufbegin = basket->GetKeylen();
+   const Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
+   const Int_t valueSize = TDataType::GetDataType(type)->Size();
+
+   offset_buf.SetBufferOffset(0);
+   offset_buf.AutoExpand((N + 1) * sizeof(Int_t));
+   Int_t *offsets = reinterpret_cast<Int_t*>(offset_buf.Buffer());
+   Int_t *entryOffset = basket->GetEntryOffset();
+   char *data = buf->Buffer();
+
+   Int_t nvalues = 0;
+   Int_t dest = bufbegin;
+   for (Int_t i = 0; i < N; ++i) {
+      Int_t start, end;
+      if (entryOffset) {
+         start = entryOffset[i];
+         end = (i + 1 < N) ? entryOffset[i + 1] : basket->GetLast();
+      } else {
+         start = bufbegin + i * basket->GetNevBufSize();
+         end = start + basket->GetNevBufSize();
+      }
+
+      // The values of leaf count arrays and of the members of split
+      // collections are written without any per-entry header.
+      Int_t valueStart = start;
+      Int_t n = (end - valueStart) / valueSize;
+      if (isCollection) {
+         buf->SetBufferOffset(start);
+         UInt_t s, c;
+         buf->ReadVersion(&s, &c);
+         *buf >> n;
+         valueStart = buf->Length();
+      }
+      if (R__unlikely(n < 0 || valueStart + n * valueSize != end)) {
+         Error("GetBulkEntries", "Unexpected size of entry %lld in branch %s.\n", entry + i, GetName());
+         return -1;
+      }
+      // Compact the values of all the entries at the beginning of the basket.
+      if (dest != valueStart) memmove(data + dest, data + valueStart, n * valueSize);
+      offsets[i] = nvalues;
+      nvalues += n;
+      dest += n * valueSize;
+   }
+   offsets[N] = nvalues;
+
+   buf->SetBufferOffset(bufbegin);
+   if (valueSize > 1 && R__unlikely(!buf->ByteSwapBuffer(nvalues, type))) {
+      Error("GetBulkEntries", "Failed to byte-swap the values of branch %s.\n", GetName());
+      return -1;
+   }
+   user_buf.SetBufferOffset(bufbegin);
+
+   fCurrentBasket = nullptr;
+   fBaskets[fReadBasket] = nullptr;
+   R__ASSERT(fExtraBasket == nullptr && "fExtraBasket should have been set to nullptr by GetFreshBasket");
+   fExtraBasket = basket;
+   basket->DisownBuffer();
+
+   return N;
+}
+
 // TODO: Template this and the call above; only difference is the TLeaf function (ReadBasketFast vs
 // ReadBasketSerialized
 Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *count_buf)
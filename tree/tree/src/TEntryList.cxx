@@ -542,6 +542,36 @@ Int_t TEntryList::Contains(Long64_t entry, TTree *tree)
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if at least one of the entries in [entrymin, entrymax] belongs
+/// to the list.
+///
+/// As for Contains() without a tree, if this list has sub-lists, the current
+/// sub-list is checked and the entry numbers are local to its tree. This is
+/// used to skip reading the baskets holding no selected entries.
+
+Bool_t TEntryList::ContainsRange(Long64_t entrymin, Long64_t entrymax)
+{
+   if (fBlocks) {
+      //this entry list doesn't contain any sub-lists
+      if (entrymin < 0) entrymin = 0;
+      for (Long64_t nblock = entrymin/kBlockSize; nblock <= entrymax/kBlockSize && nblock < fNBlocks; nblock++) {
+         TEntryListBlock *block = (TEntryListBlock*)fBlocks->UncheckedAt(nblock);
+         Long64_t first = nblock*kBlockSize;
+         Int_t blockmin = (Int_t)TMath::Max(entrymin - first, 0LL);
+         Int_t blockmax = (Int_t)TMath::Min(entrymax - first, (Long64_t)kBlockSize - 1);
+         if (block->ContainsRange(blockmin, blockmax))
+            return kTRUE;
+      }
+      return kFALSE;
+   }
+   if (fLists) {
+      if (!fCurrent) fCurrent = (TEntryList*)fLists->First();
+      return fCurrent->ContainsRange(entrymin, entrymax);
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Called by TKey and others to automatically add us to a directory when we are read from a file.
 
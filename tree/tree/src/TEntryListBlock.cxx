@@ -46,6 +46,8 @@ End_Macro
 #include "TEntryListBlock.h"
 #include "TString.h"
 
+#include <algorithm>
+
 ClassImp(TEntryListBlock);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -236,6 +238,39 @@ Int_t TEntryListBlock::Contains(Int_t entry)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// True if the block contains at least one entry in [entrymin, entrymax]
+///
+/// Both limits are block-local entry numbers. Unlike calling Contains() for
+/// each entry, the cost does not depend on the size of the range in list mode.
+
+Bool_t TEntryListBlock::ContainsRange(Int_t entrymin, Int_t entrymax)
+{
+   if (entrymin < 0) entrymin = 0;
+   if (entrymax >= kBlockSize*16) entrymax = kBlockSize*16 - 1;
+   if (entrymin > entrymax)
+      return kFALSE;
+   if (!fIndices)
+      return !fPassing;
+   if (fType==0){
+      //bits
+      for (Int_t i = entrymin>>4; i <= (entrymax>>4); i++){
+         UShort_t word = fIndices[i];
+         if (i == (entrymin>>4)) word &= (UShort_t)(0xFFFF << (entrymin & 15));
+         if (i == (entrymax>>4)) word &= (UShort_t)(0xFFFF >> (15 - (entrymax & 15)));
+         if (word) return kTRUE;
+      }
+      return kFALSE;
+   }
+   //list, the indices are sorted
+   UShort_t *first = std::lower_bound(fIndices, fIndices + fNPassed, entrymin);
+   if (fPassing)
+      return first != fIndices + fNPassed && *first <= entrymax;
+   //the indices are the entries not in the list
+   UShort_t *last = std::upper_bound(first, fIndices + fNPassed, entrymax);
+   return (last - first) < (entrymax - entrymin + 1);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Merge with the other block
 /// Returns the resulting number of entries in the block
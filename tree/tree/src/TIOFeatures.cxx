@@ -35,10 +35,17 @@ using namespace ROOT;
  * it to a `TTree`.  All subsequently created branches (and their baskets) will be serialized
  * using those particular features.
  *
+ * A new `TTree` starts with all the features of `ROOT::EIOFeatures` enabled; this includes
+ * `kGenerateOffsetMap`, which stores the entry offsets of a basket as sizes (or not at all,
+ * when they can be computed from the count branch) and rebuilds them when the basket is read.
+ * Files written with a feature enabled can not be read by ROOT versions predating it; to
+ * write files readable by older versions, clear the features with `TTree::ClearIOFeatures`
+ * before creating the branches.
+ *
  * Example usage:
  * ~~~{.cpp}
  * ROOT::TIOFeatures features;
- * features.Set(ROOT::Experimental::EIOFeatures::kGenerateOffsetMap);
+ * features.Set(ROOT::EIOFeatures::kGenerateOffsetMap);
  * ttree_ref.SetIOFeatures(features);
  * ~~~
  *
@@ -329,7 +329,7 @@ const TLeaf::Counts_t *TLeaf::GetLeafCountValues(Long64_t start, Long64_t len)
      return nullptr;
 
    if (fLeafCountValues) {
-      if (fLeafCountValues->fStartEntry == start && len < (Long64_t)fLeafCountValues->fValues.size())
+      if (fLeafCountValues->fStartEntry == start && len <= (Long64_t)fLeafCountValues->fValues.size())
       {
          return &fLeafCountValues->fValues;
       }
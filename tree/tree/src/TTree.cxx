@@ -5500,7 +5500,24 @@ Int_t TTree::GetEntry(Long64_t entry, Int_t getall)
    };
 
 #ifdef R__USE_IMT
-   if (nbranches > 1 && ROOT::IsImplicitMTEnabled() && fIMTEnabled && !TTreeCacheUnzip::IsParallelUnzip()) {
+   const auto useIMT = nbranches > 1 && ROOT::IsImplicitMTEnabled() && fIMTEnabled && !TTreeCacheUnzip::IsParallelUnzip();
+   // In cluster mode, the branches are only read in parallel when entering a
+   // new cluster: this loads the baskets of the whole cluster, from which the
+   // following entries are streamed sequentially.
+   auto parallelEntry = useIMT;
+   if (useIMT && fIMTClusterRead) {
+      // A branch added since then was not loaded with the cluster.
+      if (fIMTClusterStart <= entry && entry < fIMTClusterEnd && fIMTClusterNBranches == nbranches) {
+         parallelEntry = false;
+      } else {
+         auto clusterIter = GetClusterIterator(entry);
+         fIMTClusterStart = clusterIter.Next();
+         fIMTClusterEnd = clusterIter.GetNextEntry();
+         fIMTClusterNBranches = nbranches;
+      }
+   }
+
+   if (parallelEntry) {
       if (fSortedBranches.empty())
          InitializeBranchLists(true);
 
@@ -5618,6 +5635,10 @@ void TTree::InitializeBranchLists(bool checkLeafCount)
 {
    Int_t nbranches = fBranches.GetEntriesFast();
 
+   // The next entry read in cluster mode loads its cluster again for all the branches.
+   fIMTClusterStart = -1;
+   fIMTClusterEnd = -1;
+
    // The special branch fBranchRef needs to be processed sequentially:
    // we add it once only.
    if (fBranchRef && fBranchRef != fSeqBranches[0]) {
@@ -8256,6 +8277,10 @@ void TTree::SetBranchStatus(const char* bname, Bool_t status, UInt_t* found)
       return;
    }
 
+   // Branches enabled now were not loaded with the current cluster.
+   fIMTClusterStart = -1;
+   fIMTClusterEnd = -1;
+
    TBranch *branch, *bcount, *bson;
    TLeaf *leaf, *leafcount;
 
@@ -8829,9 +8854,13 @@ void TTree::SetEstimate(Long64_t n /* = 1000000 */)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Provide the end-user with the ability to enable/disable various experimental
+/// Provide the end-user with the ability to enable/disable various
 /// IO features for this TTree.
 ///
+/// The given IO features are added to the ones of the tree; they apply to
+/// the branches created afterwards. By default, all the features of
+/// ROOT::EIOFeatures are enabled; see ClearIOFeatures to disable them.
+///
 /// Returns all the newly-set IO settings.
 
 ROOT::TIOFeatures TTree::SetIOFeatures(const ROOT::TIOFeatures &features)
@@ -8849,6 +8878,25 @@ ROOT::TIOFeatures TTree::SetIOFeatures(const ROOT::TIOFeatures &features)
    return newSettings;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Disable the given IO features for the branches of this TTree created
+/// afterwards. For instance, to write baskets readable by older ROOT versions:
+/// ~~~{.cpp}
+/// tree.ClearIOFeatures(tree.GetIOFeatures());
+/// ~~~
+///
+/// Returns all the newly-cleared IO settings.
+
+ROOT::TIOFeatures TTree::ClearIOFeatures(const ROOT::TIOFeatures &features)
+{
+   UChar_t curFeatures = fIOFeatures.GetFeatures();
+   UChar_t clearedFeatures = curFeatures & features.GetFeatures();
+   fIOFeatures.Set(static_cast<UChar_t>(curFeatures & ~clearedFeatures));
+
+   ROOT::TIOFeatures clearedSettings(clearedFeatures);
+   return clearedSettings;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set fFileNumber to number.
 /// fFileNumber is used by TTree::Fill to set the file name
@@ -8892,6 +8940,37 @@ void TTree::SetMakeClass(Int_t make)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the parallel reading of branches at cluster granularity.
+///
+/// By default, when implicit multi-threading is on, GetEntry launches one task
+/// per top-level branch for every entry. For trees with many branches and small
+/// events, the cost of scheduling these tasks dominates the actual reading.
+///
+/// When this mode is enabled, the tasks are only launched for the first entry
+/// read in a cluster: each of them reads and decompresses all the baskets of its
+/// branch (and sub-branches) for the whole cluster, and streams that entry. The
+/// following entries of the cluster are then streamed sequentially from the
+/// baskets already in memory, without any task overhead.
+///
+/// This mode enables the cluster prefetching of the tree (see SetClusterPrefetch),
+/// hence the baskets of a full cluster are kept in memory for all the branches
+/// being read. Disabling the mode restores the previous cluster prefetching
+/// setting.
+
+void TTree::SetIMTClusterRead(Bool_t enabled)
+{
+   if (enabled && !fIMTClusterRead) {
+      fIMTClusterPrevPrefetch = GetClusterPrefetch();
+      SetClusterPrefetch(kTRUE);
+   } else if (!enabled && fIMTClusterRead) {
+      SetClusterPrefetch(fIMTClusterPrevPrefetch);
+   }
+   fIMTClusterRead = enabled;
+   fIMTClusterStart = -1;
+   fIMTClusterEnd = -1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the maximum size in bytes of a Tree file (static function).
 /// The default size is 100000000000LL, ie 100 Gigabytes.
@@ -20,6 +20,8 @@
 - [General Description](#description)
 - [Changes in behaviour](#changesbehaviour)
 - [Self-optimization](#cachemisses)
+- [Sharing the learning phase across jobs](#learnedbranches)
+- [Overlapping reading and processing](#clusterprefetch)
 - [Examples of usage](#examples)
 - [Check performance and stats](#checkPerf)
 
@@ -125,6 +127,37 @@ Additionally, on the first miss of an event, we must iterate through all the
 This can be potentially a CPU-expensive operation compared to, e.g., the
 latency of a SSD.  This is why the miss cache is currently disabled by default.
 
+## <a name="learnedbranches"></a>Sharing the learning phase across jobs
+
+During the learning phase the branches are read without the cache. When many
+jobs run the same code over different files, they all pay this penalty to
+learn the very same set of branches. The outcome of the learning phase can be
+recorded in a small sidecar text file and preloaded by the following jobs,
+which then skip the learning phase and read through the cache from the first
+entry on:
+~~~ {.cpp}
+    T->SetCacheSize(cachesize);
+    T->GetReadCache(f)->SetLearnedBranchesFile("learned.txt", codeHash); //<<<
+~~~
+The file holds one record per tree name and key: the key is meant to
+identify the reading code, for example a hash of the analysis macro. The
+same can be achieved without modifying the code via the TTreeCache.Learned
+and TTreeCache.LearnedKey resources, or the environment variables
+`ROOT_TTREECACHE_LEARNED` and `ROOT_TTREECACHE_LEARNED_KEY`.
+Since cluster boundaries differ from file to file, only the read direction is
+recorded besides the branch names.
+
+## <a name="clusterprefetch"></a>Overlapping reading and processing
+
+By default the cache is filled when the reading crosses the boundary of the
+entries it holds, and the processing waits for the read to complete. With
+SetClusterPrefetch, as soon as the cache is filled the cluster(s) which follow
+are read into a second buffer by a background thread, within a configurable
+memory cap, while the current ones are processed. This is particularly
+effective with high latency storage. It also works with TTreeCacheUnzip,
+whose unzipping tasks then operate on the current clusters while the next
+ones are being read.
+
 ## <a name="examples"></a>Example usages of TTreeCache
 
 A few use cases are discussed below. A cache may be created with automatic
@@ -283,22 +316,139 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TList.h"
 #include "TBranch.h"
 #include "TBranchElement.h"
+#include "TEntryList.h"
 #include "TEventList.h"
 #include "TObjArray.h"
 #include "TObjString.h"
 #include "TRegexp.h"
+#include "TROOT.h"
 #include "TLeaf.h"
+#include "TLockFile.h"
 #include "TFriendElement.h"
 #include "TFile.h"
 #include "TMath.h"
 #include "TBranchCacheInfo.h"
 #include "TVirtualPerfStats.h"
+#include "TVirtualMutex.h"
+#include "ROOT/RMakeUnique.hxx"
 #include <limits.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <vector>
+
 Int_t TTreeCache::fgLearnEntries = 100;
 
 ClassImp(TTreeCache);
 
+namespace {
+
+/// The set of branches learned by one reading code for one tree, as recorded
+/// in a learned branches file (see TTreeCache::SetLearnedBranchesFile).
+struct LearnedBranches {
+   std::string fTreeName;
+   std::string fKey;
+   bool fReverseRead = false;
+   std::vector<std::string> fBranchNames;
+
+   bool Matches(const std::string &treeName, const std::string &key) const
+   {
+      return fTreeName == treeName && fKey == key;
+   }
+};
+
+/// Read all the records of a learned branches file. Each record consists of a
+/// header line `<tree name>\t<key>\t<forward|reverse>\t<number of branches>`
+/// followed by one line per branch name. Lines starting with '#' are comments.
+/// A missing or malformed file results in an empty (or truncated) list.
+std::vector<LearnedBranches> ReadLearnedBranches(const char *filename)
+{
+   std::vector<LearnedBranches> records;
+   std::ifstream in(filename);
+   std::string line;
+   while (std::getline(in, line)) {
+      if (line.empty() || line[0] == '#')
+         continue;
+      const auto t1 = line.find('\t');
+      const auto t2 = t1 == std::string::npos ? t1 : line.find('\t', t1 + 1);
+      const auto t3 = t2 == std::string::npos ? t2 : line.find('\t', t2 + 1);
+      if (t3 == std::string::npos)
+         break;
+      LearnedBranches record;
+      record.fTreeName = line.substr(0, t1);
+      record.fKey = line.substr(t1 + 1, t2 - t1 - 1);
+      record.fReverseRead = line.compare(t2 + 1, t3 - t2 - 1, "reverse") == 0;
+      const auto nbranches = std::strtoul(line.c_str() + t3 + 1, nullptr, 10);
+      for (auto i = 0u; i < nbranches && std::getline(in, line); ++i)
+         record.fBranchNames.emplace_back(line);
+      if (record.fBranchNames.size() != nbranches)
+         break;
+      records.emplace_back(std::move(record));
+   }
+   return records;
+}
+
+/// Write the records to a learned branches file. The content is first written
+/// to a temporary file which is then renamed, so that concurrent jobs sharing
+/// the same file never read a partially written one.
+Bool_t WriteLearnedBranches(const char *filename, const std::vector<LearnedBranches> &records)
+{
+   TString tmpname = TString::Format("%s.%d.tmp", filename, gSystem->GetPid());
+   {
+      std::ofstream out(tmpname.Data());
+      out << "# TTreeCache learned branches: <tree name>\t<key>\t<read direction>\t<number of branches>\n";
+      for (const auto &record : records) {
+         out << record.fTreeName << '\t' << record.fKey << '\t' << (record.fReverseRead ? "reverse" : "forward")
+             << '\t' << record.fBranchNames.size() << '\n';
+         for (const auto &name : record.fBranchNames)
+            out << name << '\n';
+      }
+      if (!out.good()) {
+         gSystem->Unlink(tmpname);
+         return kFALSE;
+      }
+   }
+   if (gSystem->Rename(tmpname, filename) != 0) {
+      gSystem->Unlink(tmpname);
+      return kFALSE;
+   }
+   return kTRUE;
+}
+
+/// Return the value of an environment variable or, if not set, of a resource.
+TString GetConfiguredString(const char *envVar, const char *resource)
+{
+   const char *value = gSystem->Getenv(envVar);
+   if (!value || !*value)
+      value = gEnv->GetValue(resource, "");
+   return value;
+}
+
+/// Return the entry list selecting the entries of the tree currently read
+/// through `owner`, or nullptr if there is none. For a chain, this is the
+/// sub-list of the current tree, matched by tree and file name as in
+/// TChain::SetEntryList: the trees of a chain often share their name.
+TEntryList *GetSelectingEntryList(TTree *owner)
+{
+   TEntryList *list = owner->GetEntryList();
+   if (!list)
+      return nullptr;
+   if (owner->IsA() != TChain::Class() && !list->GetLists())
+      return list;
+   TTree *tree = owner->GetTree();
+   TFile *file = tree ? tree->GetCurrentFile() : nullptr;
+   if (!list->GetLists() || !file)
+      return nullptr;
+   TEntryList *current = list->GetEntryList(tree->GetName(), file->GetName());
+   return current == list ? nullptr : current;
+}
+
+} // Anonymous namespace.
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor.
 
@@ -316,6 +466,13 @@ TTreeCache::TTreeCache(TTree *tree, Int_t buffersize)
    fEntryNext = fEntryMin + fgLearnEntries;
    Int_t nleaves = tree->GetListOfLeaves()->GetEntries();
    fBranches = new TObjArray(nleaves);
+
+   const auto learnedFile = GetConfiguredString("ROOT_TTREECACHE_LEARNED", "TTreeCache.Learned");
+   if (!learnedFile.IsNull())
+      SetLearnedBranchesFile(learnedFile, GetConfiguredString("ROOT_TTREECACHE_LEARNED_KEY", "TTreeCache.LearnedKey"));
+
+   if (GetConfiguredString("ROOT_TTREECACHE_CLUSTER_PREFETCH", "TTreeCache.ClusterPrefetch").Atoi() > 0)
+      SetClusterPrefetch(kTRUE);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -323,6 +480,8 @@ TTreeCache::TTreeCache(TTree *tree, Int_t buffersize)
 
 TTreeCache::~TTreeCache()
 {
+   ResetClusterPrefetch();
+
    // Informe the TFile that we have been deleted (in case
    // we are deleted explicitly by legacy user code).
    if (fFile) fFile->SetCacheRead(0, fTree);
@@ -331,6 +490,16 @@ TTreeCache::~TTreeCache()
    if (fBrNames) {fBrNames->Delete(); delete fBrNames; fBrNames=0;}
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the background read of the cluster prefetch, if any, before the
+/// file is closed.
+
+void TTreeCache::Close(Option_t *option /* = "" */)
+{
+   ResetClusterPrefetch();
+   TFileCacheRead::Close(option);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Add a branch discovered by actual usage to the list of branches to be stored
 /// in the cache this function is called by TBranch::GetBasket
@@ -352,7 +521,16 @@ Int_t TTreeCache::LearnBranch(TBranch *b, Bool_t subbranches /*= kFALSE*/)
    // the expected TTree), then prefill the cache.  (We expect that in future
    // release the Prefill-ing will be the default so we test for that inside the
    // LearnPrefill call).
-   if (!fLearnPrefilling && fNbranches == 0) LearnPrefill();
+   if (!fLearnPrefilling && fNbranches == 0) {
+      // Before learning the first branch, try to preload the branches a
+      // previous job learned: if they are found, the learning phase is over.
+      if (fLearnedBranchesLoadPending) {
+         fLearnedBranchesLoadPending = kFALSE;
+         if (LoadLearnedBranches(fLearnedBranchesFile, fLearnedBranchesKey) > 0)
+            return AddBranch(b, subbranches);
+      }
+      LearnPrefill();
+   }
 
    return AddBranch(b, subbranches);
 }
@@ -969,6 +1147,256 @@ Bool_t TTreeCache::CheckMissCache(char *buf, Long64_t pos, int len)
 /// End of methods for miss cache.
 ////////////////////////////////////////////////////////////////////////////////
 
+////////////////////////////////////////////////////////////////////////////////
+/// Methods for the cluster prefetch.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the prefetched data of the basket at position pos of length len,
+/// nullptr if it was not prefetched.
+
+const char *TTreeCache::ClusterPrefetch::Find(Long64_t pos, Int_t len) const
+{
+   auto it = std::lower_bound(fPos.begin(), fPos.end(), pos);
+   if (it == fPos.end() || *it != pos) return nullptr;
+   const auto i = it - fPos.begin();
+   if (fLen[i] < len) return nullptr;
+   return &fData[fIndex[i]];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the asynchronous prefetch of the clusters following the
+/// ones in the cache: as soon as the cache is filled, the baskets of the next
+/// cluster(s) are read by a background thread into a second buffer while the
+/// current ones are processed. When the reading crosses the cluster boundary,
+/// the cache is filled from the second buffer and only the baskets which were
+/// not prefetched are read synchronously. This overlaps the reading latency,
+/// e.g. of remote storage, with the processing of the entries.
+///
+/// maxBytes caps the size of the second buffer; by default (0) it is the same
+/// as the size of the cache, i.e. the memory used by the cache at most doubles.
+/// Clusters which do not fit are not prefetched.
+///
+/// The cluster prefetch is not used together with the prefetching mode of
+/// TFileCacheRead (see SetEnablePrefetching) nor with asynchronous reading,
+/// which already overlap the reading with the processing.
+/// The background thread reads through a second handle on the same file,
+/// opened at the first prefetch, so that it never shares the file descriptor,
+/// the offset or the counters of the TFile used by the main thread. The bytes
+/// it reads are accounted to the cache only. Enabling the cluster prefetch
+/// enables ROOT's thread safety (see ROOT::EnableThreadSafety).
+///
+/// The default can be set via the TTreeCache.ClusterPrefetch resource or the
+/// environment variable ROOT_TTREECACHE_CLUSTER_PREFETCH.
+
+void TTreeCache::SetClusterPrefetch(Bool_t enable /* = kTRUE */, Long64_t maxBytes /* = 0 */)
+{
+   if (!enable)
+      ResetClusterPrefetch();
+   else
+      ROOT::EnableThreadSafety();
+   fClusterPrefetchEnabled = enable;
+   fClusterPrefetchMaxBytes = maxBytes < 0 ? 0 : maxBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the background read of the cluster prefetch, if any. The
+/// prefetched data is discarded if the read failed.
+
+void TTreeCache::WaitClusterPrefetch()
+{
+   if (!fClusterPrefetch || !fClusterPrefetch->fDone.valid()) return;
+   if (fClusterPrefetch->fDone.get()) {
+      if (gDebug > 0)
+         Warning("WaitClusterPrefetch", "Prefetching entries %lld to %lld failed, they will be read synchronously",
+                 fClusterPrefetch->fEntryStart, fClusterPrefetch->fEntryEnd);
+      fClusterPrefetch.reset();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Discard the prefetched cluster(s), waiting for the background read to
+/// complete first, and close the separate handle on the file.
+
+void TTreeCache::ResetClusterPrefetch()
+{
+   WaitClusterPrefetch();
+   fClusterPrefetch.reset();
+   fClusterPrefetchFile.reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer the baskets registered in the cache from the file to the cache
+/// buffer right away, instead of at the first read. The baskets found in
+/// the cluster prefetch are copied, the others are read synchronously.
+/// Returns kFALSE in case of read failure, in which case the cache is emptied.
+
+Bool_t TTreeCache::TransferClusterPrefetch()
+{
+   WaitClusterPrefetch();
+   auto prefetch = std::move(fClusterPrefetch);
+
+   if (fNseek <= 0 || fIsTransferred) return kTRUE;
+   if (!fIsSorted) Sort();
+
+   std::vector<Long64_t> missPos;
+   std::vector<Int_t> missLen;
+   std::vector<Int_t> missLoc;
+   Int_t nfound = 0;
+   Long64_t prefetchedBytes = 0;
+   for (Int_t i = 0; i < fNseek; ++i) {
+      const char *data = prefetch ? prefetch->Find(fSeekSort[i], fSeekSortLen[i]) : nullptr;
+      if (data) {
+         memcpy(&fBuffer[fSeekPos[i]], data, fSeekSortLen[i]);
+         prefetchedBytes += fSeekSortLen[i];
+         ++nfound;
+      } else {
+         missPos.push_back(fSeekSort[i]);
+         missLen.push_back(fSeekSortLen[i]);
+         missLoc.push_back(i);
+      }
+   }
+   fNClusterPrefetched += nfound;
+   if (nfound > 0) {
+      fBytesRead += prefetchedBytes;
+      ++fReadCalls;
+   }
+
+   if (!missPos.empty()) {
+      Long64_t fileBytesRead0 = fFile->GetBytesRead();
+      Long64_t fileBytesReadExtra0 = fFile->GetBytesReadExtra();
+      Int_t fileReadCalls0 = fFile->GetReadCalls();
+      Bool_t failed = kFALSE;
+      if (nfound == 0) {
+         // Nothing was prefetched: read the merged blocks straight into the buffer.
+         failed = fFile->ReadBuffers(fBuffer, fPos, fLen, fNb);
+      } else {
+         std::vector<char> missData(std::accumulate(missLen.begin(), missLen.end(), Long64_t(0)));
+         failed = fFile->ReadBuffers(missData.data(), missPos.data(), missLen.data(), missPos.size());
+         Long64_t index = 0;
+         for (std::size_t i = 0; !failed && i < missLoc.size(); ++i) {
+            memcpy(&fBuffer[fSeekPos[missLoc[i]]], &missData[index], missLen[i]);
+            index += missLen[i];
+         }
+      }
+      fBytesRead += fFile->GetBytesRead() - fileBytesRead0;
+      fBytesReadExtra += fFile->GetBytesReadExtra() - fileBytesReadExtra0;
+      fReadCalls += fFile->GetReadCalls() - fileReadCalls0;
+      if (failed) {
+         TFileCacheRead::Prefetch(0, 0);
+         return kFALSE;
+      }
+   }
+
+   fIsTransferred = kTRUE;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start reading in a background thread the baskets of the cached branches
+/// for the cluster(s) following the entries in the cache, within the memory
+/// cap of the cluster prefetch.
+
+void TTreeCache::StartClusterPrefetch()
+{
+   if (fClusterPrefetch || fNbranches <= 0 || !fFile || fIsLearning || fReverseRead) return;
+   if (fEnablePrefetching || fAsyncReading || fEntryNext < 0 || fEntryNext >= fEntryMax) return;
+
+   TTree *tree = ((TBranch *)fBranches->UncheckedAt(0))->GetTree();
+   const Long64_t maxBytes = fClusterPrefetchMaxBytes > 0 ? fClusterPrefetchMaxBytes : fBufferSizeMin;
+
+   auto prefetch = std::make_unique<ClusterPrefetch>();
+   std::vector<std::pair<Long64_t, Int_t>> baskets;
+   Long64_t ntot = 0;
+   TTree::TClusterIterator clusterIter = tree->GetClusterIterator(fEntryNext);
+   Long64_t clusterStart = clusterIter();
+   while (clusterStart < fEntryMax) {
+      const Long64_t clusterEnd = std::min(clusterIter.GetNextEntry(), fEntryMax);
+      const auto nbaskets = baskets.size();
+      Long64_t clusterBytes = 0;
+      for (Int_t i = 0; i < fNbranches; ++i) {
+         TBranch *b = (TBranch *)fBranches->UncheckedAt(i);
+         if (b->GetDirectory() == 0 || b->TestBit(TBranch::kDoNotProcess)) continue;
+         if (b->GetDirectory()->GetFile() != fFile) continue;
+         Int_t nb = b->GetMaxBaskets();
+         Int_t *lbaskets = b->GetBasketBytes();
+         Long64_t *entries = b->GetBasketEntry();
+         if (!lbaskets || !entries) continue;
+         Int_t blistsize = b->GetListOfBaskets()->GetSize();
+         for (Int_t j = 0; j < nb; ++j) {
+            // The basket is outside of the cluster.
+            if (entries[j] >= clusterEnd) break;
+            if (j < nb - 1 && entries[j + 1] <= clusterStart) continue;
+            // The basket is already in memory or in the cache.
+            if (j < blistsize && b->GetListOfBaskets()->UncheckedAt(j)) continue;
+            Long64_t pos = b->GetBasketSeek(j);
+            Int_t len = lbaskets[j];
+            if (pos <= 0 || len <= 0) continue;
+            const auto loc = TMath::BinarySearch(fNseek, fSeekSort, pos);
+            if (fIsSorted && loc >= 0 && loc < fNseek && fSeekSort[loc] == pos) continue;
+            baskets.emplace_back(pos, len);
+            clusterBytes += len;
+         }
+      }
+      if (ntot + clusterBytes > maxBytes) {
+         // Only prefetch whole clusters.
+         baskets.resize(nbaskets);
+         break;
+      }
+      ntot += clusterBytes;
+      prefetch->fEntryEnd = clusterEnd;
+      clusterStart = clusterIter.Next();
+   }
+   if (baskets.empty()) return;
+
+   std::sort(baskets.begin(), baskets.end());
+   baskets.erase(std::unique(baskets.begin(), baskets.end(),
+                             [](const std::pair<Long64_t, Int_t> &a, const std::pair<Long64_t, Int_t> &b) {
+                                return a.first == b.first;
+                             }),
+                 baskets.end());
+   Long64_t index = 0;
+   for (const auto &basket : baskets) {
+      prefetch->fPos.push_back(basket.first);
+      prefetch->fLen.push_back(basket.second);
+      prefetch->fIndex.push_back(index);
+      index += basket.second;
+   }
+   prefetch->fData.resize(index);
+   prefetch->fEntryStart = fEntryNext;
+
+   if (gDebug > 5)
+      Info("StartClusterPrefetch", "Prefetching %zu baskets (%lld bytes) for entries %lld to %lld",
+           baskets.size(), index, prefetch->fEntryStart, prefetch->fEntryEnd);
+
+   if (!fClusterPrefetchFile) {
+      // The background thread must not use fFile, which the main thread keeps
+      // reading (e.g. other trees, keys or cache misses) without any lock.
+      TDirectory::TContext ctxt;
+      fClusterPrefetchFile.reset(TFile::Open(fFile->GetName(), "READ"));
+      if (!fClusterPrefetchFile || fClusterPrefetchFile->IsZombie()) {
+         Warning("StartClusterPrefetch", "Cannot open %s a second time, the cluster prefetch is disabled",
+                 fFile->GetName());
+         fClusterPrefetchFile.reset();
+         fClusterPrefetchEnabled = kFALSE;
+         return;
+      }
+      R__LOCKGUARD(gROOTMutex);
+      gROOT->GetListOfFiles()->Remove(fClusterPrefetchFile.get());
+   }
+
+   TFile *file = fClusterPrefetchFile.get();
+   ClusterPrefetch *p = prefetch.get();
+   prefetch->fDone = std::async(std::launch::async, [file, p]() {
+      return file->ReadBuffers(p->fData.data(), p->fPos.data(), p->fLen.data(), p->fPos.size());
+   });
+   fClusterPrefetch = std::move(prefetch);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// End of methods for the cluster prefetch.
+////////////////////////////////////////////////////////////////////////////////
+
 namespace {
 struct BasketRanges {
    struct Range {
@@ -1105,7 +1533,6 @@ struct BasketRanges {
 
 Bool_t TTreeCache::FillBuffer()
 {
-
    if (fNbranches <= 0) return kFALSE;
    TTree *tree = ((TBranch*)fBranches->UncheckedAt(0))->GetTree();
    Long64_t entry = tree->GetReadEntry();
@@ -1122,6 +1549,7 @@ Bool_t TTreeCache::FillBuffer()
             // the process of filling both prefetching buffers
             StopLearningPhase();
             fIsManual = kFALSE;
+            RecordLearnedBranches();
          }
       }
       if (fIsLearning) { //  Learning mode
@@ -1296,6 +1724,8 @@ Bool_t TTreeCache::FillBuffer()
          chainOffset = chain->GetTreeOffset()[t];
       }
    }
+   // Likewise for a TEntryList, whose entry numbers are local to the current tree.
+   TEntryList *entryList = elist ? nullptr : GetSelectingEntryList(fTree);
 
    //clear cache buffer
    Int_t ntotCurrentBuf = 0;
@@ -1351,7 +1781,7 @@ Bool_t TTreeCache::FillBuffer()
          kRewind = 3
       };
 
-      auto CollectBaskets = [this, elist, chainOffset, entry, clusterIterations, resetBranchInfo, perfStats,
+      auto CollectBaskets = [this, elist, entryList, chainOffset, entry, clusterIterations, resetBranchInfo, perfStats,
        &cursor, &lowestMaxEntry, &maxReadEntry, &minEntry,
        &reachedEnd, &skippedFirst, &oncePerBranch, &nDistinctLoad, &progress,
        &ranges, &memRanges, &reqRanges,
@@ -1472,11 +1902,13 @@ Bool_t TTreeCache::FillBuffer()
                if (cursor[i].fClusterStart == -1)
                   cursor[i].fClusterStart = j;
 
-               if (elist) {
+               if (elist || entryList) {
                   Long64_t emax = fEntryMax;
                   if (j<nb-1)
                      emax = entries[j + 1] - 1;
-                  if (!elist->ContainsRange(entries[j]+chainOffset,emax+chainOffset))
+                  if (elist && !elist->ContainsRange(entries[j]+chainOffset,emax+chainOffset))
+                     continue;
+                  if (entryList && !entryList->ContainsRange(entries[j], emax))
                      continue;
                }
 
@@ -1769,7 +2201,14 @@ Bool_t TTreeCache::FillBuffer()
          fFirstTime = kFALSE;
       }
    }
+   if (fIsLearning && !fIsManual && !fLearnPrefilling)
+      RecordLearnedBranches();
    fIsLearning = kFALSE;
+
+   if (fClusterPrefetchEnabled && !fLearnPrefilling && !fEnablePrefetching && !fAsyncReading) {
+      if (TransferClusterPrefetch())
+         StartClusterPrefetch();
+   }
    return kTRUE;
 }
 
@@ -1887,6 +2326,8 @@ void TTreeCache::Print(Option_t *option) const
    printf("Secondary Efficiency ..............: %f\n", GetMissEfficiency());
    printf("Secondary Efficiency Rel ..........: %f\n", GetMissEfficiencyRel());
    printf("Learn entries......................: %d\n",TTreeCache::GetLearnEntries());
+   if (fClusterPrefetchEnabled)
+      printf("Blocks from cluster prefetch.......: %d\n",fNClusterPrefetched);
    if ( opt.Contains("cachedbranches") ) {
       opt.ReplaceAll("cachedbranches","");
       printf("Cached branches....................:\n");
@@ -1900,6 +2341,54 @@ void TTreeCache::Print(Option_t *option) const
    TFileCacheRead::Print(opt);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Preload the set of branches recorded for this tree and the given key in a
+/// learned branches file (see SetLearnedBranchesFile) and stop the learning
+/// phase, so that the cache is filled with these branches at the next read.
+/// Recorded branches which do not exist in the current tree are ignored.
+/// Returns:
+///  - the number of branches added to the cache
+///  - 0 if the file does not contain a matching record
+///  - -1 on error
+
+Int_t TTreeCache::LoadLearnedBranches(const char *filename, const char *key /* = "" */)
+{
+   if (!fTree || !filename || !*filename) return -1;
+
+   const std::string treeName = fTree->GetName();
+   const auto records = ReadLearnedBranches(filename);
+   auto record = std::find_if(records.begin(), records.end(),
+                              [&](const LearnedBranches &r) { return r.Matches(treeName, key ? key : ""); });
+   if (record == records.end()) return 0;
+
+   Int_t nb = 0;
+   for (const auto &name : record->fBranchNames) {
+      TBranch *b = fTree->GetBranch(name.c_str());
+      if (b && AddBranch(b, kFALSE) == 0)
+         ++nb;
+   }
+   if (nb == 0) return 0;
+
+   if (gDebug > 0)
+      Info("LoadLearnedBranches", "Preloaded %d branches of tree %s from %s", nb, treeName.c_str(), filename);
+
+   // Behave as if the user had specified the branches: no learning phase and
+   // the cache is filled at the next read.
+   fReverseRead = record->fReverseRead;
+   fReadDirectionSet = kTRUE;
+   fIsLearning = kFALSE;
+   fIsManual = kTRUE;
+   fEntryCurrent = -1;
+   fEntryNext = -1;
+   fLearnedBranchesSavePending = kFALSE;
+
+   auto perfStats = GetTree()->GetPerfStats();
+   if (perfStats)
+      perfStats->UpdateBranchIndices(fBranches);
+
+   return nb;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Old method ReadBuffer before the addition of the prefetch mechanism.
 
@@ -2039,6 +2528,69 @@ void TTreeCache::ResetCache()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Record the branches just learned in the learned branches file, if one was
+/// requested and they have not been recorded yet.
+
+void TTreeCache::RecordLearnedBranches()
+{
+   if (!fLearnedBranchesSavePending) return;
+   fLearnedBranchesSavePending = kFALSE;
+   if (fNbranches > 0)
+      SaveLearnedBranches(fLearnedBranchesFile, fLearnedBranchesKey);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Record the branches currently in the cache, together with the read
+/// direction, in a learned branches file under the name of the tree and the
+/// given key. An existing record for the same tree and key is replaced, records
+/// for other trees or keys are kept. The file is left untouched if it already
+/// contains the very same record. Concurrent jobs are serialized through the
+/// lock file "<filename>.lock".
+/// Returns:
+///  - the number of branches recorded
+///  - -1 on error
+
+Int_t TTreeCache::SaveLearnedBranches(const char *filename, const char *key /* = "" */) const
+{
+   if (!fTree || !fBrNames || !filename || !*filename) return -1;
+
+   LearnedBranches record;
+   record.fTreeName = fTree->GetName();
+   record.fKey = key ? key : "";
+   record.fReverseRead = fReverseRead;
+   TIter next(fBrNames);
+   while (auto os = (TObjString *)next())
+      record.fBranchNames.emplace_back(os->GetName());
+
+   {
+      // Jobs sharing the file may record at the same time: serialize the
+      // read-merge-rename so that no record gets lost. A lock older than a
+      // minute is left over by a crashed job and is removed.
+      TLockFile lock(TString::Format("%s.lock", filename), 60);
+
+      auto records = ReadLearnedBranches(filename);
+      auto existing = std::find_if(records.begin(), records.end(),
+                                   [&](const LearnedBranches &r) { return r.Matches(record.fTreeName, record.fKey); });
+      if (existing != records.end()) {
+         if (existing->fReverseRead == record.fReverseRead && existing->fBranchNames == record.fBranchNames)
+            return record.fBranchNames.size();
+         *existing = record;
+      } else {
+         records.emplace_back(record);
+      }
+
+      if (!WriteLearnedBranches(filename, records)) {
+         Error("SaveLearnedBranches", "Could not write the learned branches to %s", filename);
+         return -1;
+      }
+   }
+   if (gDebug > 0)
+      Info("SaveLearnedBranches", "Recorded %zu branches of tree %s in %s", record.fBranchNames.size(),
+           record.fTreeName.c_str(), filename);
+   return record.fBranchNames.size();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Change the underlying buffer size of the cache.
 /// If the change of size means some cache content is lost, or if the buffer
@@ -2105,6 +2657,9 @@ void TTreeCache::SetEntryRange(Long64_t emin, Long64_t emax)
 
 void TTreeCache::SetFile(TFile *file, TFile::ECacheAction action)
 {
+   // The background read, if any, uses the current file.
+   ResetClusterPrefetch();
+
    // The infinite recursion is 'broken' by the fact that
    // TFile::SetCacheRead remove the entry from fCacheReadMap _before_
    // calling SetFile (and also by setting fFile to zero before the calling).
@@ -2140,6 +2695,30 @@ void TTreeCache::SetLearnPrefill(TTreeCache::EPrefillType type /* = kNoPrefill *
    fPrefillType = type;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Share the outcome of the learning phase across jobs through a small sidecar
+/// file. At the first read, the branches recorded in `filename` for this tree
+/// and `key` are preloaded and the learning phase is skipped (see
+/// LoadLearnedBranches). If no such record exists, the branches learned by
+/// this job are recorded at the end of the learning phase (see
+/// SaveLearnedBranches) for the benefit of the following jobs.
+///
+/// `key` should identify the reading code, e.g. a hash of the analysis
+/// macro, since a different code is likely to read a different set of
+/// branches. An empty filename disables the mechanism.
+/// The default can be set via the TTreeCache.Learned and TTreeCache.LearnedKey
+/// resources or the environment variables ROOT_TTREECACHE_LEARNED and
+/// ROOT_TTREECACHE_LEARNED_KEY.
+
+void TTreeCache::SetLearnedBranchesFile(const char *filename, const char *key /* = "" */)
+{
+   fLearnedBranchesFile = filename;
+   fLearnedBranchesKey = key;
+   const Bool_t enabled = !fLearnedBranchesFile.IsNull();
+   fLearnedBranchesLoadPending = enabled && fIsLearning && !fIsManual;
+   fLearnedBranchesSavePending = fLearnedBranchesLoadPending;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// The name should be enough to explain the method.
 /// The only additional comments is that the cache is cleaned before
@@ -2149,6 +2728,8 @@ void TTreeCache::StartLearningPhase()
 {
    fIsLearning = kTRUE;
    fIsManual = kFALSE;
+   fLearnedBranchesLoadPending = !fLearnedBranchesFile.IsNull();
+   fLearnedBranchesSavePending = fLearnedBranchesLoadPending;
    fNbranches  = 0;
    if (fBrNames) fBrNames->Delete();
    fIsTransferred = kFALSE;
@@ -344,6 +344,14 @@ Bool_t TTreeCacheUnzip::FillBuffer()
    ResetCache();
    fIsLearning = kFALSE;
 
+   // Transfer the baskets before the unzipping tasks are created, so that the
+   // next cluster(s) can be prefetched in the background meanwhile.
+   if (fClusterPrefetchEnabled && !fEnablePrefetching && !fAsyncReading) {
+      R__LOCKGUARD(fIOMutex.get());
+      if (TransferClusterPrefetch())
+         StartClusterPrefetch();
+   }
+
    return kTRUE;
 }
 
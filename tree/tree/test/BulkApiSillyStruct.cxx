@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <vector>
 
 #include "Bytes.h"
 #include "Rtypes.h"
@@ -8,6 +9,7 @@
 #include "TFile.h"
 #include "TObject.h"
 #include "TStopwatch.h"
+#include "TSystem.h"
 #include "TTree.h"
 #include "TTreeReader.h"
 #include "TTreeReaderValue.h"
@@ -149,3 +151,74 @@ TEST_F(BulkApiSillyStructTest, fastRead)
       }
    }
 }
+
+TEST(BulkApiSillyStructVector, offsetRead)
+{
+   const char *fileName = "BulkApiSillyStructVector.root";
+   const Long64_t clusterSize = 1000;
+   const Long64_t eventCount = 10000;
+   {
+      TFile hfile(fileName, "RECREATE");
+      TTree tree("T", "A ROOT tree of a split std::vector<SillyStruct> branch.");
+      tree.SetBit(TTree::kOnlyFlushAtCluster);
+      tree.SetAutoFlush(clusterSize);
+      std::vector<SillyStruct> v;
+      tree.Branch("v", &v, 32000, 99);
+      Int_t counter = 0;
+      for (Long64_t ev = 0; ev < eventCount; ev++) {
+         v.clear();
+         for (Int_t idx = 0; idx < (ev % 7); idx++) {
+            SillyStruct ss;
+            ss.f = counter;
+            ss.i = counter;
+            ss.d = counter + 0.5;
+            v.push_back(ss);
+            counter++;
+         }
+         tree.Fill();
+      }
+      hfile.Write();
+   }
+
+   TFile hfile(fileName);
+   TTree *tree = nullptr;
+   hfile.GetObject("T", tree);
+   ASSERT_TRUE(tree);
+   // The members of the split collection are leaf count arrays, the collection itself is not bulk-readable.
+   auto branchFloat = tree->GetBranch("v.f");
+   auto branchDouble = tree->GetBranch("v.d");
+   ASSERT_TRUE(branchFloat);
+   ASSERT_TRUE(branchDouble);
+   ASSERT_TRUE(branchFloat->GetBulkRead().SupportsBulkReadWithOffsets());
+   ASSERT_TRUE(branchDouble->GetBulkRead().SupportsBulkReadWithOffsets());
+   ASSERT_FALSE(tree->GetBranch("v")->GetBulkRead().SupportsBulkReadWithOffsets());
+
+   TBufferFile floatBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile floatOffsetBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile doubleBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile doubleOffsetBuf(TBuffer::kWrite, 32*1024);
+   Int_t expected = 0;
+   Long64_t evt_idx = 0;
+   while (evt_idx < eventCount) {
+      auto count = branchFloat->GetBulkRead().GetBulkEntries(evt_idx, floatBuf, floatOffsetBuf);
+      ASSERT_GT(count, 0);
+      ASSERT_EQ(count, branchDouble->GetBulkRead().GetBulkEntries(evt_idx, doubleBuf, doubleOffsetBuf));
+      float *float_buf = reinterpret_cast<float*>(floatBuf.GetCurrent());
+      double *double_buf = reinterpret_cast<double*>(doubleBuf.GetCurrent());
+      int *float_offsets = reinterpret_cast<int*>(floatOffsetBuf.GetCurrent());
+      int *double_offsets = reinterpret_cast<int*>(doubleOffsetBuf.GetCurrent());
+      ASSERT_EQ(float_offsets[0], 0);
+      for (Int_t idx = 0; idx < count; idx++) {
+         ASSERT_EQ(float_offsets[idx + 1] - float_offsets[idx], (evt_idx + idx) % 7);
+         ASSERT_EQ(float_offsets[idx + 1], double_offsets[idx + 1]);
+         for (int entry_idx = float_offsets[idx]; entry_idx < float_offsets[idx + 1]; entry_idx++) {
+            ASSERT_EQ(float_buf[entry_idx], float(expected));
+            ASSERT_EQ(double_buf[entry_idx], expected + 0.5);
+            expected++;
+         }
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, eventCount);
+   gSystem->Unlink(fileName);
+}
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <vector>
 
 #include "Bytes.h"
 #include "TBranch.h"
@@ -6,6 +7,7 @@
 #include "TFile.h"
 #include "TTree.h"
 #include "TStopwatch.h"
+#include "TSystem.h"
 #include "TTreeReader.h"
 #include "TTreeReaderValue.h"
 #include "TTreeReaderArray.h"
@@ -235,3 +237,125 @@ TEST_F(BulkApiVariableTest, serializedRead)
    printf("Bulk Serialized API: Successful read of all events.\n");
    printf("Bulk Serialized API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
 }
+
+TEST_F(BulkApiVariableTest, offsetRead)
+{
+   auto hfile = TFile::Open(fFileName.c_str());
+   printf("Starting read of file %s.\n", fFileName.c_str());
+   TStopwatch sw;
+
+   printf("Using bulk APIs with offsets.\n");
+
+   auto tree = dynamic_cast<TTree*>(hfile->Get("T"));
+   ASSERT_TRUE(tree);
+   auto branchFloat = tree->GetBranch("f");
+   ASSERT_TRUE(branchFloat);
+   auto branchDouble = tree->GetBranch("d");
+   ASSERT_TRUE(branchDouble);
+   ASSERT_TRUE(branchFloat->GetBulkRead().SupportsBulkReadWithOffsets());
+   ASSERT_TRUE(branchDouble->GetBulkRead().SupportsBulkReadWithOffsets());
+
+   float idx_f = 0;
+   double idx_d = 2;
+   Long64_t evt_idx = 0;
+   Long64_t events = fEventCount;
+   Int_t cluster_size = std::min(fClusterSize, fEventCount);
+   TBufferFile floatBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile floatOffsetBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile doubleBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile doubleOffsetBuf(TBuffer::kWrite, 32*1024);
+
+   sw.Start();
+   while (events) {
+      auto count = branchFloat->GetBulkRead().GetBulkEntries(evt_idx, floatBuf, floatOffsetBuf);
+      ASSERT_EQ(count, cluster_size);
+      count = branchDouble->GetBulkRead().GetBulkEntries(evt_idx, doubleBuf, doubleOffsetBuf);
+      ASSERT_EQ(count, cluster_size);
+
+      if (events > count) {
+         events -= count;
+      } else {
+         events = 0;
+      }
+      float *float_buf = reinterpret_cast<float*>(floatBuf.GetCurrent());
+      double *double_buf = reinterpret_cast<double*>(doubleBuf.GetCurrent());
+      int *float_offsets = reinterpret_cast<int*>(floatOffsetBuf.GetCurrent());
+      int *double_offsets = reinterpret_cast<int*>(doubleOffsetBuf.GetCurrent());
+      ASSERT_EQ(float_offsets[0], 0);
+      for (Int_t idx = 0; idx < count; idx++) {
+         int entry_count = float_offsets[idx + 1] - float_offsets[idx];
+         ASSERT_EQ(entry_count, (evt_idx + idx + 1) % 10);
+         ASSERT_EQ(float_offsets[idx + 1], double_offsets[idx + 1]);
+         for (int entry_idx = float_offsets[idx]; entry_idx < float_offsets[idx + 1]; entry_idx++) {
+            if (R__unlikely(float_buf[entry_idx] != idx_f)) {
+               printf("Incorrect value on float branch: %f, expected %f (event %lld)\n", float_buf[entry_idx], idx_f, evt_idx + idx);
+               ASSERT_TRUE(false);
+            }
+            idx_f++;
+            if (R__unlikely(double_buf[entry_idx] != idx_d)) {
+               printf("Incorrect value on double branch: %f, expected %f (event %lld)\n", double_buf[entry_idx], idx_d, evt_idx + idx);
+               ASSERT_TRUE(false);
+            }
+            idx_d++;
+         }
+      }
+      evt_idx += count;
+   }
+   events = fEventCount;
+   ASSERT_EQ(evt_idx, events);
+
+   sw.Stop();
+   printf("Bulk API with offsets: Successful read of all events.\n");
+   printf("Bulk API with offsets: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
+}
+
+TEST(BulkApiVector, offsetRead)
+{
+   const char *fileName = "BulkApiTestVector.root";
+   const Long64_t clusterSize = 1000;
+   const Long64_t eventCount = 10000;
+   {
+      TFile hfile(fileName, "RECREATE");
+      TTree tree("T", "A ROOT tree of a std::vector<float> branch.");
+      tree.SetBit(TTree::kOnlyFlushAtCluster);
+      tree.SetAutoFlush(clusterSize);
+      std::vector<float> v;
+      tree.Branch("v", &v);
+      float counter = 0;
+      for (Long64_t ev = 0; ev < eventCount; ev++) {
+         v.clear();
+         for (Int_t idx = 0; idx < (ev % 7); idx++)
+            v.push_back(counter++);
+         tree.Fill();
+      }
+      hfile.Write();
+   }
+
+   TFile hfile(fileName);
+   TTree *tree = nullptr;
+   hfile.GetObject("T", tree);
+   ASSERT_TRUE(tree);
+   auto branch = tree->GetBranch("v");
+   ASSERT_TRUE(branch);
+   ASSERT_FALSE(branch->GetBulkRead().SupportsBulkRead());
+   ASSERT_TRUE(branch->GetBulkRead().SupportsBulkReadWithOffsets());
+
+   TBufferFile valueBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile offsetBuf(TBuffer::kWrite, 32*1024);
+   float expected = 0;
+   Long64_t evt_idx = 0;
+   while (evt_idx < eventCount) {
+      auto count = branch->GetBulkRead().GetBulkEntries(evt_idx, valueBuf, offsetBuf);
+      ASSERT_GT(count, 0);
+      float *values = reinterpret_cast<float*>(valueBuf.GetCurrent());
+      int *offsets = reinterpret_cast<int*>(offsetBuf.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++) {
+         ASSERT_EQ(offsets[idx + 1] - offsets[idx], (evt_idx + idx) % 7);
+         for (int entry_idx = offsets[idx]; entry_idx < offsets[idx + 1]; entry_idx++)
+            ASSERT_EQ(values[entry_idx], expected++);
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, eventCount);
+   gSystem->Unlink(fileName);
+}
@@ -1,12 +1,48 @@
+#include "TError.h"
 #include "TFile.h"
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TTree.h"
 
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #ifdef R__USE_IMT
 
+namespace {
+std::atomic<int> gNBranchTasks{0};
+ErrorHandlerFunc_t gPrevErrorHandler = nullptr;
+
+// Counts the branch tasks launched by TTree::GetEntry, as reported with gDebug > 0
+void CountBranchTasks(int level, Bool_t abort, const char *location, const char *msg)
+{
+   if (level == kInfo) {
+      if (std::strstr(msg, "[IMT] Running task for branch"))
+         ++gNBranchTasks;
+      return;
+   }
+   gPrevErrorHandler(level, abort, location, msg);
+}
+
+// Read the given entries with gDebug > 0 and return the number of branch tasks that were launched
+int ReadCountingTasks(TTree &t, Long64_t first, Long64_t last)
+{
+   gNBranchTasks = 0;
+   gPrevErrorHandler = SetErrorHandler(CountBranchTasks);
+   const auto prevDebug = gDebug;
+   gDebug = 1;
+   for (auto entry = first; entry < last; ++entry)
+      t.GetEntry(entry);
+   gDebug = prevDebug;
+   SetErrorHandler(gPrevErrorHandler);
+   return gNBranchTasks;
+}
+} // namespace
+
 // ROOT-9668
 TEST(TTreeImplicitMT, flushBaskets)
 {
@@ -28,4 +64,68 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, clusterRead)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "clusterReadMT.root";
+   const auto nBranches = 20;
+   const auto nEntries = 1000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(100);
+      std::vector<int> values(nBranches);
+      for (auto i = 0; i < nBranches; ++i)
+         t.Branch(("branch" + std::to_string(i)).c_str(), &values[i]);
+      for (auto entry = 0; entry < nEntries; ++entry) {
+         for (auto i = 0; i < nBranches; ++i)
+            values[i] = entry * nBranches + i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(ofileName);
+   TTree *t = nullptr;
+   f.GetObject("t", t);
+   ASSERT_TRUE(t);
+   EXPECT_FALSE(t->GetClusterPrefetch());
+   t->SetIMTClusterRead();
+   EXPECT_TRUE(t->GetIMTClusterRead());
+   EXPECT_TRUE(t->GetClusterPrefetch());
+   std::vector<int> values(nBranches);
+   for (auto i = 0; i < nBranches; ++i)
+      t->SetBranchAddress(("branch" + std::to_string(i)).c_str(), &values[i]);
+   for (auto entry = 0; entry < nEntries; ++entry) {
+      EXPECT_GT(t->GetEntry(entry), 0);
+      for (auto i = 0; i < nBranches; ++i)
+         EXPECT_EQ(entry * nBranches + i, values[i]);
+   }
+
+   // One task per branch is launched for each of the 10 clusters, instead of for each entry
+   EXPECT_EQ(nEntries / 100 * nBranches, ReadCountingTasks(*t, 0, nEntries));
+
+   // Disabling the mode restores the previous cluster prefetch setting and the per-entry tasks
+   t->SetIMTClusterRead(kFALSE);
+   EXPECT_FALSE(t->GetIMTClusterRead());
+   EXPECT_FALSE(t->GetClusterPrefetch());
+   EXPECT_EQ(100 * nBranches, ReadCountingTasks(*t, 0, 100));
+   t->SetClusterPrefetch(kTRUE);
+   t->SetIMTClusterRead();
+   t->SetIMTClusterRead(kFALSE);
+   EXPECT_TRUE(t->GetClusterPrefetch());
+   t->SetIMTClusterRead();
+
+   // The branch status and the thread pool may change in the middle of a cluster.
+   t->SetBranchStatus("branch0", false);
+   EXPECT_GT(t->GetEntry(10), 0);
+   ROOT::DisableImplicitMT();
+   ROOT::EnableImplicitMT(2);
+   t->SetBranchStatus("branch0", true);
+   EXPECT_GT(t->GetEntry(11), 0);
+   EXPECT_EQ(11 * nBranches, values[0]);
+   f.Close();
+   gSystem->Unlink(ofileName);
+}
+
 #endif // R__USE_IMT
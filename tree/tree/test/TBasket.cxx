@@ -150,6 +150,8 @@ TEST(TBasket, TestUnsupportedIO)
 
    TTree t1("t1", "Simple tree for testing.");
    ASSERT_FALSE(t1.IsZombie());
+   // Start from a basket without any IO bits set.
+   t1.ClearIOFeatures(t1.GetIOFeatures());
    Int_t idx;
    t1.Branch("idx", &idx, "idx/I");
    for (idx = 0; idx < gSampleEvents; idx++) {
@@ -212,6 +214,8 @@ TEST(TBasket, TestVarLengthArrays)
 
    TTree t1("t1", "Simple tree for testing.");
    ASSERT_FALSE(t1.IsZombie());
+   // Serialize the entry offsets as done by older ROOT versions.
+   t1.ClearIOFeatures(t1.GetIOFeatures());
 
    Int_t idx, idx2;
    Int_t sample[10];
@@ -296,6 +300,8 @@ TEST(TBasket, TestSettingIOBits)
    ASSERT_FALSE(t1.IsZombie());
    TTree t2("t2", "Simple tree for testing serialized entry offset.");
    ASSERT_FALSE(t2.IsZombie());
+   // Generated offsets are the default; explicitly disable them for t2.
+   t2.ClearIOFeatures(t2.GetIOFeatures());
 
    ROOT::TIOFeatures settings;
    ASSERT_EQ(GetFeatures(settings), 0);
@@ -0,0 +1,175 @@
+#include "TBranch.h"
+#include "TChain.h"
+#include "TEntryList.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+// Write the tree "t" with two int branches in clusters of 1000 entries. The baskets are small: the first cluster
+// spans several of them, the following ones are optimized to one basket per cluster.
+void WriteSparseTree(const std::string &fileName, Long64_t nEntries)
+{
+   TFile f(fileName.c_str(), "RECREATE");
+   TTree t("t", "t");
+   t.SetAutoFlush(1000);
+   Int_t x = 0, y = 0;
+   t.Branch("x", &x, "x/I", 1000);
+   t.Branch("y", &y, "y/I", 1000);
+   for (Long64_t entry = 0; entry < nEntries; ++entry) {
+      x = entry;
+      y = 2 * entry;
+      t.Fill();
+   }
+   t.Write();
+}
+
+// Return the bytes on file of the baskets that hold at least one of the given entries, and in `totalBytes` the bytes
+// of all the baskets
+Long64_t GetSelectedBasketBytes(const std::string &fileName, const std::vector<Long64_t> &entries, Long64_t &totalBytes)
+{
+   TFile f(fileName.c_str());
+   TTree *t = nullptr;
+   f.GetObject("t", t);
+   Long64_t selectedBytes = 0;
+   totalBytes = 0;
+   for (auto name : {"x", "y"}) {
+      auto branch = t->GetBranch(name);
+      const Int_t nBaskets = branch->GetWriteBasket();
+      for (Int_t i = 0; i < nBaskets; ++i) {
+         const Long64_t first = branch->GetBasketEntry()[i];
+         const Long64_t last = i + 1 < nBaskets ? branch->GetBasketEntry()[i + 1] : branch->GetEntries();
+         totalBytes += branch->GetBasketBytes()[i];
+         if (std::any_of(entries.begin(), entries.end(), [&](Long64_t e) { return first <= e && e < last; }))
+            selectedBytes += branch->GetBasketBytes()[i];
+      }
+   }
+   return selectedBytes;
+}
+
+// Read the entries selected by the entry list of `t` and return the bytes read from the files to get them
+Long64_t ReadSelectedEntries(TTree &t)
+{
+   Long64_t bytesRead = 0;
+   for (Long64_t i = 0; i < t.GetEntryList()->GetN(); ++i) {
+      const auto entry = t.GetEntryNumber(i);
+      t.LoadTree(entry); // the bytes read to open the files of a chain are not counted
+      const auto before = TFile::GetFileBytesRead();
+      EXPECT_GT(t.GetEntry(entry), 0);
+      bytesRead += TFile::GetFileBytesRead() - before;
+   }
+   return bytesRead;
+}
+} // namespace
+
+TEST(TEntryList, ContainsRange)
+{
+   TEntryList list;
+   for (Long64_t entry : {10LL, 11LL, 500LL, 70000LL, 200000LL})
+      list.Enter(entry);
+
+   for (int optimized = 0; optimized < 2; ++optimized) {
+      // The second pass checks the list representation of the blocks.
+      if (optimized)
+         list.OptimizeStorage();
+      EXPECT_TRUE(list.ContainsRange(0, 10));
+      EXPECT_TRUE(list.ContainsRange(11, 11));
+      EXPECT_FALSE(list.ContainsRange(12, 499));
+      EXPECT_TRUE(list.ContainsRange(12, 500));
+      EXPECT_FALSE(list.ContainsRange(501, 69999));
+      EXPECT_TRUE(list.ContainsRange(63000, 70000));
+      EXPECT_FALSE(list.ContainsRange(70001, 199999));
+      EXPECT_TRUE(list.ContainsRange(100000, 300000));
+      EXPECT_FALSE(list.ContainsRange(200001, 300000));
+   }
+
+   // A block mostly made of selected entries stores the entries not in the list.
+   TEntryList dense;
+   for (Long64_t entry = 0; entry < 64000; ++entry)
+      if (entry < 100 || entry > 200)
+         dense.Enter(entry);
+   dense.OptimizeStorage();
+   EXPECT_TRUE(dense.ContainsRange(50, 150));
+   EXPECT_FALSE(dense.ContainsRange(100, 200));
+   EXPECT_TRUE(dense.ContainsRange(150, 250));
+}
+
+TEST(TEntryList, SparseTreeReadSkipsBaskets)
+{
+   const std::string fileName = "TEntryListSparseTree.root";
+   const std::vector<Long64_t> entries{10, 900, 7500};
+   WriteSparseTree(fileName, 10000);
+   Long64_t totalBytes = 0;
+   const auto selectedBytes = GetSelectedBasketBytes(fileName, entries, totalBytes);
+   ASSERT_LT(2 * selectedBytes, totalBytes);
+
+   for (auto useCache : {true, false}) {
+      TFile f(fileName.c_str());
+      TTree *t = nullptr;
+      f.GetObject("t", t);
+      ASSERT_TRUE(t);
+      TEntryList list;
+      for (auto entry : entries)
+         list.Enter(entry);
+      t->SetEntryList(&list);
+      if (useCache) {
+         // TTreeCache::FillBuffer only fetches the baskets holding selected entries
+         t->SetCacheSize(10000000);
+         t->AddBranchToCache("*", kTRUE);
+         t->StopCacheLearningPhase();
+      } else {
+         // The cluster prefetch of TBranch::GetBasketAndFirst only reads the baskets holding selected entries
+         t->SetCacheSize(0);
+         t->SetClusterPrefetch(kTRUE);
+      }
+      const auto bytesRead = ReadSelectedEntries(*t);
+      EXPECT_GT(bytesRead, 0);
+      EXPECT_LE(bytesRead, selectedBytes) << (useCache ? "with" : "without") << " TTreeCache";
+      t->SetEntryList(nullptr);
+   }
+   gSystem->Unlink(fileName.c_str());
+}
+
+TEST(TEntryList, SparseChainReadSkipsBaskets)
+{
+   const std::vector<std::string> fileNames{"TEntryListSparseChain0.root", "TEntryListSparseChain1.root"};
+   const Long64_t nEntries = 10000;
+   // The same local entries in both files: the sub-lists only differ by their file name
+   const std::vector<Long64_t> entries{10, 900, 7500};
+   Long64_t selectedBytes = 0;
+   Long64_t totalBytes = 0;
+   for (const auto &fileName : fileNames) {
+      WriteSparseTree(fileName, nEntries);
+      Long64_t fileBytes = 0;
+      selectedBytes += GetSelectedBasketBytes(fileName, entries, fileBytes);
+      totalBytes += fileBytes;
+   }
+   ASSERT_LT(2 * selectedBytes, totalBytes);
+
+   TChain chain("t");
+   for (const auto &fileName : fileNames)
+      chain.Add(fileName.c_str());
+   TEntryList list;
+   for (auto i = 0u; i < fileNames.size(); ++i)
+      for (auto entry : entries)
+         list.Enter(i * nEntries + entry, &chain);
+   ASSERT_TRUE(list.GetLists());
+   ASSERT_EQ(fileNames.size(), static_cast<std::size_t>(list.GetLists()->GetEntries()));
+   chain.SetEntryList(&list);
+   chain.SetCacheSize(10000000);
+   chain.AddBranchToCache("*", kTRUE);
+   chain.StopCacheLearningPhase();
+
+   const auto bytesRead = ReadSelectedEntries(chain);
+   EXPECT_GT(bytesRead, 0);
+   EXPECT_LE(bytesRead, selectedBytes);
+   chain.SetEntryList(nullptr);
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+}
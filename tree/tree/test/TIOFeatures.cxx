@@ -1,5 +1,6 @@
 
 #include "ROOT/TIOFeatures.hxx"
+#include "TTree.h"
 
 #include "gtest/gtest.h"
 
@@ -26,9 +27,33 @@ TEST(TIOFeatures, IOBits)
 
    // These are currently defined but empty.
    EXPECT_EQ(static_cast<Int_t>(ROOT::Experimental::EIOUnsupportedFeatures::kUnsupported), 0);
-   EXPECT_EQ(static_cast<Int_t>(ROOT::EIOFeatures::kSupported), 0);
+   EXPECT_EQ(static_cast<Int_t>(ROOT::Experimental::EIOFeatures::kSupported), 0);
 
-   // Currently, the experimental features are identical to TBasket::EIOBits
-   EXPECT_EQ(static_cast<Int_t>(ROOT::Experimental::EIOFeatures::kSupported),
+   // Currently, the supported features are identical to TBasket::EIOBits
+   EXPECT_EQ(static_cast<Int_t>(ROOT::EIOFeatures::kSupported),
              static_cast<Int_t>(TBasket::EIOBits::kSupported));
+
+   // The former experimental name still refers to the same feature.
+   EXPECT_EQ(static_cast<Int_t>(ROOT::Experimental::EIOFeatures::kGenerateOffsetMap),
+             static_cast<Int_t>(ROOT::EIOFeatures::kGenerateOffsetMap));
+}
+
+TEST(TIOFeatures, TreeDefaults)
+{
+   TTree t("t", "t");
+   EXPECT_TRUE(t.GetIOFeatures().Test(ROOT::EIOFeatures::kGenerateOffsetMap));
+
+   // SetIOFeatures only adds features, ClearIOFeatures removes them
+   t.SetIOFeatures(ROOT::TIOFeatures());
+   EXPECT_TRUE(t.GetIOFeatures().Test(ROOT::EIOFeatures::kGenerateOffsetMap));
+
+   ROOT::TIOFeatures features;
+   features.Set(ROOT::EIOFeatures::kGenerateOffsetMap);
+   EXPECT_TRUE(t.ClearIOFeatures(features).Test(ROOT::EIOFeatures::kGenerateOffsetMap));
+   EXPECT_FALSE(t.GetIOFeatures().Test(ROOT::EIOFeatures::kGenerateOffsetMap));
+   EXPECT_FALSE(t.ClearIOFeatures(features).Test(ROOT::EIOFeatures::kGenerateOffsetMap));
+
+   EXPECT_TRUE(t.SetIOFeatures(features).Test(ROOT::EIOFeatures::kGenerateOffsetMap));
+   EXPECT_TRUE(t.GetIOFeatures().Test(ROOT::EIOFeatures::kGenerateOffsetMap));
+   EXPECT_FALSE(t.SetIOFeatures(features).Test(ROOT::EIOFeatures::kGenerateOffsetMap));
 }
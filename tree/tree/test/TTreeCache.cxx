@@ -0,0 +1,163 @@
+#include "TFile.h"
+#include "TTree.h"
+#include "TBranch.h"
+#include "TTreeCache.h"
+#include "TObjArray.h"
+#include "TSystem.h"
+
+#include "gtest/gtest.h"
+
+#include <fstream>
+#include <string>
+
+class TTreeCacheLearnedTest : public ::testing::Test {
+protected:
+   static constexpr const char *fFileName = "TTreeCacheLearnedTest.root";
+   static constexpr const char *fLearnedName = "TTreeCacheLearnedTest.txt";
+
+   void SetUp() override
+   {
+      TFile file(fFileName, "RECREATE");
+      TTree tree("tree", "tree");
+      int a = 0, b = 0, c = 0;
+      tree.Branch("a", &a);
+      tree.Branch("b", &b);
+      tree.Branch("c", &c);
+      tree.SetAutoFlush(100);
+      for (int i = 0; i < 1000; ++i) {
+         a = i;
+         b = 2 * i;
+         c = 3 * i;
+         tree.Fill();
+      }
+      tree.Write();
+      gSystem->Unlink(fLearnedName);
+   }
+
+   void TearDown() override
+   {
+      gSystem->Unlink(fFileName);
+      gSystem->Unlink(fLearnedName);
+   }
+
+   // Read branches "a" and "b" only, for the given number of entries.
+   static TTreeCache *ReadSome(TFile &file, Long64_t nentries, const char *key)
+   {
+      TTree *tree = nullptr;
+      file.GetObject("tree", tree);
+      tree->SetCacheSize(10000000);
+      auto cache = tree->GetReadCache(&file);
+      cache->SetLearnedBranchesFile(fLearnedName, key);
+      auto a = tree->GetBranch("a");
+      auto b = tree->GetBranch("b");
+      for (Long64_t i = 0; i < nentries; ++i) {
+         tree->LoadTree(i);
+         a->GetEntry(i);
+         b->GetEntry(i);
+      }
+      return cache;
+   }
+};
+
+TEST_F(TTreeCacheLearnedTest, RecordAndPreload)
+{
+   {
+      TFile file(fFileName);
+      auto cache = ReadSome(file, 500, "code1");
+      EXPECT_FALSE(cache->IsLearning());
+   }
+   std::ifstream in(fLearnedName);
+   ASSERT_TRUE(in.good());
+   std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+   EXPECT_NE(content.find("tree\tcode1\tforward\t2\na\nb\n"), std::string::npos) << content;
+
+   TFile file(fFileName);
+   auto cache = ReadSome(file, 1, "code1");
+   // The learning phase is skipped: the branches are known from the first entry on.
+   EXPECT_FALSE(cache->IsLearning());
+   ASSERT_EQ(2, cache->GetCachedBranches()->GetEntries());
+   EXPECT_STREQ("a", cache->GetCachedBranches()->At(0)->GetName());
+   EXPECT_STREQ("b", cache->GetCachedBranches()->At(1)->GetName());
+}
+
+TEST_F(TTreeCacheLearnedTest, DifferentKey)
+{
+   {
+      TFile file(fFileName);
+      ReadSome(file, 500, "code1");
+   }
+   TFile file(fFileName);
+   auto cache = ReadSome(file, 1, "code2");
+   EXPECT_TRUE(cache->IsLearning());
+}
+
+TEST_F(TTreeCacheLearnedTest, SaveAndLoad)
+{
+   {
+      TFile file(fFileName);
+      TTree *tree = nullptr;
+      file.GetObject("tree", tree);
+      tree->SetCacheSize(10000000);
+      auto cache = tree->GetReadCache(&file);
+      cache->AddBranch("c");
+      EXPECT_EQ(1, cache->SaveLearnedBranches(fLearnedName, "manual"));
+      // Saving the same record again leaves the file untouched.
+      EXPECT_EQ(1, cache->SaveLearnedBranches(fLearnedName, "manual"));
+   }
+   TFile file(fFileName);
+   TTree *tree = nullptr;
+   file.GetObject("tree", tree);
+   tree->SetCacheSize(10000000);
+   auto cache = tree->GetReadCache(&file);
+   EXPECT_EQ(0, cache->LoadLearnedBranches(fLearnedName, "other"));
+   EXPECT_EQ(1, cache->LoadLearnedBranches(fLearnedName, "manual"));
+   EXPECT_FALSE(cache->IsLearning());
+   ASSERT_EQ(1, cache->GetCachedBranches()->GetEntries());
+   EXPECT_STREQ("c", cache->GetCachedBranches()->At(0)->GetName());
+}
+
+TEST(TTreeCache, ClusterPrefetch)
+{
+   const char *fname = "TTreeCacheClusterPrefetch.root";
+   {
+      // Uncompressed, so that one cluster takes 800 kB and the cache holds a single one.
+      TFile file(fname, "RECREATE", "", 0);
+      TTree tree("tree", "tree");
+      double arr[1000];
+      int n = 0;
+      tree.Branch("arr", arr, "arr[1000]/D");
+      tree.Branch("n", &n);
+      tree.SetAutoFlush(100);
+      for (n = 0; n < 1000; ++n) {
+         for (int k = 0; k < 1000; ++k)
+            arr[k] = n * 1000 + k;
+         tree.Fill();
+      }
+      tree.Write();
+   }
+
+   TFile file(fname);
+   TTree *tree = nullptr;
+   file.GetObject("tree", tree);
+   tree->SetCacheSize(1000000);
+   auto cache = tree->GetReadCache(&file);
+   ASSERT_NE(nullptr, cache);
+   cache->SetClusterPrefetch();
+   cache->AddBranch("*");
+   EXPECT_TRUE(cache->IsClusterPrefetch());
+
+   double arr[1000];
+   int n = -1;
+   tree->SetBranchAddress("arr", arr);
+   tree->SetBranchAddress("n", &n);
+   for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+      tree->GetEntry(i);
+      EXPECT_EQ(i, n);
+      EXPECT_EQ(i * 1000 + 999, arr[999]);
+   }
+   // All the clusters but the first were prefetched in the background.
+   EXPECT_GT(cache->GetNClusterPrefetched(), 0);
+
+   file.Close();
+   gSystem->Unlink(fname);
+}
@@ -25,6 +25,7 @@
 
 #include <string.h>
 #include <functional>
+#include <utility>
 #include <vector>
 
 /** \class TTreeView
@@ -88,6 +89,8 @@ private:
    /// User-defined selection of entry numbers to be processed, empty if none was provided
    const TEntryList fEntryList; // const to be sure to avoid race conditions among TTreeViews
    const Internal::FriendInfo fFriendInfo;
+   /// Range [begin, end) of global entry numbers to be processed, [0, -1) means all entries
+   std::pair<Long64_t, Long64_t> fEntriesRange{0, -1};
 
    ROOT::TThreadedObject<ROOT::Internal::TTreeView> fTreeView; ///<! Thread-local TreeViews
 
@@ -101,6 +104,7 @@ public:
    TTreeProcessorMT(TTree &tree, const TEntryList &entries);
    TTreeProcessorMT(TTree &tree);
 
+   void SetEntriesRange(Long64_t begin, Long64_t end);
    void Process(std::function<void(TTreeReader &)> func);
    static void SetMaxTasksPerFilePerWorker(unsigned int m);
    static unsigned int GetMaxTasksPerFilePerWorker();
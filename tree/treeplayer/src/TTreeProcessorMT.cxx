@@ -28,6 +28,9 @@ objects.
 #include "ROOT/TTreeProcessorMT.hxx"
 #include "ROOT/TThreadExecutor.hxx"
 
+#include <algorithm>
+#include <limits>
+
 using namespace ROOT;
 
 namespace ROOT {
@@ -458,6 +461,19 @@ TTreeProcessorMT::TTreeProcessorMT(TTree &tree, const TEntryList &entries)
 /// \param[in] tree Tree or chain of files containing the tree to process.
 TTreeProcessorMT::TTreeProcessorMT(TTree &tree) : TTreeProcessorMT(tree, TEntryList()) {}
 
+////////////////////////////////////////////////////////////////////////
+/// \brief Restrict processing to the entries in [begin, end).
+/// \param[in] begin First entry number to process
+/// \param[in] end One past the last entry number to process, -1 to process until the end of the dataset
+///
+/// Entry numbers are global for the chain of files and refer to the entry numbers of the tree, also if an entry list
+/// is used. The clusters outside of the range are skipped without being read; in the TTreeReaders passed to the
+/// function given to Process, GetCurrentEntry() returns global entry numbers.
+void TTreeProcessorMT::SetEntriesRange(Long64_t begin, Long64_t end)
+{
+   fEntriesRange = std::make_pair(begin, end);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /// Process the entries of a TTree in parallel. The user-provided function
 /// receives a TTreeReader which can be used to iterate on a subrange of
@@ -484,7 +500,8 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    // so we do it here for all files.
    const bool hasFriends = !friendNames.empty();
    const bool hasEntryList = fEntryList.GetN() > 0;
-   const bool shouldRetrieveAllClusters = hasFriends || hasEntryList;
+   const bool hasEntriesRange = fEntriesRange.first > 0 || fEntriesRange.second >= 0;
+   const bool shouldRetrieveAllClusters = hasFriends || hasEntryList || hasEntriesRange;
    const auto clustersAndEntries =
       shouldRetrieveAllClusters ? Internal::MakeClusters(fTreeName, fFileNames) : Internal::ClustersAndEntries{};
    const auto &clusters = clustersAndEntries.first;
@@ -511,6 +528,17 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
       const auto &theseEntries =
          shouldRetrieveAllClusters ? entries : std::vector<Long64_t>({theseClustersAndEntries.second[0]});
 
+      // Skip the clusters outside of the entries range and clip the ones at its borders
+      std::vector<EntryCluster> clustersInRange;
+      if (hasEntriesRange) {
+         const auto end = fEntriesRange.second < 0 ? std::numeric_limits<Long64_t>::max() : fEntriesRange.second;
+         for (const auto &c : thisFileClusters) {
+            if (c.end <= fEntriesRange.first || c.start >= end)
+               continue;
+            clustersInRange.emplace_back(EntryCluster{std::max(c.start, fEntriesRange.first), std::min(c.end, end)});
+         }
+      }
+
       auto processCluster = [&](const Internal::EntryCluster &c) {
          std::unique_ptr<TTreeReader> reader;
          std::unique_ptr<TEntryList> elist;
@@ -519,7 +547,7 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
          func(*reader);
       };
 
-      pool.Foreach(processCluster, thisFileClusters);
+      pool.Foreach(processCluster, hasEntriesRange ? clustersInRange : thisFileClusters);
    };
 
    std::vector<std::size_t> fileIdxs(fFileNames.size());